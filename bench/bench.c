@@ -0,0 +1,1510 @@
+/*
+ * bench.c - loader and dispatch benchmarks
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <AL/al.h>
+#include <AL/alc.h>
+#include <AL/alext.h>
+#include <AL/efx.h>
+#include <AL/salad.h>
+#include <AL/salad_batch.h>
+#include <AL/salad_buffers.h>
+#include <AL/salad_capture.h>
+#include <AL/salad_convert.h>
+#include <AL/salad_format.h>
+#include <AL/salad_oscillator.h>
+#include <AL/salad_pool.h>
+#include <AL/salad_render.h>
+#include <AL/salad_resample.h>
+#include <AL/salad_shadow.h>
+#include <AL/salad_stream.h>
+#include <AL/salad_wave.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN 1
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#include <time.h>
+#endif
+
+#include "stub.h"
+
+#define ITERATIONS  2000
+#define BATCH       1000
+#define RELOADS     5000
+#define SOURCES     256
+#define MARKERS     200
+#define JOBS        32
+#define ROUNDS      20
+#define LOADS       200
+#define WAVE_FRAMES 262144
+#define CONVERT     4096
+
+/**
+ * Reads a monotonic clock
+ * @returns         Current time in nanoseconds
+ */
+static double bench_now(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart * 1.0e9 / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1.0e9 + (double)ts.tv_nsec;
+#endif
+}
+
+static int compare_double(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+/**
+ * Sorts the samples and prints a single result line;
+ * every sample is the time of a single operation, batched
+ * benchmarks divide the time of a batch by its size
+ * @param name      Benchmark name
+ * @param samples   Per-operation timings in nanoseconds
+ * @param count     Number of samples
+ * @param lookups   Total number of load function calls
+ */
+static void report(const char *name, double *samples, int count, unsigned long lookups)
+{
+    double total = 0.0;
+    int i;
+
+    for(i = 0; i < count; ++i)
+        total += samples[i];
+    qsort(samples, count, sizeof(double), &compare_double);
+
+    printf("%-24s %10.1f %10.1f %10.1f %10.1f", name, total / (double)count,
+        samples[count / 2], samples[count * 90 / 100], samples[count * 99 / 100]);
+    if(lookups != 0)
+        printf(" %10.1f", (double)lookups / (double)count);
+    printf("\n");
+}
+
+static double samples[ITERATIONS];
+
+#if !defined(SALAD_DIRECT_LINK)
+
+static void bench_load_eager(void)
+{
+    int i;
+    double start;
+
+    stub_lookups = 0;
+    for(i = 0; i < ITERATIONS; ++i) {
+        start = bench_now();
+        saladLoadALfunc(&stub_loadfunc, NULL);
+        samples[i] = bench_now() - start;
+    }
+
+    report("load/eager", samples, ITERATIONS, stub_lookups);
+}
+
+static void bench_load_lazy(void)
+{
+    int i;
+    double start;
+
+    stub_lookups = 0;
+    for(i = 0; i < ITERATIONS; ++i) {
+        start = bench_now();
+        saladLoadALlazy(&stub_loadfunc, NULL);
+        samples[i] = bench_now() - start;
+    }
+
+    report("load/lazy", samples, ITERATIONS, stub_lookups);
+}
+
+static void bench_load_groups(void)
+{
+    int i;
+    double start;
+
+    stub_lookups = 0;
+    for(i = 0; i < ITERATIONS; ++i) {
+        start = bench_now();
+        saladLoadALgroups(&stub_loadfunc, NULL, SALAD_GROUP_CORE | SALAD_GROUP_ALC);
+        samples[i] = bench_now() - start;
+    }
+
+    report("load/core+alc groups", samples, ITERATIONS, stub_lookups);
+}
+
+static void bench_load_first_calls(int lazy)
+{
+    int i;
+    ALint state;
+    double start;
+
+    stub_lookups = 0;
+    for(i = 0; i < ITERATIONS; ++i) {
+        start = bench_now();
+
+        if(lazy)
+            saladLoadALlazy(&stub_loadfunc, NULL);
+        else saladLoadALfunc(&stub_loadfunc, NULL);
+
+        /* A typical tooling binary only
+         * ever touches a few entry points */
+        alSourcef(1, AL_GAIN, 1.0f);
+        alSource3f(1, AL_POSITION, 0.0f, 0.0f, 0.0f);
+        alSourcePlay(1);
+        alGetSourcei(1, AL_SOURCE_STATE, &state);
+        alGetError();
+
+        samples[i] = bench_now() - start;
+    }
+
+    report(lazy ? "load+5 calls/lazy" : "load+5 calls/eager", samples, ITERATIONS, stub_lookups);
+}
+
+static void bench_dispatch_pointer(void)
+{
+    int i, j;
+    double start;
+
+    saladLoadALfunc(&stub_loadfunc, NULL);
+
+    for(i = 0; i < ITERATIONS; ++i) {
+        start = bench_now();
+        for(j = 0; j < BATCH; ++j)
+            alSourcef(1, AL_GAIN, (ALfloat)j);
+        samples[i] = (bench_now() - start) / BATCH;
+    }
+
+    report("dispatch/salad pointer", samples, ITERATIONS, 0);
+}
+
+/**
+ * Updates a scene's worth of sources every iteration,
+ * either with one call per parameter per source or with
+ * the updates deferred and all sources started at once
+ * @param batched   Non-zero to use the batched calls
+ */
+static void bench_sources(int batched)
+{
+    static ALuint sources[SOURCES];
+    static ALfloat positions[SOURCES * 3];
+    ALsizei i;
+    int j;
+    double start;
+
+    saladLoadALfunc(&stub_loadfunc, NULL);
+
+    for(i = 0; i < SOURCES; ++i) {
+        sources[i] = (ALuint)(i + 1);
+        positions[i * 3 + 0] = (ALfloat)i;
+        positions[i * 3 + 1] = 0.0f;
+        positions[i * 3 + 2] = -(ALfloat)i;
+    }
+
+    for(j = 0; j < ITERATIONS; ++j) {
+        start = bench_now();
+
+        if(batched) {
+#if defined(AL_SOFT_deferred_updates)
+            alDeferUpdatesSOFT();
+#endif
+            for(i = 0; i < SOURCES; ++i) {
+                alSourcefv(sources[i], AL_POSITION, &positions[i * 3]);
+                alSourcefv(sources[i], AL_VELOCITY, &positions[i * 3]);
+                alSourcef(sources[i], AL_GAIN, 1.0f);
+            }
+#if defined(AL_SOFT_deferred_updates)
+            alProcessUpdatesSOFT();
+#endif
+            alSourcePlayv(SOURCES, sources);
+        }
+        else {
+            for(i = 0; i < SOURCES; ++i) {
+                alSource3f(sources[i], AL_POSITION, positions[i * 3 + 0], positions[i * 3 + 1], positions[i * 3 + 2]);
+                alSource3f(sources[i], AL_VELOCITY, positions[i * 3 + 0], positions[i * 3 + 1], positions[i * 3 + 2]);
+                alSourcef(sources[i], AL_GAIN, 1.0f);
+                alSourcePlay(sources[i]);
+            }
+        }
+
+        samples[j] = (bench_now() - start) / SOURCES;
+    }
+
+    report(batched ? "sources/batched update" : "sources/scalar update", samples, ITERATIONS, 0);
+}
+
+/**
+ * Same scene as bench_sources but updated with a
+ * single saladUpdateALsources call per frame
+ */
+static void bench_sources_api(void)
+{
+    static ALuint sources[SOURCES];
+    static ALfloat positions[SOURCES * 3];
+    static ALfloat gains[SOURCES];
+    ALsizei i;
+    int j;
+    double start;
+
+    saladLoadALfunc(&stub_loadfunc, NULL);
+
+    for(i = 0; i < SOURCES; ++i) {
+        sources[i] = (ALuint)(i + 1);
+        positions[i * 3 + 0] = (ALfloat)i;
+        positions[i * 3 + 1] = 0.0f;
+        positions[i * 3 + 2] = -(ALfloat)i;
+        gains[i] = 1.0f;
+    }
+
+    for(j = 0; j < ITERATIONS; ++j) {
+        start = bench_now();
+        saladUpdateALsources(SOURCES, sources, positions, positions, gains);
+        alSourcePlayv(SOURCES, sources);
+        samples[j] = (bench_now() - start) / SOURCES;
+    }
+
+    report("sources/batch api", samples, ITERATIONS, 0);
+}
+
+static void bench_dispatch_direct(void)
+{
+    int i, j;
+    double start;
+
+    for(i = 0; i < ITERATIONS; ++i) {
+        start = bench_now();
+        for(j = 0; j < BATCH; ++j)
+            stub_alSourcef(1, AL_GAIN, (ALfloat)j);
+        samples[i] = (bench_now() - start) / BATCH;
+    }
+
+    report("dispatch/direct call", samples, ITERATIONS, 0);
+}
+
+static void bench_load_device(void)
+{
+    int i;
+    double start;
+
+    saladLoadALfunc(&stub_loadfunc, NULL);
+
+    stub_lookups = 0;
+    for(i = 0; i < ITERATIONS; ++i) {
+        start = bench_now();
+        saladLoadALdevice(NULL);
+        samples[i] = bench_now() - start;
+    }
+
+    report("load/device extensions", samples, ITERATIONS, stub_lookups);
+}
+
+#if defined(ALC_EXT_EFX)
+/**
+ * Measures calling an extension function through the
+ * symbol exported by the library and through the pointer
+ * the driver returned for a device; with a router library
+ * the former costs an extra indirect call every time
+ * @param device    Non-zero to load through saladLoadALdevice
+ */
+static void bench_dispatch_extension(int device)
+{
+    int i, j;
+    double start;
+
+    saladLoadALfunc(&stub_loadfunc, NULL);
+    if(device)
+        saladLoadALdevice(NULL);
+
+    for(i = 0; i < ITERATIONS; ++i) {
+        start = bench_now();
+        for(j = 0; j < BATCH; ++j)
+            alEffectf(1, AL_REVERB_GAIN, (ALfloat)j);
+        samples[i] = (bench_now() - start) / BATCH;
+    }
+
+    report(device ? "dispatch/device efx" : "dispatch/exported efx", samples, ITERATIONS, 0);
+}
+#endif
+
+#if defined(ALC_EXT_EFX) && defined(AL_SOFT_deferred_updates)
+/**
+ * Measures a capability check done with a string
+ * query to the driver against the cached extension bits
+ * @param cached    Non-zero to check with saladHasExtension
+ * @returns         Zero if the checks disagree, non-zero otherwise
+ */
+static int bench_extension_check(int cached)
+{
+    int i, j;
+    int present = 0;
+    double start;
+
+    saladLoadALfunc(&stub_loadfunc, NULL);
+    saladUpdateALextensions(NULL);
+
+    for(i = 0; i < ITERATIONS; ++i) {
+        start = bench_now();
+        for(j = 0; j < BATCH; ++j) {
+            if(cached)
+                present += saladHasExtension(SALAD_AL_SOFT_deferred_updates);
+            else present += alIsExtensionPresent((const ALchar *)"AL_SOFT_deferred_updates");
+        }
+        samples[i] = (bench_now() - start) / BATCH;
+    }
+
+    if(present != ITERATIONS * BATCH || !saladHasExtension(SALAD_ALC_EXT_EFX)) {
+        fprintf(stderr, "extensions: cached bits don't match the driver\n");
+        return 0;
+    }
+
+    report(cached ? "extension/cached bit" : "extension/string query", samples, ITERATIONS, 0);
+    return 1;
+}
+#endif
+
+/**
+ * Same as the scalar source update or the batch API but
+ * through a real implementation, for example the in-tree null
+ * backend, so the time spent inside the library is measured as well
+ * @param libname   OpenAL library to load
+ * @param batched   Non-zero to use saladUpdateALsources
+ * @returns         Zero if the library couldn't be used, non-zero otherwise
+ */
+static int bench_library_sources(const char *libname, int batched)
+{
+    static ALuint sources[SOURCES];
+    static ALfloat positions[SOURCES * 3];
+    static ALfloat gains[SOURCES];
+    ALCdevice *device;
+    ALCcontext *context;
+    ALsizei i;
+    int j;
+    double start;
+
+    if(!saladLoadALlibrary(libname))
+        return 0;
+
+    device = alcOpenDevice(NULL);
+    context = (device != NULL) ? alcCreateContext(device, NULL) : NULL;
+    if(context == NULL || !alcMakeContextCurrent(context)) {
+        fprintf(stderr, "library: %s has no usable device\n", libname);
+        if(device != NULL)
+            alcCloseDevice(device);
+        saladUnloadAL();
+        return 0;
+    }
+
+    alGenSources(SOURCES, sources);
+
+    for(i = 0; i < SOURCES; ++i) {
+        positions[i * 3 + 0] = (ALfloat)i;
+        positions[i * 3 + 1] = 0.0f;
+        positions[i * 3 + 2] = -(ALfloat)i;
+        gains[i] = 1.0f;
+    }
+
+    for(j = 0; j < ITERATIONS; ++j) {
+        start = bench_now();
+        if(batched) {
+            saladUpdateALsources(SOURCES, sources, positions, positions, gains);
+            alSourcePlayv(SOURCES, sources);
+        }
+        else {
+            for(i = 0; i < SOURCES; ++i) {
+                alSource3f(sources[i], AL_POSITION, positions[i * 3 + 0], positions[i * 3 + 1], positions[i * 3 + 2]);
+                alSource3f(sources[i], AL_VELOCITY, positions[i * 3 + 0], positions[i * 3 + 1], positions[i * 3 + 2]);
+                alSourcef(sources[i], AL_GAIN, gains[i]);
+                alSourcePlay(sources[i]);
+            }
+        }
+        samples[j] = (bench_now() - start) / SOURCES;
+    }
+
+    alDeleteSources(SOURCES, sources);
+    alcMakeContextCurrent(NULL);
+    alcDestroyContext(context);
+    alcCloseDevice(device);
+    saladUnloadAL();
+
+    report(batched ? "sources/library batch" : "sources/library", samples, ITERATIONS, 0);
+    return 1;
+}
+
+#if defined(_WIN32)
+typedef HMODULE bench_module_type;
+#define bench_open_module(libname) LoadLibraryA(libname)
+#define bench_close_module(module) FreeLibrary(module)
+#else
+typedef void *bench_module_type;
+#define bench_open_module(libname) dlopen((libname), RTLD_NOW | RTLD_LOCAL)
+#define bench_close_module(module) dlclose(module)
+#endif
+
+/**
+ * Resolves a function from a module the benchmark opened itself
+ * @param procname  Function name
+ * @param arg       Module handle
+ * @returns         A resolved function pointer on success, NULL on failure
+ */
+static void* SALAD_APIENTRY bench_module_loadfunc(const char *procname, void *arg)
+{
+#if defined(_WIN32)
+    return (void *)GetProcAddress((HMODULE)arg, procname);
+#else
+    return dlsym(arg, procname);
+#endif
+}
+
+/**
+ * Sets the parameters of every source each frame through
+ * a real implementation while only one in eight of them
+ * actually moves, then reads their gains back
+ * @param libname   OpenAL library to load
+ * @param shadow    Non-zero to put the shadow state in front of it
+ * @param lazy      Non-zero to load the library with saladLoadALlazy
+ * @returns         Zero if the library couldn't be used, non-zero otherwise
+ */
+static int bench_shadow(const char *libname, int shadow, int lazy)
+{
+    static ALuint sources[SOURCES];
+    SALAD_shadow_stats_type stats;
+    bench_module_type module = NULL;
+    ALCdevice *device;
+    ALCcontext *context;
+    ALfloat gain;
+    ALfloat readback;
+    ALsizei i;
+    int j;
+    int loaded;
+    double start;
+
+    if(lazy) {
+        /* The trampolines resolve through the module
+         * on their first call, shadowed or not */
+        if((module = bench_open_module(libname)) == NULL)
+            return 0;
+        loaded = saladLoadALlazy(&bench_module_loadfunc, (void *)module);
+    }
+    else loaded = saladLoadALlibrary(libname);
+
+    device = loaded ? alcOpenDevice(NULL) : NULL;
+    context = (device != NULL) ? alcCreateContext(device, NULL) : NULL;
+    if(context == NULL || !alcMakeContextCurrent(context) || (shadow && !saladEnableALshadow())) {
+        fprintf(stderr, "shadow: %s has no usable device\n", libname);
+        if(device != NULL)
+            alcCloseDevice(device);
+        saladUnloadAL();
+        if(module != NULL)
+            bench_close_module(module);
+        return 0;
+    }
+
+    alGenSources(SOURCES, sources);
+
+    /* A setter that got past the shadow leaves the first gain behind */
+    alSourcef(sources[0], AL_GAIN, 0.5f);
+    alSourcef(sources[0], AL_GAIN, 0.25f);
+    alGetSourcef(sources[0], AL_GAIN, &readback);
+
+    saladResetALshadowStats();
+
+    for(j = 0; j < ITERATIONS; ++j) {
+        start = bench_now();
+        for(i = 0; i < SOURCES; ++i) {
+            alSource3f(sources[i], AL_POSITION, (ALfloat)(i % 8 == j % 8 ? j : 0), 0.0f, -(ALfloat)i);
+            alSourcef(sources[i], AL_GAIN, 1.0f);
+            alSourcef(sources[i], AL_PITCH, 1.0f);
+            alGetSourcef(sources[i], AL_GAIN, &gain);
+        }
+        samples[j] = (bench_now() - start) / SOURCES;
+    }
+
+    saladGetALshadowStats(&stats);
+    saladDisableALshadow();
+
+    alDeleteSources(SOURCES, sources);
+    alcMakeContextCurrent(NULL);
+    alcDestroyContext(context);
+    alcCloseDevice(device);
+    saladUnloadAL();
+    if(module != NULL)
+        bench_close_module(module);
+
+    if(readback != 0.25f) {
+        fprintf(stderr, "shadow: read back a gain of %g instead of 0.25\n", (double)readback);
+        return 0;
+    }
+
+    if(shadow && (stats.skipped_writes == 0 || stats.cached_reads == 0)) {
+        fprintf(stderr, "shadow: nothing was skipped\n");
+        return 0;
+    }
+
+    report(lazy ? "shadow/lazy on" : shadow ? "shadow/library on" : "shadow/library off", samples, ITERATIONS, 0);
+    return 1;
+}
+
+/**
+ * Measures one-shot buffers the way sound effect code
+ * makes them, either through alGenBuffers and alDeleteBuffers
+ * every time or recycled through a buffer pool
+ * @param libname   OpenAL library to load
+ * @param pooled    Non-zero to use a buffer pool
+ * @returns         Zero on failure
+ */
+static int bench_buffers(const char *libname, int pooled)
+{
+    static short pcm[2048];
+    static ALuint buffers[16];
+    SALAD_buffer_pool_stats_type stats;
+    SALAD_buffer_pool_type *pool = NULL;
+    ALCdevice *device;
+    ALCcontext *context;
+    ALsizei i;
+    int j;
+    double start;
+
+    if(!saladLoadALlibrary(libname))
+        return 0;
+
+    device = alcOpenDevice(NULL);
+    context = (device != NULL) ? alcCreateContext(device, NULL) : NULL;
+    if(context == NULL || !alcMakeContextCurrent(context) || (pooled && (pool = saladCreateALbufferPool(0)) == NULL)) {
+        fprintf(stderr, "buffers: %s has no usable device\n", libname);
+        if(context != NULL)
+            alcDestroyContext(context);
+        if(device != NULL)
+            alcCloseDevice(device);
+        saladUnloadAL();
+        return 0;
+    }
+
+    for(j = 0; j < ITERATIONS; ++j) {
+        start = bench_now();
+        for(i = 0; i < 16; ++i) {
+            if(pooled)
+                buffers[i] = saladAcquireALbuffer(pool, (ALsizei)sizeof(pcm));
+            else alGenBuffers(1, &buffers[i]);
+            alBufferData(buffers[i], AL_FORMAT_MONO16, pcm, (ALsizei)sizeof(pcm), 44100);
+        }
+        for(i = 0; i < 16; ++i) {
+            if(pooled)
+                saladReleaseALbuffer(pool, buffers[i]);
+            else alDeleteBuffers(1, &buffers[i]);
+        }
+        samples[j] = (bench_now() - start) / 16;
+    }
+
+    if(pooled) {
+        saladGetALbufferPoolStats(pool, &stats);
+        saladDestroyALbufferPool(pool);
+    }
+
+    alcMakeContextCurrent(NULL);
+    alcDestroyContext(context);
+    alcCloseDevice(device);
+    saladUnloadAL();
+
+    if(pooled && stats.gen_calls != 1) {
+        fprintf(stderr, "buffers: %lu of %lu buffers recycled\n", stats.hits, stats.acquires);
+        return 0;
+    }
+
+    report(pooled ? "buffers/library pool" : "buffers/library gen", samples, ITERATIONS, 0);
+    return 1;
+}
+
+/**
+ * Writes a WAV file of WAVE_FRAMES frames of
+ * 16-bit stereo, a megabyte of samples
+ * @param path      File to write
+ * @returns         Zero on failure, non-zero on success
+ */
+static int bench_write_wave(const char *path)
+{
+    static const unsigned char header[44] = {
+        'R', 'I', 'F', 'F', 0x24, 0x00, 0x10, 0x00, 'W', 'A', 'V', 'E',
+        'f', 'm', 't', ' ', 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
+        0x44, 0xAC, 0x00, 0x00, 0x10, 0xB1, 0x02, 0x00, 0x04, 0x00, 0x10, 0x00,
+        'd', 'a', 't', 'a', 0x00, 0x00, 0x10, 0x00
+    };
+    static unsigned char frames[4096];
+    FILE *file;
+    int i;
+    int result;
+
+    if((file = fopen(path, "wb")) == NULL)
+        return 0;
+
+    for(i = 0; i < (int)sizeof(frames); ++i)
+        frames[i] = (unsigned char)(i * 7);
+
+    result = fwrite(header, sizeof(header), 1, file) == 1;
+    for(i = 0; result && i < WAVE_FRAMES * 4 / (int)sizeof(frames); ++i)
+        result = fwrite(frames, sizeof(frames), 1, file) == 1;
+
+    return fclose(file) == 0 && result;
+}
+
+/**
+ * Loads a megabyte WAV file into a buffer over and over
+ * again, either read into the heap and copied by alBufferData
+ * or mapped and uploaded with saladUploadALwave, which lets a driver
+ * with AL_EXT_STATIC_BUFFER play the mapping without any copy
+ * @param libname   OpenAL library to load
+ * @param mapped    Non-zero to map the file, zero to read it
+ * @returns         Zero if a load failed, non-zero otherwise
+ */
+static int bench_wave(const char *libname, int mapped)
+{
+    static const char path[] = "salad_bench.wav";
+    SALAD_wave_info_type info;
+    SALAD_wave_type *wave;
+    ALCdevice *device;
+    ALCcontext *context;
+    ALuint buffer;
+    FILE *file;
+    void *data;
+    long size;
+    int result = 1;
+    int j;
+    double start;
+
+    if(!bench_write_wave(path) || !saladLoadALlibrary(libname)) {
+        fprintf(stderr, "wave: failed to set up %s\n", path);
+        remove(path);
+        return 0;
+    }
+
+    device = alcOpenDevice(NULL);
+    context = (device != NULL) ? alcCreateContext(device, NULL) : NULL;
+    if(context == NULL || !alcMakeContextCurrent(context)) {
+        fprintf(stderr, "wave: %s has no usable device\n", libname);
+        if(device != NULL)
+            alcCloseDevice(device);
+        saladUnloadAL();
+        remove(path);
+        return 0;
+    }
+
+    for(j = 0; result && j < LOADS; ++j) {
+        start = bench_now();
+        alGenBuffers(1, &buffer);
+
+        if(mapped) {
+            if((wave = saladOpenALwave(path)) == NULL || !saladUploadALwave(wave, buffer))
+                result = 0;
+            alDeleteBuffers(1, &buffer);
+            saladCloseALwave(wave);
+        }
+        else {
+            data = NULL;
+            if((file = fopen(path, "rb")) == NULL || fseek(file, 0, SEEK_END) != 0 || (size = ftell(file)) <= 0
+                || fseek(file, 0, SEEK_SET) != 0 || (data = malloc((size_t)size)) == NULL
+                || fread(data, (size_t)size, 1, file) != 1 || !saladParseALwave(data, (size_t)size, &info))
+                result = 0;
+            else alBufferData(buffer, info.format, info.data, info.size, info.frequency);
+            if(file != NULL)
+                fclose(file);
+            alDeleteBuffers(1, &buffer);
+            free(data);
+        }
+
+        samples[j] = bench_now() - start;
+    }
+
+    alcMakeContextCurrent(NULL);
+    alcDestroyContext(context);
+    alcCloseDevice(device);
+    saladUnloadAL();
+    remove(path);
+
+    if(!result) {
+        fprintf(stderr, "wave: failed to load %s\n", path);
+        return 0;
+    }
+
+    report(mapped ? "wave/mapped" : "wave/read", samples, LOADS, 0);
+    return 1;
+}
+
+/**
+ * Times uploads of CONVERT float frames in the format
+ * the driver negotiates for them, or quantized to 16-bit
+ * ones as if it had no AL_EXT_float32
+ * @param libname   Library to upload into
+ * @param channels  Channels of the samples
+ * @param quantize  Non-zero to force quantization
+ * @returns         Zero on failure, non-zero on success
+ */
+static int bench_format(const char *libname, ALsizei channels, int quantize)
+{
+    static ALfloat data[CONVERT * 8];
+    SALAD_format_type format;
+    ALCdevice *device;
+    ALCcontext *context;
+    ALuint buffer;
+    char name[32];
+    int result = 1;
+    int i, j;
+    double start;
+
+    if(!saladLoadALlibrary(libname))
+        return 0;
+
+    device = alcOpenDevice(NULL);
+    context = (device != NULL) ? alcCreateContext(device, NULL) : NULL;
+    if(context == NULL || !alcMakeContextCurrent(context) || !saladChooseALformat(channels, SALAD_SAMPLE_FLOAT, &format)) {
+        fprintf(stderr, "format: %s has no usable device\n", libname);
+        if(context != NULL)
+            alcDestroyContext(context);
+        if(device != NULL)
+            alcCloseDevice(device);
+        saladUnloadAL();
+        return 0;
+    }
+
+    if(quantize && format.passes == 0) {
+        format.format = (channels == 2) ? AL_FORMAT_STEREO16 : AL_FORMAT_MONO16;
+        format.format_type = SALAD_SAMPLE_SHORT;
+        format.passes = SALAD_FORMAT_CONVERT;
+    }
+
+    for(i = 0; i < CONVERT * channels; ++i)
+        data[i] = (ALfloat)sin((double)i * 0.01);
+
+    alGenBuffers(1, &buffer);
+    for(j = 0; result && j < ITERATIONS; ++j) {
+        start = bench_now();
+        result = saladUploadALsamples(&format, buffer, data, CONVERT, 48000);
+        samples[j] = bench_now() - start;
+    }
+
+    alDeleteBuffers(1, &buffer);
+    alcMakeContextCurrent(NULL);
+    alcDestroyContext(context);
+    alcCloseDevice(device);
+    saladUnloadAL();
+
+    if(!result) {
+        fprintf(stderr, "format: failed to upload %d channels\n", (int)channels);
+        return 0;
+    }
+
+    sprintf(name, "format/%dch%s%s", (int)channels, (format.passes & SALAD_FORMAT_DOWNMIX) ? " downmix" : "",
+        (format.passes & SALAD_FORMAT_CONVERT) ? " s16" : "");
+    report(name, samples, ITERATIONS, 0);
+    return 1;
+}
+
+/**
+ * Times every conversion with a single set of
+ * kernels, per block of CONVERT samples or frames
+ * @param kernel    SALAD_CONVERT_* kernel to use
+ * @param suffix    Kernel name for the results
+ */
+static void bench_convert(unsigned int kernel, const char *suffix)
+{
+    static ALfloat floats[CONVERT];
+    static ALshort shorts[CONVERT * 2];
+    static ALshort output[CONVERT * 2];
+    static ALubyte bytes[CONVERT];
+    char name[32];
+    int i, j;
+    double start;
+
+    if(saladSetALconvertKernel(kernel) != kernel)
+        return;
+
+    for(i = 0; i < CONVERT; ++i) {
+        floats[i] = (ALfloat)(i % 200 - 100) / 90.0f;
+        shorts[i * 2 + 0] = (ALshort)(i * 37);
+        shorts[i * 2 + 1] = (ALshort)(i * -53);
+        bytes[i] = (ALubyte)(i * 7);
+    }
+
+    for(i = 0; i < 8; ++i) {
+        for(j = 0; j < ITERATIONS; ++j) {
+            start = bench_now();
+            switch(i) {
+                case 0: saladConvertALfloatToShort(output, floats, CONVERT); break;
+                case 1: saladConvertALshortToFloat(floats, shorts, CONVERT); break;
+                case 2: saladConvertALbyteToShort(output, bytes, CONVERT); break;
+                case 3: saladConvertALshortToByte(bytes, shorts, CONVERT); break;
+                case 4: saladInterleaveALshort(output, shorts, &shorts[CONVERT], CONVERT); break;
+                case 5: saladDeinterleaveALshort(output, &output[CONVERT], shorts, CONVERT); break;
+                case 6: saladRemixALshort(output, 2, shorts, 1, CONVERT); break;
+                case 7: saladRemixALshort(output, 1, shorts, 2, CONVERT); break;
+            }
+            samples[j] = bench_now() - start;
+        }
+
+        sprintf(name, "convert/%s %s", (i == 0) ? "f32>s16" : (i == 1) ? "s16>f32" : (i == 2) ? "u8>s16"
+            : (i == 3) ? "s16>u8" : (i == 4) ? "merge" : (i == 5) ? "split" : (i == 6) ? "1>2" : "2>1", suffix);
+        report(name, samples, ITERATIONS, 0);
+    }
+
+    saladSetALconvertKernel(0);
+}
+
+/**
+ * Times rendering an oscillator per block of CONVERT
+ * samples; a negative kernel times the sin() per sample
+ * loop the examples used to have instead
+ * @param kernel    SALAD_CONVERT_* kernel to use
+ * @param suffix    Kernel name for the results
+ */
+static void bench_oscillator(int kernel, const char *suffix)
+{
+    static ALfloat output[CONVERT];
+    ALfloat gains[16];
+    SALAD_oscillator_type *osc;
+    char name[32];
+    double phase = 0.0;
+    int i, j, k;
+    double start;
+
+    if(kernel < 0) {
+        for(j = 0; j < ITERATIONS; ++j) {
+            start = bench_now();
+            for(k = 0; k < CONVERT; ++k, phase += 440.0 / 48000.0)
+                output[k] = (ALfloat)sin(6.283185307179586 * phase);
+            samples[j] = bench_now() - start;
+        }
+
+        report("osc/sin()", samples, ITERATIONS, 0);
+        return;
+    }
+
+    if(saladSetALconvertKernel((unsigned int)kernel) != (unsigned int)kernel || (osc = saladCreateALoscillator(48000)) == NULL)
+        return;
+
+    for(i = 0; i < 16; ++i)
+        gains[i] = 0.5f / (ALfloat)(i + 1);
+    saladSetALoscillatorPitch(osc, 110.0f);
+
+    for(i = 0; i < 3; ++i) {
+        saladSetALoscillatorHarmonics(osc, gains, (i == 1) ? 16 : 1);
+        saladSetALoscillatorNoise(osc, (i == 2) ? 0.1f : 0.0f);
+
+        for(j = 0; j < ITERATIONS; ++j) {
+            start = bench_now();
+            saladRenderALoscillator(osc, output, CONVERT);
+            samples[j] = bench_now() - start;
+        }
+
+        sprintf(name, "osc/%s %s", (i == 0) ? "sine" : (i == 1) ? "harmonics" : "noise", suffix);
+        report(name, samples, ITERATIONS, 0);
+    }
+
+    saladDestroyALoscillator(osc);
+    saladSetALconvertKernel(0);
+}
+
+/**
+ * Times resampling stereo frames per block of CONVERT
+ * input frames, up from 44.1 kHz and down to 22.05 kHz
+ * @param kernel    SALAD_CONVERT_* kernel to use
+ * @param suffix    Kernel name for the results
+ */
+static void bench_resample(unsigned int kernel, const char *suffix)
+{
+    static ALfloat input[CONVERT * 2];
+    static ALfloat output[CONVERT * 4];
+    SALAD_resampler_type *resampler;
+    char name[32];
+    int i, j;
+    double start;
+
+    if(saladSetALconvertKernel(kernel) != kernel)
+        return;
+
+    for(i = 0; i < CONVERT * 2; ++i)
+        input[i] = (ALfloat)(i % 200 - 100) / 100.0f;
+
+    for(i = 0; i < 2; ++i) {
+        if((resampler = (i == 0) ? saladCreateALresampler(44100, 48000, 2) : saladCreateALresampler(48000, 22050, 2)) == NULL)
+            return;
+
+        for(j = 0; j < ITERATIONS; ++j) {
+            start = bench_now();
+            saladResampleALfloat(resampler, output, input, CONVERT);
+            samples[j] = bench_now() - start;
+        }
+
+        sprintf(name, "resample/%s %s", (i == 0) ? "44k>48k" : "48k>22k", suffix);
+        report(name, samples, ITERATIONS, 0);
+        saladDestroyALresampler(resampler);
+    }
+
+    saladSetALconvertKernel(0);
+}
+
+/**
+ * Measures a source pool tick with far more voices than
+ * real sources, every voice moving so the ranking changes
+ * @param libname   OpenAL library to load
+ * @param count     Number of voices
+ * @returns         Zero on failure
+ */
+static int bench_pool(const char *libname, ALsizei count)
+{
+    static short pcm[4410];
+    static SALAD_voice_type voices[4096];
+    SALAD_pool_stats_type stats;
+    SALAD_pool_type *pool = NULL;
+    ALCdevice *device;
+    ALCcontext *context;
+    ALuint buffer = 0;
+    ALsizei i;
+    int j;
+    double start;
+    char name[32];
+
+    if(count > (ALsizei)(sizeof(voices) / sizeof(voices[0])) || !saladLoadALlibrary(libname))
+        return 0;
+
+    device = alcOpenDevice(NULL);
+    context = (device != NULL) ? alcCreateContext(device, NULL) : NULL;
+    if(context == NULL || !alcMakeContextCurrent(context) || (pool = saladCreateALpool(0)) == NULL) {
+        fprintf(stderr, "pool: %s has no usable device\n", libname);
+        if(context != NULL)
+            alcDestroyContext(context);
+        if(device != NULL)
+            alcCloseDevice(device);
+        saladUnloadAL();
+        return 0;
+    }
+
+    alGenBuffers(1, &buffer);
+    alBufferData(buffer, AL_FORMAT_MONO16, pcm, (ALsizei)sizeof(pcm), 44100);
+
+    for(i = 0; i < count; ++i) {
+        voices[i] = saladCreateALvoice(pool);
+        saladSetALvoicei(pool, voices[i], AL_BUFFER, (ALint)buffer);
+        saladSetALvoicei(pool, voices[i], AL_LOOPING, AL_TRUE);
+        saladSetALvoicef(pool, voices[i], SALAD_PRIORITY, (ALfloat)(1 + i % 4));
+        saladPlayALvoice(pool, voices[i]);
+    }
+
+    for(j = 0; j < ITERATIONS; ++j) {
+        start = bench_now();
+        for(i = 0; i < count; ++i)
+            saladSetALvoice3f(pool, voices[i], AL_POSITION, (ALfloat)((i + j) % count), 0.0f, 1.0f);
+        saladUpdateALpool(pool, 1.0f / 60.0f);
+        samples[j] = (bench_now() - start) / count;
+    }
+
+    saladGetALpoolStats(pool, &stats);
+    saladDestroyALpool(pool);
+    alDeleteBuffers(1, &buffer);
+
+    alcMakeContextCurrent(NULL);
+    alcDestroyContext(context);
+    alcCloseDevice(device);
+    saladUnloadAL();
+
+    if(stats.playing != (unsigned long)count || stats.bound == 0 || (stats.bound < (unsigned long)count && stats.culls == 0)) {
+        fprintf(stderr, "pool: %lu of %lu voices playing, %lu bound\n", stats.playing, (unsigned long)count, stats.bound);
+        return 0;
+    }
+
+    sprintf(name, "pool/%d voices", (int)count);
+    report(name, samples, ITERATIONS, 0);
+    return 1;
+}
+
+/**
+ * Sleeps for about a millisecond so the streaming
+ * and capture workers get a chance to run
+ */
+static void bench_yield(void)
+{
+#if defined(_WIN32)
+    Sleep(1);
+#else
+    struct timespec ts = { 0, 1000000 };
+    nanosleep(&ts, NULL);
+#endif
+}
+
+/**
+ * Reads a capture device of the library as soon as
+ * blocks of 2 ms show up and reports how long the oldest
+ * frame of every read had waited since it was recorded
+ * @param libname   OpenAL library to load
+ * @returns         Zero if the library failed to capture, non-zero otherwise
+ */
+static int bench_capture(const char *libname)
+{
+    static ALshort data[96 * 16];
+    SALAD_capture_stats_type stats;
+    SALAD_capture_type *capture;
+    int i;
+
+    if(!saladLoadALlibrary(libname))
+        return 0;
+
+    if((capture = saladOpenALcapture(NULL, 48000, AL_FORMAT_MONO16, 96, 16)) == NULL) {
+        fprintf(stderr, "capture: %s has no usable capture device\n", libname);
+        saladUnloadAL();
+        return 0;
+    }
+
+    saladStartALcapture(capture);
+
+    for(i = 0; i < MARKERS; ++i) {
+        while(saladGetALcaptureFrames(capture) == 0)
+            bench_yield();
+
+        saladReadALcapture(capture, data, 96 * 16);
+        saladGetALcaptureStats(capture, &stats);
+        samples[i] = (double)stats.latency * 1000.0;
+    }
+
+    saladStopALcapture(capture);
+    saladCloseALcapture(capture);
+    saladUnloadAL();
+
+    if(stats.overruns != 0) {
+        fprintf(stderr, "capture: %lu blocks overran\n", stats.overruns);
+        return 0;
+    }
+
+    report("capture/latency", samples, MARKERS, 0);
+    return 1;
+}
+
+#if defined(ALC_SOFT_loopback)
+/**
+ * Renders looping sources through a loopback device of
+ * a library, for example the software renderer of the null
+ * implementation, and reports the time per output frame
+ * @param libname   OpenAL library to load
+ * @param count     Number of sources to play
+ * @returns         Zero if the library failed to render, non-zero otherwise
+ */
+static int bench_render(const char *libname, ALsizei count)
+{
+    static ALuint sources[SOURCES];
+    static ALshort pcm[SOURCES];
+    static ALfloat out[BATCH * 2];
+    ALCint attrs[] = { ALC_FORMAT_CHANNELS_SOFT, ALC_STEREO_SOFT, ALC_FORMAT_TYPE_SOFT, ALC_FLOAT_SOFT, ALC_FREQUENCY, 48000, 0 };
+    ALCdevice *device;
+    ALCcontext *context;
+    ALuint buffer;
+    ALsizei i;
+    int j;
+    double start;
+    char name[32];
+
+    if(!saladLoadALlibrary(libname))
+        return 0;
+
+    /* Nothing to render without the extension */
+    if(alcLoopbackOpenDeviceSOFT == NULL) {
+        saladUnloadAL();
+        return 1;
+    }
+
+    device = alcLoopbackOpenDeviceSOFT(NULL);
+    context = (device != NULL) ? alcCreateContext(device, attrs) : NULL;
+    if(context == NULL || !alcMakeContextCurrent(context)) {
+        fprintf(stderr, "render: %s has no usable loopback device\n", libname);
+        if(device != NULL)
+            alcCloseDevice(device);
+        saladUnloadAL();
+        return 0;
+    }
+
+    for(i = 0; i < SOURCES; ++i)
+        pcm[i] = (ALshort)((i & 1) ? 8192 : -8192);
+
+    alGenBuffers(1, &buffer);
+    alBufferData(buffer, AL_FORMAT_MONO16, pcm, sizeof(pcm), 44100);
+    alGenSources(count, sources);
+
+    for(i = 0; i < count; ++i) {
+        alSourcei(sources[i], AL_BUFFER, (ALint)buffer);
+        alSourcei(sources[i], AL_LOOPING, AL_TRUE);
+        alSource3f(sources[i], AL_POSITION, (ALfloat)(i % 16) - 8.0f, 0.0f, -(ALfloat)i);
+    }
+    alSourcePlayv(count, sources);
+
+    for(j = 0; j < ITERATIONS; ++j) {
+        start = bench_now();
+        alcRenderSamplesSOFT(device, out, BATCH);
+        samples[j] = (bench_now() - start) / BATCH;
+    }
+
+    alDeleteSources(count, sources);
+    alDeleteBuffers(1, &buffer);
+    alcMakeContextCurrent(NULL);
+    alcDestroyContext(context);
+    alcCloseDevice(device);
+    saladUnloadAL();
+
+    sprintf(name, "render/%d sources", (int)count);
+    report(name, samples, ITERATIONS, 0);
+    return 1;
+}
+
+/**
+ * Writes a loud block into a ring stream now and then,
+ * renders in blocks of 10 ms and reports how much audio
+ * went by until the block was heard, in nanoseconds of
+ * audio time rather than of wall time; with AL_SOFT_callback_buffer
+ * the driver reads the ring by itself, otherwise the worker queues it
+ * @param libname   OpenAL library to load
+ * @param direct    Non-zero to let the driver pull, zero to queue
+ * @returns         Zero if the library failed to render, non-zero otherwise
+ */
+static int bench_stream_latency(const char *libname, int direct)
+{
+    static ALshort marker[480];
+    static ALshort out[480 * 2];
+    ALCint attrs[] = { ALC_FORMAT_CHANNELS_SOFT, ALC_STEREO_SOFT, ALC_FORMAT_TYPE_SOFT, ALC_SHORT_SOFT, ALC_FREQUENCY, 48000, 0 };
+    ALCdevice *device;
+    ALCcontext *context;
+    SALAD_streamer_type *streamer;
+    SALAD_stream_type *stream;
+    ALuint source;
+    long frames;
+    int i, j;
+    int result;
+
+    if(!saladLoadALlibrary(libname))
+        return 0;
+
+    if(alcLoopbackOpenDeviceSOFT == NULL) {
+        saladUnloadAL();
+        return 1;
+    }
+
+    device = alcLoopbackOpenDeviceSOFT(NULL);
+    context = (device != NULL) ? alcCreateContext(device, attrs) : NULL;
+    if(context == NULL || !alcMakeContextCurrent(context)) {
+        fprintf(stderr, "stream: %s has no usable loopback device\n", libname);
+        if(device != NULL)
+            alcCloseDevice(device);
+        saladUnloadAL();
+        return 0;
+    }
+
+#if defined(AL_SOFT_callback_buffer)
+    /* Hide the extension to measure the fallback */
+    if(!direct)
+        SALAD_alBufferCallbackSOFT = NULL;
+#endif
+
+    for(i = 0; i < 480; ++i)
+        marker[i] = 16384;
+
+    alGenSources(1, &source);
+    streamer = saladCreateALstreamer(1);
+    stream = (streamer != NULL) ? saladCreateALringStream(streamer, source, AL_FORMAT_MONO16, 48000, (ALsizei)sizeof(marker) * 8) : NULL;
+
+    /* Nothing to compare against without the extension */
+    result = (stream != NULL) ? 1 : 0;
+    if(stream == NULL || saladIsALstreamDirect(stream) != (direct ? AL_TRUE : AL_FALSE)) {
+        if(stream == NULL)
+            fprintf(stderr, "stream: %s failed to create a ring stream\n", libname);
+        saladDeleteALstream(stream);
+        saladDestroyALstreamer(streamer);
+        alDeleteSources(1, &source);
+        alcMakeContextCurrent(NULL);
+        alcDestroyContext(context);
+        alcCloseDevice(device);
+        saladUnloadAL();
+        return result;
+    }
+
+    saladPlayALstream(stream);
+
+    for(i = 0; i < MARKERS; ++i) {
+        while(saladWriteALstream(stream, marker, sizeof(marker)) == 0)
+            bench_yield();
+
+        /* The ring runs dry in between and is padded with
+         * silence, so whatever is heard was queued behind nothing */
+        for(frames = 0; frames < 48000; frames += 480) {
+            bench_yield();
+            alcRenderSamplesSOFT(device, out, 480);
+
+            for(j = 0; j < 480 && out[j * 2] == 0; ++j);
+            if(j < 480) {
+                frames += j;
+                break;
+            }
+        }
+
+        samples[i] = (double)frames * 1e9 / 48000.0;
+
+        /* Wait for the marker to pass before the next one */
+        do {
+            bench_yield();
+            alcRenderSamplesSOFT(device, out, 480);
+            for(j = 0; j < 480 * 2 && out[j] == 0; ++j);
+        } while(j < 480 * 2);
+    }
+
+    saladDeleteALstream(stream);
+    saladDestroyALstreamer(streamer);
+    alDeleteSources(1, &source);
+    alcMakeContextCurrent(NULL);
+    alcDestroyContext(context);
+    alcCloseDevice(device);
+    saladUnloadAL();
+
+    report(direct ? "stream/callback" : "stream/queued", samples, MARKERS, 0);
+    return 1;
+}
+
+/**
+ * Renders a second of 16 looping sources, the
+ * kind of scene an audio preview would have
+ * @param renderer  Renderer of the worker thread
+ * @param index     Index of the job
+ * @param arg       Unused
+ * @returns         Non-zero if the job succeeded, zero otherwise
+ */
+static int SALAD_APIENTRY bench_offline_job(SALAD_renderer_type *renderer, ALsizei index, void *arg)
+{
+    static ALshort pcm[SOURCES];
+    ALshort out[BATCH * 2];
+    ALuint sources[16];
+    ALuint buffer;
+    ALsizei i;
+    int result = 1;
+
+    (void)index;
+    (void)arg;
+
+    for(i = 0; i < SOURCES; ++i)
+        pcm[i] = (ALshort)((i & 1) ? 8192 : -8192);
+
+    alGenBuffers(1, &buffer);
+    alBufferData(buffer, AL_FORMAT_MONO16, pcm, sizeof(pcm), 44100);
+    alGenSources(16, sources);
+    for(i = 0; i < 16; ++i) {
+        alSourcei(sources[i], AL_BUFFER, (ALint)buffer);
+        alSourcei(sources[i], AL_LOOPING, AL_TRUE);
+        alSource3f(sources[i], AL_POSITION, (ALfloat)i - 8.0f, 0.0f, -1.0f);
+    }
+    alSourcePlayv(16, sources);
+
+    for(i = 0; result && i < 48; ++i)
+        result = saladRenderALmemory(renderer, out, BATCH);
+
+    alDeleteSources(16, sources);
+    alDeleteBuffers(1, &buffer);
+    return result && alGetError() == AL_NO_ERROR;
+}
+
+/**
+ * Runs batches of offline render jobs on a number of threads
+ * and reports the wall time per output frame of a whole batch,
+ * which is what matters for throughput; the null implementation
+ * mixes behind a single lock so it gains nothing from threads
+ * @param libname   OpenAL library to load
+ * @param threads   Number of threads
+ * @returns         Zero if a job failed, non-zero otherwise
+ */
+static int bench_offline(const char *libname, ALsizei threads)
+{
+    char name[32];
+    double start;
+    int i;
+
+    if(!saladLoadALlibrary(libname))
+        return 0;
+
+    if(alcLoopbackOpenDeviceSOFT == NULL) {
+        saladUnloadAL();
+        return 1;
+    }
+
+    for(i = 0; i < ROUNDS; ++i) {
+        start = bench_now();
+        if(saladRunALrenderJobs(48000, ALC_STEREO_SOFT, ALC_SHORT_SOFT, &bench_offline_job, NULL, JOBS, threads) != JOBS) {
+            fprintf(stderr, "offline: %s failed to render\n", libname);
+            saladUnloadAL();
+            return 0;
+        }
+        samples[i] = (bench_now() - start) / (JOBS * 48.0 * BATCH);
+    }
+
+    saladUnloadAL();
+
+    sprintf(name, "offline/%d threads", (int)threads);
+    report(name, samples, ROUNDS, 0);
+    return 1;
+}
+#endif
+
+/**
+ * Loads and unloads the library over and over again
+ * and makes sure nothing is left behind afterwards
+ * @param libname   OpenAL library to load, NULL to use the stub
+ * @returns         Zero if anything leaked, non-zero otherwise
+ */
+static int bench_reload(const char *libname)
+{
+    int i;
+    int loaded;
+    double start;
+
+    for(i = 0; i < RELOADS; ++i) {
+        start = bench_now();
+
+        if(libname != NULL)
+            loaded = saladLoadALlibrary(libname);
+        else loaded = saladLoadALfunc(&stub_loadfunc, NULL);
+        saladUnloadAL();
+
+        samples[i % ITERATIONS] = bench_now() - start;
+
+        if(!loaded || SALAD_alGetError != NULL || SALAD_alcOpenDevice != NULL) {
+            fprintf(stderr, "reload: iteration %d left the function table in a bad state\n", i);
+            return 0;
+        }
+    }
+
+#if !defined(_WIN32)
+    /* Every load must have been matched by a close
+     * or the module would still be resident right now */
+    if(libname != NULL && dlopen(libname, RTLD_LAZY | RTLD_NOLOAD) != NULL) {
+        fprintf(stderr, "reload: %s is still loaded after %d reloads\n", libname, RELOADS);
+        return 0;
+    }
+#endif
+
+    report(libname != NULL ? "reload/library" : "reload/stub", samples, ITERATIONS, 0);
+    return 1;
+}
+#else
+static void bench_dispatch_direct_link(void)
+{
+    int i, j;
+    double start;
+
+    for(i = 0; i < ITERATIONS; ++i) {
+        start = bench_now();
+        for(j = 0; j < BATCH; ++j)
+            alSourcef(1, AL_GAIN, (ALfloat)j);
+        samples[i] = (bench_now() - start) / BATCH;
+    }
+
+    report("dispatch/direct link", samples, ITERATIONS, 0);
+}
+#endif
+
+int main(int argc, char **argv)
+{
+    printf("%-24s %10s %10s %10s %10s %10s\n", "benchmark", "ns/op", "p50", "p90", "p99", "lookups/op");
+
+#if defined(SALAD_DIRECT_LINK)
+    /* Nothing is loaded at runtime so only the
+     * cost of calling the linked library is measured */
+    (void)argc;
+    (void)argv;
+    bench_dispatch_direct_link();
+#else
+    bench_load_eager();
+    bench_load_lazy();
+    bench_load_groups();
+    bench_load_first_calls(0);
+    bench_load_first_calls(1);
+    bench_dispatch_pointer();
+    bench_dispatch_direct();
+    bench_sources(0);
+    bench_sources(1);
+    bench_sources_api();
+    bench_load_device();
+#if defined(ALC_EXT_EFX)
+    bench_dispatch_extension(0);
+    bench_dispatch_extension(1);
+#endif
+#if defined(ALC_EXT_EFX) && defined(AL_SOFT_deferred_updates)
+    if(!bench_extension_check(0) || !bench_extension_check(1))
+        return 1;
+#endif
+
+    if(!bench_reload(NULL))
+        return 1;
+    if(argc > 1 && (!bench_library_sources(argv[1], 0) || !bench_library_sources(argv[1], 1) || !bench_reload(argv[1])))
+        return 1;
+#if defined(ALC_SOFT_loopback)
+    if(argc > 1 && (!bench_render(argv[1], 1) || !bench_render(argv[1], 64)))
+        return 1;
+    if(argc > 1 && (!bench_stream_latency(argv[1], 1) || !bench_stream_latency(argv[1], 0)))
+        return 1;
+    if(argc > 1 && (!bench_offline(argv[1], 1) || !bench_offline(argv[1], 4)))
+        return 1;
+#endif
+    if(argc > 1 && !bench_capture(argv[1]))
+        return 1;
+    if(argc > 1 && (!bench_shadow(argv[1], 0, 0) || !bench_shadow(argv[1], 1, 0) || !bench_shadow(argv[1], 1, 1)))
+        return 1;
+    if(argc > 1 && (!bench_buffers(argv[1], 0) || !bench_buffers(argv[1], 1)))
+        return 1;
+    if(argc > 1 && (!bench_pool(argv[1], 256) || !bench_pool(argv[1], 4096)))
+        return 1;
+    if(argc > 1 && (!bench_wave(argv[1], 0) || !bench_wave(argv[1], 1)))
+        return 1;
+    if(argc > 1 && (!bench_format(argv[1], 2, 0) || !bench_format(argv[1], 2, 1) || !bench_format(argv[1], 6, 0)))
+        return 1;
+
+    /* Conversions, oscillators and resamplers don't need a library */
+    bench_convert(SALAD_CONVERT_SCALAR, "c");
+    bench_convert(SALAD_CONVERT_SSE2, "sse2");
+    bench_convert(SALAD_CONVERT_AVX2, "avx2");
+    bench_convert(SALAD_CONVERT_NEON, "neon");
+    bench_oscillator(-1, NULL);
+    bench_oscillator(SALAD_CONVERT_SCALAR, "c");
+    bench_oscillator(SALAD_CONVERT_SSE2, "sse2");
+    bench_oscillator(SALAD_CONVERT_AVX2, "avx2");
+    bench_oscillator(SALAD_CONVERT_NEON, "neon");
+    bench_resample(SALAD_CONVERT_SCALAR, "c");
+    bench_resample(SALAD_CONVERT_SSE2, "sse2");
+    bench_resample(SALAD_CONVERT_AVX2, "avx2");
+    bench_resample(SALAD_CONVERT_NEON, "neon");
+#endif
+    return 0;
+}
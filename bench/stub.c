@@ -0,0 +1,204 @@
+/*
+ * stub.c - stub OpenAL functions for benchmarks
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include "stub.h"
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+unsigned long stub_lookups = 0;
+
+static void AL_APIENTRY stub_unused(void)
+{
+}
+
+ALenum AL_APIENTRY stub_alGetError(void)
+{
+    return AL_NO_ERROR;
+}
+
+void AL_APIENTRY stub_alGetSourcei(ALuint source, ALenum param, ALint *value)
+{
+    (void)source;
+    (void)param;
+    *value = 0;
+}
+
+void AL_APIENTRY stub_alSource3f(ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
+{
+    (void)source;
+    (void)param;
+    (void)value1;
+    (void)value2;
+    (void)value3;
+}
+
+void AL_APIENTRY stub_alSourcef(ALuint source, ALenum param, ALfloat value)
+{
+    (void)source;
+    (void)param;
+    (void)value;
+}
+
+void AL_APIENTRY stub_alSourcefv(ALuint source, ALenum param, const ALfloat *values)
+{
+    (void)source;
+    (void)param;
+    (void)values;
+}
+
+void AL_APIENTRY stub_alSourcePlay(ALuint source)
+{
+    (void)source;
+}
+
+void AL_APIENTRY stub_alSourcePlayv(ALsizei n, const ALuint *sources)
+{
+    (void)n;
+    (void)sources;
+}
+
+void AL_APIENTRY stub_alEffectf(ALuint effect, ALenum param, ALfloat value)
+{
+    (void)effect;
+    (void)param;
+    (void)value;
+}
+
+/* Extensions the stub driver claims to support, checked
+ * the way drivers do it: a case-insensitive word search */
+static const char stub_extensions[] =
+    "AL_EXT_ALAW AL_EXT_BFORMAT AL_EXT_DOUBLE AL_EXT_EXPONENT_DISTANCE AL_EXT_FLOAT32 "
+    "AL_EXT_IMA4 AL_EXT_LINEAR_DISTANCE AL_EXT_MCFORMATS AL_EXT_MULAW AL_EXT_MULAW_BFORMAT "
+    "AL_EXT_MULAW_MCFORMATS AL_EXT_OFFSET AL_EXT_source_distance_model AL_LOKI_quadriphonic "
+    "AL_SOFT_block_alignment AL_SOFT_buffer_length_query AL_SOFT_deferred_updates "
+    "AL_SOFT_direct_channels AL_SOFT_loop_points AL_SOFT_source_latency";
+
+static const char stub_alc_extensions[] =
+    "ALC_ENUMERATE_ALL_EXT ALC_ENUMERATION_EXT ALC_EXT_CAPTURE ALC_EXT_DEDICATED "
+    "ALC_EXT_disconnect ALC_EXT_EFX ALC_EXT_thread_local_context ALC_SOFT_loopback";
+
+static int stub_has_word(const char *list, const char *name)
+{
+    size_t length = strlen(name);
+    size_t i;
+
+    while(*list) {
+        for(i = 0; i < length && list[i] && tolower((unsigned char)list[i]) == tolower((unsigned char)name[i]); ++i);
+        if(i == length && (list[i] == ' ' || list[i] == 0))
+            return 1;
+        while(*list && *list != ' ')
+            ++list;
+        while(*list == ' ')
+            ++list;
+    }
+
+    return 0;
+}
+
+static ALboolean AL_APIENTRY stub_alIsExtensionPresent(const ALchar *extname)
+{
+    return stub_has_word(stub_extensions, (const char *)extname) ? AL_TRUE : AL_FALSE;
+}
+
+static ALCboolean ALC_APIENTRY stub_alcIsExtensionPresent(ALCdevice *device, const ALCchar *extname)
+{
+    (void)device;
+    return stub_has_word(stub_alc_extensions, (const char *)extname) ? ALC_TRUE : ALC_FALSE;
+}
+
+static ALCcontext *ALC_APIENTRY stub_alcGetCurrentContext(void)
+{
+    /* Never dereferenced, it only has to be non-NULL */
+    return (ALCcontext *)stub_alc_extensions;
+}
+
+/* What a router library keeps per driver; the
+ * exported functions look it up on every call */
+struct stub_driver {
+    void (AL_APIENTRY *alEffectf)(ALuint effect, ALenum param, ALfloat value);
+};
+
+static const struct stub_driver stub_driver = { &stub_alEffectf };
+static const struct stub_driver *volatile stub_current_driver = &stub_driver;
+
+static void AL_APIENTRY stub_router_alEffectf(ALuint effect, ALenum param, ALfloat value)
+{
+    stub_current_driver->alEffectf(effect, param, value);
+}
+
+static void *AL_APIENTRY stub_alGetProcAddress(const ALchar *fname)
+{
+    if(!strcmp((const char *)fname, "alEffectf"))
+        return (void *)&stub_alEffectf;
+    return stub_loadfunc((const char *)fname, NULL);
+}
+
+static void *ALC_APIENTRY stub_alcGetProcAddress(ALCdevice *device, const ALCchar *funcname)
+{
+    (void)device;
+    return stub_alGetProcAddress((const ALchar *)funcname);
+}
+
+struct stub_proc {
+    const char *name;
+    void (*proc)(void);
+};
+
+/* Sorted by name so lookups can be done with bsearch */
+static const struct stub_proc stub_procs[] = {
+    { "alEffectf",             (void(*)(void))&stub_router_alEffectf       },
+    { "alGetError",            (void(*)(void))&stub_alGetError             },
+    { "alGetProcAddress",      (void(*)(void))&stub_alGetProcAddress       },
+    { "alGetSourcei",          (void(*)(void))&stub_alGetSourcei           },
+    { "alIsExtensionPresent",  (void(*)(void))&stub_alIsExtensionPresent   },
+    { "alSource3f",            (void(*)(void))&stub_alSource3f             },
+    { "alSourcePlay",          (void(*)(void))&stub_alSourcePlay           },
+    { "alSourcePlayv",         (void(*)(void))&stub_alSourcePlayv          },
+    { "alSourcef",             (void(*)(void))&stub_alSourcef              },
+    { "alSourcefv",            (void(*)(void))&stub_alSourcefv             },
+    { "alcGetCurrentContext",  (void(*)(void))&stub_alcGetCurrentContext   },
+    { "alcGetProcAddress",     (void(*)(void))&stub_alcGetProcAddress      },
+    { "alcIsExtensionPresent", (void(*)(void))&stub_alcIsExtensionPresent  },
+};
+
+static int compare_proc(const void *a, const void *b)
+{
+    return strcmp((const char *)a, ((const struct stub_proc *)b)->name);
+}
+
+void *stub_loadfunc(const char *procname, void *arg)
+{
+    const struct stub_proc *found;
+
+    (void)arg;
+    stub_lookups++;
+
+    found = bsearch(procname, stub_procs, sizeof(stub_procs) / sizeof(stub_procs[0]), sizeof(stub_procs[0]), &compare_proc);
+    if(found != NULL)
+        return (void *)found->proc;
+    return (void *)&stub_unused;
+}
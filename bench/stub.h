@@ -0,0 +1,63 @@
+/*
+ * stub.h - stub OpenAL functions for benchmarks
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef BENCH_STUB_H
+#define BENCH_STUB_H 1
+#include <AL/al.h>
+#include <AL/alc.h>
+
+/**
+ * Number of times stub_loadfunc has been called
+ * since the counter was last reset by the caller
+ */
+extern unsigned long stub_lookups;
+
+/**
+ * A load function that resolves every name to a stub;
+ * the functions declared below do nothing and the rest
+ * resolve to a placeholder that must never be called
+ * @param procname  Function name
+ * @param arg       Unused
+ * @returns         A stub function pointer
+ */
+void *stub_loadfunc(const char *procname, void *arg);
+
+ALenum AL_APIENTRY stub_alGetError(void);
+void AL_APIENTRY stub_alGetSourcei(ALuint source, ALenum param, ALint *value);
+void AL_APIENTRY stub_alSource3f(ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3);
+void AL_APIENTRY stub_alSourcef(ALuint source, ALenum param, ALfloat value);
+void AL_APIENTRY stub_alSourcefv(ALuint source, ALenum param, const ALfloat *values);
+void AL_APIENTRY stub_alSourcePlay(ALuint source);
+void AL_APIENTRY stub_alSourcePlayv(ALsizei n, const ALuint *sources);
+
+/**
+ * The driver's own alEffectf; stub_loadfunc resolves
+ * alEffectf to a router-style export that forwards to this
+ * through a driver table, stub_alcGetProcAddress and
+ * stub_alGetProcAddress hand this one out directly
+ */
+void AL_APIENTRY stub_alEffectf(ALuint effect, ALenum param, ALfloat value);
+
+#endif /* BENCH_STUB_H */
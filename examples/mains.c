@@ -26,9 +26,8 @@
 #include <AL/al.h>
 #include <AL/alc.h>
 #include <AL/salad.h>
+#include <AL/salad_oscillator.h>
 
-#include <math.h>
-#include <limits.h>
 #include <stdio.h>
 
 #define DURATION    1
@@ -39,22 +38,15 @@ typedef ALshort snd_t[SNDSIZE];
 
 static void generate_snd(snd_t sndbuffer)
 {
-    int n;
-    double s;
-
-    for(n = 0; n < SNDSIZE; ++n) {
-        s = 0.0;
-        s += 1.0 * sin(2.0 * 3.1415 * 50.0  * n / SNDSIZE);
-        s += 2.0 * sin(2.0 * 3.1415 * 100.0 * n / SNDSIZE);
-        s += 1.0 * sin(2.0 * 3.1415 * 200.0 * n / SNDSIZE);
-        s += 0.5 * sin(2.0 * 3.1415 * 400.0 * n / SNDSIZE);
-
-        /* Clamp into the correct range */
-        if(s < -1.0) s = -1.0;
-        if(s > +1.0) s = +1.0;
-
-        sndbuffer[n] = (ALshort)(s * SHRT_MAX);
-    }
+    /* 50 Hz mains hum with its 100, 200 and 400 Hz harmonics,
+     * loud enough to clip the same way a real one would */
+    static const ALfloat hum[8] = { 1.0f, 2.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.5f };
+    SALAD_oscillator_type *osc = saladCreateALoscillator(SAMPLERATE);
+
+    saladSetALoscillatorHarmonics(osc, hum, 8);
+    saladSetALoscillatorPitch(osc, 50.0f);
+    saladRenderALoscillatorShort(osc, sndbuffer, SNDSIZE);
+    saladDestroyALoscillator(osc);
 }
 
 int main(void)
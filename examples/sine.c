@@ -26,9 +26,9 @@
 #include <AL/al.h>
 #include <AL/alc.h>
 #include <AL/salad.h>
+#include <AL/salad_oscillator.h>
+#include <AL/salad_wave.h>
 
-#include <math.h>
-#include <limits.h>
 #include <stdio.h>
 
 #define DURATION    1
@@ -39,21 +39,33 @@ typedef ALshort snd_t[SNDSIZE];
 
 static void generate_snd(snd_t sndbuffer)
 {
-    int n;
-    for(n = 0; n < SNDSIZE; ++n) {
-        sndbuffer[n] = (ALshort)(sin(2.0 * 3.1415 * 440 * n / SNDSIZE) * SHRT_MAX);
-    }
+    static const ALfloat sine[1] = { 1.0f };
+    SALAD_oscillator_type *osc = saladCreateALoscillator(SAMPLERATE);
+
+    saladSetALoscillatorHarmonics(osc, sine, 1);
+    saladSetALoscillatorPitch(osc, 440.0f);
+    saladRenderALoscillatorShort(osc, sndbuffer, SNDSIZE);
+    saladDestroyALoscillator(osc);
 }
 
-int main(void)
+int main(int argc, char **argv)
 {
     ALCdevice *device;
     ALCcontext *context;
     ALuint buffer, source;
+    ALCint frequency = 0;
+    SALAD_wave_type *wave = NULL;
     snd_t sndbuffer;
 
+    /* Play a WAV file instead of the sine if there's one */
+    if(argc > 1 && (wave = saladOpenALwave(argv[1])) == NULL) {
+        fprintf(stderr, "salad: %s is not a supported WAV file\n", argv[1]);
+        return 1;
+    }
+
     if(!saladLoadALdefault()) {
         fprintf(stderr, "salad: load failed\n");
+        saladCloseALwave(wave);
         return 1;
     }
 
@@ -61,10 +73,17 @@ int main(void)
     context = alcCreateContext(device, NULL);
     alcMakeContextCurrent(context);
 
-    generate_snd(sndbuffer);
-
     alGenBuffers(1, &buffer);
-    alBufferData(buffer, AL_FORMAT_MONO16, sndbuffer, sizeof(sndbuffer), SNDSIZE);
+
+    if(wave != NULL) {
+        /* Resampled once here instead of on every mix */
+        alcGetIntegerv(device, ALC_FREQUENCY, 1, &frequency);
+        saladUploadALwaveAt(wave, buffer, frequency);
+    }
+    else {
+        generate_snd(sndbuffer);
+        alBufferData(buffer, AL_FORMAT_MONO16, sndbuffer, sizeof(sndbuffer), SNDSIZE);
+    }
 
     alGenSources(1, &source);
     alSourcei(source, AL_BUFFER, buffer);
@@ -79,6 +98,9 @@ int main(void)
 
     alDeleteBuffers(1, &buffer);
 
+    /* The buffer may have been playing the mapping itself */
+    saladCloseALwave(wave);
+
     alcMakeContextCurrent(NULL);
     alcDestroyContext(context);
     alcCloseDevice(device);
@@ -0,0 +1,934 @@
+/*
+ * salad_gen.c - OpenAL loader generator
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LINE    1024
+#define MAX_HEADERS 32
+#define MAX_BLOCKS  256
+#define MAX_ENTRIES 8192
+#define MAX_INCLUDE 8
+#define MAX_BITS    32
+
+#define COPYRIGHT   "Copyright (C) 2021-2026, Kirill Dmitrievich"
+#define NOTICE      "/* Generated by salad_gen from gen/salad.reg, do not edit */"
+
+enum {
+    ENTRY_TEXT,
+    ENTRY_ENUM,
+    ENTRY_COMMAND
+};
+
+struct header {
+    char *file;
+    char *guard;
+    char *desc;
+    char *includes[MAX_INCLUDE];
+    int num_includes;
+};
+
+struct block {
+    char *name;
+    char *group;
+    char *desc;
+    int header;
+    int extension;
+    int selected;
+    int bit;        /* Presence bit of an extension */
+};
+
+struct entry {
+    int kind;
+    int header;
+    int block;      /* -1 for the header prologue */
+    char *name;     /* Enum or command name, text line */
+    char *value;    /* Enum value, command return type */
+    char *params;   /* Command parameter list */
+    char *args;     /* Command argument names */
+};
+
+static const char *license_text[] = {
+    " *",
+    " * Redistribution and use in source and binary forms, with or without",
+    " * modification, are permitted provided that the following conditions are met:",
+    " *",
+    " * 1. Redistributions of source code must retain the above copyright notice, this",
+    " *    list of conditions and the following disclaimer.",
+    " *",
+    " * 2. Redistributions in binary form must reproduce the above copyright notice,",
+    " *    this list of conditions and the following disclaimer in the documentation",
+    " *    and/or other materials provided with the distribution.",
+    " *",
+    " * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS \"AS IS\"",
+    " * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE",
+    " * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE",
+    " * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE",
+    " * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL",
+    " * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR",
+    " * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER",
+    " * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,",
+    " * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE",
+    " * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.",
+    NULL
+};
+
+static const char *registry_name = NULL;
+static int registry_line = 0;
+
+static struct header headers[MAX_HEADERS];
+static struct block blocks[MAX_BLOCKS];
+static struct entry entries[MAX_ENTRIES];
+static int num_headers = 0;
+static int num_blocks = 0;
+static int num_entries = 0;
+static int num_bits = 0;
+
+static void fatal(const char *fmt, ...)
+{
+    va_list ap;
+
+    if(registry_line > 0)
+        fprintf(stderr, "%s:%d: ", registry_name, registry_line);
+    else fprintf(stderr, "salad_gen: ");
+
+    va_start(ap, fmt);
+    vfprintf(stderr, fmt, ap);
+    va_end(ap);
+
+    fputc('\n', stderr);
+    exit(1);
+}
+
+static char *copy_string(const char *s, size_t length)
+{
+    char *result;
+
+    if((result = malloc(length + 1)) == NULL)
+        fatal("out of memory");
+    memcpy(result, s, length);
+    result[length] = 0;
+    return result;
+}
+
+static int is_space(int c)
+{
+    return c == ' ' || c == '\t';
+}
+
+static int is_ident(int c)
+{
+    return c == '_' || (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+static int to_lower(int c)
+{
+    return (c >= 'A' && c <= 'Z') ? (c - 'A' + 'a') : c;
+}
+
+/**
+ * Splits off the next whitespace-separated word
+ * @param s         Pointer to the remaining line, advanced past the word
+ * @returns         A newly allocated word, NULL at the end of the line
+ */
+static char *next_word(const char **s)
+{
+    const char *begin;
+
+    while(is_space(**s))
+        ++(*s);
+    if(**s == 0)
+        return NULL;
+
+    begin = *s;
+    while(**s != 0 && !is_space(**s))
+        ++(*s);
+    return copy_string(begin, *s - begin);
+}
+
+static char *need_word(const char **s, const char *what)
+{
+    char *word;
+
+    if((word = next_word(s)) == NULL)
+        fatal("expected %s", what);
+    return word;
+}
+
+static const char *rest_of_line(const char *s)
+{
+    while(is_space(*s))
+        ++s;
+    return s;
+}
+
+static struct entry *add_entry(int kind)
+{
+    struct entry *entry;
+
+    if(num_headers == 0)
+        fatal("entry outside of a header");
+    if(num_entries >= MAX_ENTRIES)
+        fatal("too many entries");
+
+    entry = &entries[num_entries++];
+    memset(entry, 0, sizeof(struct entry));
+    entry->kind = kind;
+    entry->header = num_headers - 1;
+    entry->block = -1;
+
+    if(num_blocks > 0 && blocks[num_blocks - 1].header == entry->header)
+        entry->block = num_blocks - 1;
+    return entry;
+}
+
+/**
+ * Parses a C function declaration without the
+ * trailing semicolon: <return type> <name>(<parameters>)
+ * @param entry     Command entry to fill
+ * @param s         Declaration text
+ */
+static void parse_command(struct entry *entry, const char *s)
+{
+    const char *open = strchr(s, '(');
+    const char *close = strrchr(s, ')');
+    const char *name_end;
+    const char *name;
+    const char *ret_end;
+    const char *param;
+    const char *arg;
+    char args[MAX_LINE];
+    size_t length = 0;
+
+    if(open == NULL || close == NULL || close < open)
+        fatal("malformed command");
+
+    for(name_end = open; name_end > s && is_space(name_end[-1]); --name_end);
+    for(name = name_end; name > s && is_ident(name[-1]); --name);
+    if(name == name_end)
+        fatal("command without a name");
+
+    for(ret_end = name; ret_end > s && is_space(ret_end[-1]); --ret_end);
+    if(ret_end == s)
+        fatal("command without a return type");
+
+    entry->name = copy_string(name, name_end - name);
+    entry->params = copy_string(open + 1, close - open - 1);
+
+    /* Pointer return types are always
+     * spelled with the star set apart */
+    if(ret_end[-1] == '*') {
+        for(--ret_end; ret_end > s && is_space(ret_end[-1]); --ret_end);
+        entry->value = copy_string(s, ret_end - s + 2);
+        entry->value[ret_end - s] = ' ';
+        entry->value[ret_end - s + 1] = '*';
+    }
+    else {
+        entry->value = copy_string(s, ret_end - s);
+    }
+
+    args[0] = 0;
+
+    if(strcmp(entry->params, "void") != 0) {
+        for(param = entry->params; *param; param = (*arg == ',') ? arg + 1 : arg) {
+            const char *end;
+            const char *begin;
+
+            for(arg = param; *arg && *arg != ','; ++arg);
+            for(end = arg; end > param && !is_ident(end[-1]); --end);
+            for(begin = end; begin > param && is_ident(begin[-1]); --begin);
+
+            if(begin == end || length + (end - begin) + 3 > sizeof(args))
+                fatal("malformed parameter list of %s", entry->name);
+
+            if(length != 0) {
+                args[length++] = ',';
+                args[length++] = ' ';
+            }
+
+            memcpy(args + length, begin, end - begin);
+            length += end - begin;
+            args[length] = 0;
+        }
+    }
+
+    entry->args = copy_string(args, length);
+}
+
+static void parse_registry(const char *path)
+{
+    char line[MAX_LINE];
+    FILE *fp;
+
+    if((fp = fopen(path, "r")) == NULL)
+        fatal("%s: unable to open", path);
+
+    registry_name = path;
+    registry_line = 0;
+
+    while(fgets(line, sizeof(line), fp)) {
+        const char *s = line;
+        size_t length = strlen(line);
+        struct entry *entry;
+        char *keyword;
+
+        ++registry_line;
+
+        while(length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r' || is_space(line[length - 1])))
+            line[--length] = 0;
+
+        if(line[0] == '#' || (keyword = next_word(&s)) == NULL)
+            continue;
+
+        if(!strcmp(keyword, "header")) {
+            struct header *header;
+
+            if(num_headers >= MAX_HEADERS)
+                fatal("too many headers");
+
+            header = &headers[num_headers++];
+            memset(header, 0, sizeof(struct header));
+            header->file = need_word(&s, "header file name");
+            header->guard = need_word(&s, "include guard");
+            header->desc = copy_string(rest_of_line(s), strlen(rest_of_line(s)));
+        }
+        else if(!strcmp(keyword, "include")) {
+            struct header *header;
+
+            if(num_headers == 0)
+                fatal("include outside of a header");
+            if(num_blocks > 0 && blocks[num_blocks - 1].header == num_headers - 1)
+                fatal("include after the first block");
+
+            header = &headers[num_headers - 1];
+            if(header->num_includes >= MAX_INCLUDE)
+                fatal("too many includes");
+            header->includes[header->num_includes++] = need_word(&s, "include path");
+        }
+        else if(!strcmp(keyword, "feature") || !strcmp(keyword, "extension")) {
+            struct block *block;
+
+            if(num_headers == 0)
+                fatal("%s outside of a header", keyword);
+            if(num_blocks >= MAX_BLOCKS)
+                fatal("too many blocks");
+
+            block = &blocks[num_blocks++];
+            memset(block, 0, sizeof(struct block));
+            block->name = need_word(&s, "block name");
+            block->header = num_headers - 1;
+            block->extension = !strcmp(keyword, "extension");
+            block->selected = 1;
+
+            /* Extensions without functions don't belong
+             * to a group, they only get a presence bit */
+            if(block->extension)
+                block->group = next_word(&s);
+            else block->group = need_word(&s, "block group");
+
+            if(block->extension) {
+                if(num_bits >= MAX_BITS)
+                    fatal("too many extensions");
+                block->bit = num_bits++;
+
+                block->desc = malloc(strlen(block->name) + 12);
+                if(block->desc == NULL)
+                    fatal("out of memory");
+                sprintf(block->desc, "Extension: %s", block->name);
+            }
+            else {
+                block->desc = copy_string(rest_of_line(s), strlen(rest_of_line(s)));
+            }
+        }
+        else if(!strcmp(keyword, "text")) {
+            entry = add_entry(ENTRY_TEXT);
+            if(*s != 0)
+                ++s;
+            entry->name = copy_string(s, strlen(s));
+        }
+        else if(!strcmp(keyword, "enum")) {
+            entry = add_entry(ENTRY_ENUM);
+            entry->name = need_word(&s, "enum name");
+            entry->value = copy_string(rest_of_line(s), strlen(rest_of_line(s)));
+            if(entry->block < 0)
+                fatal("enum outside of a block");
+        }
+        else if(!strcmp(keyword, "command")) {
+            entry = add_entry(ENTRY_COMMAND);
+            parse_command(entry, rest_of_line(s));
+            if(entry->block < 0)
+                fatal("command outside of a block");
+            if(blocks[entry->block].group == NULL)
+                fatal("command of %s which has no group", blocks[entry->block].name);
+        }
+        else {
+            fatal("unknown entry '%s'", keyword);
+        }
+
+        free(keyword);
+    }
+
+    fclose(fp);
+    registry_line = 0;
+}
+
+/**
+ * Applies the -e option; extensions not mentioned
+ * in the list are left out of the generated sources
+ * @param list      Comma-separated extension names, all or none
+ */
+static void select_extensions(const char *list)
+{
+    const char *s;
+    int i;
+
+    if(!strcmp(list, "all"))
+        return;
+
+    for(i = 0; i < num_blocks; ++i)
+        blocks[i].selected = !blocks[i].extension;
+
+    if(!strcmp(list, "none"))
+        return;
+
+    for(s = list; *s; s += (*s == ',')) {
+        const char *end;
+
+        for(end = s; *end && *end != ','; ++end);
+
+        for(i = 0; i < num_blocks; ++i) {
+            if(strlen(blocks[i].name) == (size_t)(end - s) && !strncmp(blocks[i].name, s, end - s)) {
+                if(!blocks[i].extension)
+                    fatal("%s is not an extension", blocks[i].name);
+                blocks[i].selected = 1;
+                break;
+            }
+        }
+
+        if(i >= num_blocks)
+            fatal("unknown extension '%.*s'", (int)(end - s), s);
+        s = end;
+    }
+}
+
+static int compare_names(const void *a, const void *b)
+{
+    const char *sa = entries[*(const int *)a].name;
+    const char *sb = entries[*(const int *)b].name;
+    size_t i;
+
+    for(i = 0; sa[i] && to_lower(sa[i]) == to_lower(sb[i]); ++i);
+    if(to_lower(sa[i]) != to_lower(sb[i]))
+        return to_lower(sa[i]) - to_lower(sb[i]);
+    return strcmp(sa, sb);
+}
+
+static int compare_strings(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+/**
+ * Collects the commands of a block sorted by name
+ * @param block     Block index
+ * @param result    Array of at least MAX_ENTRIES indices
+ * @returns         Number of commands
+ */
+static int block_commands(int block, int *result)
+{
+    int count = 0;
+    int i;
+
+    for(i = 0; i < num_entries; ++i) {
+        if(entries[i].kind == ENTRY_COMMAND && entries[i].block == block)
+            result[count++] = i;
+        continue;
+    }
+
+    qsort(result, count, sizeof(int), &compare_names);
+    return count;
+}
+
+static int max_name_length(const int *list, int count)
+{
+    int width = 0;
+    int i;
+
+    for(i = 0; i < count; ++i) {
+        int length = (int)strlen(entries[list[i]].name);
+        if(length > width)
+            width = length;
+        continue;
+    }
+
+    return width;
+}
+
+static const char *apientry(const struct entry *entry)
+{
+    if(!strncmp(entry->name, "alc", 3))
+        return "ALC_APIENTRY";
+    return "AL_APIENTRY";
+}
+
+static const char *ret_space(const struct entry *entry)
+{
+    size_t length = strlen(entry->value);
+    return (length > 0 && entry->value[length - 1] == '*') ? "" : " ";
+}
+
+static int is_void(const struct entry *entry)
+{
+    return !strcmp(entry->value, "void");
+}
+
+static void lower_name(char *out, const char *name)
+{
+    while(*name)
+        *out++ = (char)to_lower(*name++);
+    *out = 0;
+}
+
+static void write_file_header(FILE *fp, const char *file, const char *desc)
+{
+    int i;
+
+    fprintf(fp, "/*\n * %s - %s\n * %s\n", file, desc, COPYRIGHT);
+    for(i = 0; license_text[i]; ++i)
+        fprintf(fp, "%s\n", license_text[i]);
+    fprintf(fp, " */\n%s\n", NOTICE);
+}
+
+static FILE *open_output(const char *outdir, const char *path)
+{
+    char filename[MAX_LINE];
+    FILE *fp;
+
+    if(strlen(outdir) + strlen(path) + 2 > sizeof(filename))
+        fatal("%s/%s: path is too long", outdir, path);
+    strcpy(filename, outdir);
+    strcat(filename, "/");
+    strcat(filename, path);
+
+    if((fp = fopen(filename, "w")) == NULL)
+        fatal("%s: unable to open for writing", filename);
+    return fp;
+}
+
+static void close_output(FILE *fp)
+{
+    if(ferror(fp) || fclose(fp) != 0)
+        fatal("write error");
+}
+
+/**
+ * Pads a column so that whatever follows it starts
+ * at the next multiple of four, the way the headers
+ * have always been aligned by hand
+ * @param prefix    Length of the text before the column
+ * @param width     Length of the longest name in the column
+ * @returns         Column width
+ */
+static int tab_width(int prefix, int width)
+{
+    return ((prefix + width + 4) & ~3) - prefix;
+}
+
+/**
+ * Computes the name column width for a run of enums;
+ * blank lines split a run into groups that still share
+ * the column while any other text line ends the run
+ * @param first     Index of the first enum in the run
+ * @returns         Column width
+ */
+static int enum_width(int first)
+{
+    int width = 0;
+    int i;
+
+    for(i = first; i < num_entries && entries[i].block == entries[first].block; ++i) {
+        if(entries[i].kind == ENTRY_TEXT && entries[i].name[0] != 0)
+            break;
+        if(entries[i].kind == ENTRY_ENUM && (int)strlen(entries[i].name) > width)
+            width = (int)strlen(entries[i].name);
+    }
+
+    return tab_width(8, width);
+}
+
+static void write_block(FILE *fp, int block)
+{
+    static int list[MAX_ENTRIES];
+    static char *typedefs[MAX_ENTRIES];
+    int count = block_commands(block, list);
+    int width = 0;
+    int i;
+
+    fputc('\n', fp);
+
+    if(blocks[block].extension) {
+        fprintf(fp, "#define %s 1\n", blocks[block].name);
+        fprintf(fp, "#define SALAD_%s 0x%08XU\n", blocks[block].name, 1U << blocks[block].bit);
+
+        /* Keep the extension macro apart from its enums */
+        for(i = 0; i < num_entries && entries[i].block != block; ++i);
+        if(i < num_entries && entries[i].kind == ENTRY_ENUM)
+            fputc('\n', fp);
+    }
+
+    for(i = 0; i < num_entries; ++i) {
+        if(entries[i].block != block)
+            continue;
+
+        if(entries[i].kind == ENTRY_TEXT) {
+            fprintf(fp, "%s\n", entries[i].name);
+            if(entries[i].name[0] != 0)
+                width = 0;
+        }
+        else if(entries[i].kind == ENTRY_ENUM) {
+            if(width == 0)
+                width = enum_width(i);
+            fprintf(fp, "#define %-*s%s\n", width, entries[i].name, entries[i].value);
+        }
+    }
+
+    if(count == 0)
+        return;
+
+    for(i = 0; i < count; ++i) {
+        const struct entry *entry = &entries[list[i]];
+        char line[MAX_LINE * 2];
+        sprintf(line, "typedef %s(%s *PFN_%s)(%s);", entry->value, apientry(entry), entry->name, entry->params);
+        typedefs[i] = copy_string(line, strlen(line));
+    }
+
+    qsort(typedefs, count, sizeof(char *), &compare_strings);
+
+    fputc('\n', fp);
+    for(i = 0; i < count; ++i) {
+        fprintf(fp, "%s\n", typedefs[i]);
+        free(typedefs[i]);
+    }
+
+    width = max_name_length(list, count);
+
+    fputs("\n#if defined(SALAD_DIRECT_LINK)\n", fp);
+    for(i = 0; i < count; ++i) {
+        const struct entry *entry = &entries[list[i]];
+        fprintf(fp, "SALAD_EXTERN %s%s%s %s(%s);\n", entry->value, ret_space(entry), apientry(entry), entry->name, entry->params);
+    }
+
+    fputs("#else\n", fp);
+    for(i = 0; i < count; ++i)
+        fprintf(fp, "SALAD_EXTERN PFN_%-*sSALAD_%s;\n", tab_width(17, width), entries[list[i]].name, entries[list[i]].name);
+
+    fputc('\n', fp);
+    for(i = 0; i < count; ++i)
+        fprintf(fp, "#define %-*sSALAD_%s\n", tab_width(8, width), entries[list[i]].name, entries[list[i]].name);
+    fputs("#endif /* SALAD_DIRECT_LINK */\n", fp);
+}
+
+static void write_header(const char *outdir, int header)
+{
+    const struct header *h = &headers[header];
+    char path[MAX_LINE];
+    FILE *fp;
+    int i;
+
+    sprintf(path, "include/AL/%.*s", MAX_LINE - 16, h->file);
+    fp = open_output(outdir, path);
+
+    write_file_header(fp, h->file, h->desc);
+    fprintf(fp, "#ifndef %s\n#define %s 1\n", h->guard, h->guard);
+    for(i = 0; i < h->num_includes; ++i)
+        fprintf(fp, "#include <%s>\n", h->includes[i]);
+
+    for(i = 0; i < num_entries; ++i) {
+        if(entries[i].header != header || entries[i].block >= 0)
+            continue;
+        fprintf(fp, "%s%s\n", (i == 0 || entries[i - 1].header != header) ? "\n" : "", entries[i].name);
+    }
+
+    for(i = 0; i < num_blocks; ++i) {
+        if(blocks[i].header == header && blocks[i].selected)
+            write_block(fp, i);
+        continue;
+    }
+
+    fprintf(fp, "\n#endif /* %s */\n", h->guard);
+    close_output(fp);
+}
+
+static void write_table(const char *outdir)
+{
+    static int list[MAX_ENTRIES];
+    FILE *fp = open_output(outdir, "include/AL/salad_table.h");
+    int first = 1;
+    int count;
+    int width;
+    int i, j;
+
+    write_file_header(fp, "salad_table.h", "Per-instance OpenAL function tables");
+    fputs("#ifndef AL_SALAD_TABLE_H\n#define AL_SALAD_TABLE_H 1\n", fp);
+    for(i = 0; i < num_headers; ++i)
+        fprintf(fp, "#include <AL/%s>\n", headers[i].file);
+    fputs("#include <AL/salad.h>\n\n", fp);
+
+    fputs("/**\n", fp);
+    fputs(" * A complete set of OpenAL function pointers resolved from\n", fp);
+    fputs(" * a single implementation; unlike the global SALAD_* pointers\n", fp);
+    fputs(" * any number of tables can be loaded side by side, one per driver,\n", fp);
+    fputs(" * and called through directly: table.alSourcef(source, AL_GAIN, 1.0f)\n", fp);
+    fputs(" */\n", fp);
+    fputs("struct SALAD_table {\n", fp);
+
+    for(i = 0; i < num_blocks; ++i) {
+        if(!blocks[i].selected || (count = block_commands(i, list)) == 0)
+            continue;
+
+        width = max_name_length(list, count);
+
+        fprintf(fp, "%s    /* %s <AL/%s> */\n", first ? "" : "\n", blocks[i].desc, headers[blocks[i].header].file);
+        for(j = 0; j < count; ++j)
+            fprintf(fp, "    PFN_%-*s %s;\n", width, entries[list[j]].name, entries[list[j]].name);
+        first = 0;
+    }
+
+    fputs("};\n\n#endif /* AL_SALAD_TABLE_H */\n", fp);
+    close_output(fp);
+}
+
+static void write_resolver(FILE *fp, int block)
+{
+    static int list[MAX_ENTRIES];
+    const struct block *b = &blocks[block];
+    int count = block_commands(block, list);
+    int width = max_name_length(list, count);
+    char name[MAX_LINE];
+    int i;
+
+    lower_name(name, b->name);
+
+    fputs("/**\n", fp);
+    if(b->extension)
+        fprintf(fp, " * Resolves %s extension functions <AL/%s>\n", b->name, headers[b->header].file);
+    else fprintf(fp, " * Resolves %c%s <AL/%s>\n", to_lower(b->desc[0]), b->desc + 1, headers[b->header].file);
+    fputs(" * @param table     Function table to fill\n", fp);
+    fputs(" * @param loadfunc  Load function\n", fp);
+    fputs(" * @param arg       Optional argument for the function\n", fp);
+    fputs(" * @returns         Non-zero if every function was resolved\n", fp);
+    fputs(" */\n", fp);
+
+    fprintf(fp, "static int resolve_%s(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg)\n{\n", name);
+    fputs("    int missing = 0;\n\n", fp);
+    for(i = 0; i < count; ++i) {
+        const char *fn = entries[list[i]].name;
+        fprintf(fp, "    SALAD_RESOLVE(table->%s,%*s loadfunc(\"%s\",%*s arg));\n", fn, width - (int)strlen(fn), "", fn, width - (int)strlen(fn), "");
+    }
+    fprintf(fp, "\n    if(missing != 0)\n        SALAD_DISCARD(table, %s, %s);\n", entries[list[0]].name, entries[list[count - 1]].name);
+    fputs("    return missing == 0;\n}\n\n", fp);
+}
+
+static void write_group(FILE *fp, const char *group)
+{
+    for(fputs("SALAD_GROUP_", fp); *group; ++group)
+        fputc((*group >= 'a' && *group <= 'z') ? (*group - 'a' + 'A') : *group, fp);
+}
+
+static void write_trampoline(FILE *fp, const struct entry *entry)
+{
+    fprintf(fp, "static %s%s%s lazy_%s(%s)\n{\n", entry->value, ret_space(entry), apientry(entry), entry->name, entry->params);
+    fprintf(fp, "    PFN_%s proc;\n", entry->name);
+    fprintf(fp, "    SALAD_LAZY_RESOLVE(proc, %s);\n", entry->name);
+    if(is_void(entry))
+        fprintf(fp, "    if(proc != NULL)\n        proc(%s);\n", entry->args);
+    else fprintf(fp, "    return (proc != NULL) ? proc(%s) : 0;\n", entry->args);
+    fputs("}\n\n", fp);
+}
+
+static void write_functions(const char *outdir)
+{
+    static int list[MAX_ENTRIES];
+    FILE *fp = open_output(outdir, "src/salad_functions.c");
+    char name[MAX_LINE];
+    int first;
+    int count;
+    int width;
+    int i, j;
+
+    write_file_header(fp, "salad_functions.c", "Generated OpenAL function lists");
+    fputs("#include <AL/salad.h>\n#include <stddef.h>\n#include <string.h>\n\n#include <AL/salad_table.h>\n\n", fp);
+    fputs("#include \"salad_functions.h\"\n#include \"salad_platform.h\"\n\n", fp);
+
+    fputs("#define SALAD_RESOLVE(pointer, value) if(((pointer) = (value)) == NULL) ++missing; else ((void)(0))\n\n", fp);
+
+    fputs("#if SALAD_PARANOID\n", fp);
+    fputs("/* Functions of a block that didn't resolve completely\n", fp);
+    fputs(" * are all reset to NULL so that no feature or extension is\n", fp);
+    fputs(" * ever left half-loaded; table members of a block are adjacent */\n", fp);
+    fputs("#define SALAD_DISCARD(table, first, last) discard_range((table), offsetof(SALAD_table_type, first), ", fp);
+    fputs("offsetof(SALAD_table_type, last) + sizeof((table)->last))\n\n", fp);
+    fputs("static void discard_range(SALAD_table_type *table, size_t begin, size_t end)\n{\n", fp);
+    fputs("    static const SALAD_table_type null_table;\n", fp);
+    fputs("    memcpy((char *)table + begin, (const char *)&null_table + begin, end - begin);\n}\n", fp);
+    fputs("#else\n", fp);
+    fputs("#define SALAD_DISCARD(table, first, last) ((void)(0))\n", fp);
+    fputs("#endif\n\n", fp);
+
+    fputs("/* The global pointer is only patched while it still points at\n", fp);
+    fputs(" * the trampoline, so a wrapper installed over it after the lazy\n", fp);
+    fputs(" * load or a pointer another thread published stays in place */\n", fp);
+    fputs("#define SALAD_LAZY_RESOLVE(proc, name) if(((proc) = (PFN_##name)salad_lazy_resolve(#name)) != NULL) ", fp);
+    fputs("(void)salad_atomic_cas_ptr(&SALAD_##name, &lazy_##name, (proc)); else ((void)(0))\n\n", fp);
+
+    for(i = 0; i < num_blocks; ++i) {
+        if(blocks[i].selected && block_commands(i, list) != 0)
+            write_resolver(fp, i);
+        continue;
+    }
+
+    fputs("unsigned int salad_resolve_groups(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg, unsigned int groups)\n{\n", fp);
+    fputs("    unsigned int loaded = 0;\n    unsigned int failed = 0;\n", fp);
+    for(i = 0; i < num_blocks; ++i) {
+        if(!blocks[i].selected || block_commands(i, list) == 0)
+            continue;
+        lower_name(name, blocks[i].name);
+        fputs("\n    if((groups & ", fp);
+        write_group(fp, blocks[i].group);
+        fputs(") != 0) {\n        loaded |= ", fp);
+        write_group(fp, blocks[i].group);
+        fprintf(fp, ";\n        if(!resolve_%s(table, loadfunc, arg))\n            failed |= ", name);
+        write_group(fp, blocks[i].group);
+        fputs(";\n    }\n", fp);
+    }
+    fputs("\n    return loaded & ~failed;\n}\n\n", fp);
+
+    fputs("/* Every extension a presence bit is kept for */\n", fp);
+    fputs("const struct salad_extension salad_extension_list[] = {\n", fp);
+    for(width = 0, i = 0; i < num_blocks; ++i) {
+        if(blocks[i].extension && blocks[i].selected && (int)strlen(blocks[i].name) > width)
+            width = (int)strlen(blocks[i].name);
+        continue;
+    }
+    for(i = 0; i < num_blocks; ++i) {
+        const char *ext = blocks[i].name;
+        if(!blocks[i].extension || !blocks[i].selected)
+            continue;
+        fprintf(fp, "    { \"%s\",%*s SALAD_%s%*s },\n", ext, width - (int)strlen(ext), "", ext, width - (int)strlen(ext), "");
+    }
+    fputs("    { NULL, 0 }\n};\n\n", fp);
+
+    fputs("#if !defined(SALAD_DIRECT_LINK)\n\n", fp);
+
+    for(i = 0; i < num_blocks; ++i) {
+        if(!blocks[i].selected || (count = block_commands(i, list)) == 0)
+            continue;
+        width = max_name_length(list, count);
+        fprintf(fp, "/* %s <AL/%s> */\n", blocks[i].desc, headers[blocks[i].header].file);
+        for(j = 0; j < count; ++j) {
+            const char *fn = entries[list[j]].name;
+            fprintf(fp, "PFN_%-*s SALAD_%-*s = NULL;\n", width, fn, width, fn);
+        }
+        fputc('\n', fp);
+    }
+
+    fputs("void salad_publish_table(const SALAD_table_type *table, unsigned int groups)\n{\n", fp);
+    for(first = 1, i = 0; i < num_blocks; ++i) {
+        if(!blocks[i].selected || (count = block_commands(i, list)) == 0)
+            continue;
+        width = max_name_length(list, count);
+        fputs(first ? "    if((groups & " : "\n    if((groups & ", fp);
+        write_group(fp, blocks[i].group);
+        fputs(") != 0) {\n", fp);
+        for(j = 0; j < count; ++j) {
+            const char *fn = entries[list[j]].name;
+            fprintf(fp, "        salad_atomic_store_ptr(&SALAD_%s,%*s table->%s);\n", fn, width - (int)strlen(fn), "", fn);
+        }
+        fputs("    }\n", fp);
+        first = 0;
+    }
+    fputs("}\n\n", fp);
+
+    fputs("/* Lazily resolving trampolines for every feature\n", fp);
+    fputs(" * function; each one resolves its function on the first call,\n", fp);
+    fputs(" * patches the global SALAD_* pointer and forwards the call */\n", fp);
+    for(i = 0; i < num_blocks; ++i) {
+        if(blocks[i].extension || !blocks[i].selected)
+            continue;
+        count = block_commands(i, list);
+        for(j = 0; j < count; ++j)
+            write_trampoline(fp, &entries[list[j]]);
+    }
+
+    fputs("void salad_install_trampolines(SALAD_table_type *table, unsigned int groups)\n{\n", fp);
+    for(first = 1, i = 0; i < num_blocks; ++i) {
+        if(blocks[i].extension || !blocks[i].selected || (count = block_commands(i, list)) == 0)
+            continue;
+        width = max_name_length(list, count);
+        fputs(first ? "    if((groups & " : "\n    if((groups & ", fp);
+        write_group(fp, blocks[i].group);
+        fputs(") != 0) {\n", fp);
+        for(j = 0; j < count; ++j)
+            fprintf(fp, "        table->%-*s = &lazy_%s;\n", width, entries[list[j]].name, entries[list[j]].name);
+        fputs("    }\n", fp);
+        first = 0;
+    }
+    fputs("}\n\n#endif /* SALAD_DIRECT_LINK */\n", fp);
+    close_output(fp);
+}
+
+static void usage(void)
+{
+    fputs("usage: salad_gen [-e all|none|EXT[,EXT...]] <registry> <outdir>\n", stderr);
+    fputs("writes include/AL/*.h and src/salad_functions.c into outdir\n", stderr);
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    const char *extensions = "all";
+    int i;
+
+    for(i = 1; i < argc && argv[i][0] == '-'; ++i) {
+        if(!strcmp(argv[i], "-e") && i + 1 < argc)
+            extensions = argv[++i];
+        else usage();
+    }
+
+    if(argc - i != 2)
+        usage();
+
+    parse_registry(argv[i]);
+    select_extensions(extensions);
+
+    for(i = 0; i < num_headers; ++i)
+        write_header(argv[argc - 1], i);
+    write_table(argv[argc - 1]);
+    write_functions(argv[argc - 1]);
+
+    return 0;
+}
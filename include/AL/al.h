@@ -1,6 +1,6 @@
 /*
  * al.h - Core OpenAL functions
- * Copyright (C) 2021-2025, Kirill Dmitrievich
+ * Copyright (C) 2021-2026, Kirill Dmitrievich
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -23,6 +23,7 @@
  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
+/* Generated by salad_gen from gen/salad.reg, do not edit */
 #ifndef AL_AL_H
 #define AL_AL_H 1
 #include <AL/salad.h>
@@ -48,10 +49,10 @@ typedef salad_uint8_type    ALchar;
 typedef salad_uint8_type    ALubyte;
 typedef void                ALvoid;
 
-#define AL_INVALID  (0xFFFFFFFF)
-#define AL_NONE     (0x0000)
-#define AL_FALSE    (0x0000)
-#define AL_TRUE     (0x0001)
+#define AL_INVALID                      (0xFFFFFFFF)
+#define AL_NONE                         (0x0000)
+#define AL_FALSE                        (0x0000)
+#define AL_TRUE                         (0x0001)
 
 #define AL_BITS                         (0x2002)
 #define AL_BUFFER                       (0x1009)
@@ -128,6 +129,7 @@ typedef ALenum(AL_APIENTRY *PFN_alGetError)(void);
 typedef ALfloat(AL_APIENTRY *PFN_alGetFloat)(ALenum param);
 typedef ALint(AL_APIENTRY *PFN_alGetInteger)(ALenum param);
 typedef const ALchar *(AL_APIENTRY *PFN_alGetString)(ALenum param);
+typedef void *(AL_APIENTRY *PFN_alGetProcAddress)(const ALchar *fname);
 typedef void(AL_APIENTRY *PFN_alBuffer3f)(ALuint buffer, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3);
 typedef void(AL_APIENTRY *PFN_alBuffer3i)(ALuint buffer, ALenum param, ALint value1, ALint value2, ALint value3);
 typedef void(AL_APIENTRY *PFN_alBufferData)(ALuint buffer, ALenum format, const ALvoid *data, ALsizei size, ALsizei freq);
@@ -161,8 +163,8 @@ typedef void(AL_APIENTRY *PFN_alGetSource3f)(ALuint source, ALenum param, ALfloa
 typedef void(AL_APIENTRY *PFN_alGetSource3i)(ALuint source, ALenum param, ALint *value1, ALint *value2, ALint *value3);
 typedef void(AL_APIENTRY *PFN_alGetSourcef)(ALuint source, ALenum param, ALfloat *value);
 typedef void(AL_APIENTRY *PFN_alGetSourcefv)(ALuint source, ALenum param, ALfloat *values);
-typedef void(AL_APIENTRY *PFN_alGetSourcei)(ALuint source,  ALenum param, ALint *value);
-typedef void(AL_APIENTRY *PFN_alGetSourceiv)(ALuint source,  ALenum param, ALint *values);
+typedef void(AL_APIENTRY *PFN_alGetSourcei)(ALuint source, ALenum param, ALint *value);
+typedef void(AL_APIENTRY *PFN_alGetSourceiv)(ALuint source, ALenum param, ALint *values);
 typedef void(AL_APIENTRY *PFN_alListener3f)(ALenum param, ALfloat value1, ALfloat value2, ALfloat value3);
 typedef void(AL_APIENTRY *PFN_alListener3i)(ALenum param, ALint value1, ALint value2, ALint value3);
 typedef void(AL_APIENTRY *PFN_alListenerf)(ALenum param, ALfloat value);
@@ -171,10 +173,6 @@ typedef void(AL_APIENTRY *PFN_alListeneri)(ALenum param, ALint value);
 typedef void(AL_APIENTRY *PFN_alListeneriv)(ALenum param, const ALint *values);
 typedef void(AL_APIENTRY *PFN_alSource3f)(ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3);
 typedef void(AL_APIENTRY *PFN_alSource3i)(ALuint source, ALenum param, ALint value1, ALint value2, ALint value3);
-typedef void(AL_APIENTRY *PFN_alSourcef)(ALuint source, ALenum param, ALfloat value);
-typedef void(AL_APIENTRY *PFN_alSourcefv)(ALuint source, ALenum param, const ALfloat *values);
-typedef void(AL_APIENTRY *PFN_alSourcei)(ALuint source, ALenum param, ALint value);
-typedef void(AL_APIENTRY *PFN_alSourceiv)(ALuint source, ALenum param, const ALint *values);
 typedef void(AL_APIENTRY *PFN_alSourcePause)(ALuint source);
 typedef void(AL_APIENTRY *PFN_alSourcePausev)(ALsizei n, const ALuint *sources);
 typedef void(AL_APIENTRY *PFN_alSourcePlay)(ALuint source);
@@ -185,8 +183,82 @@ typedef void(AL_APIENTRY *PFN_alSourceRewindv)(ALsizei n, const ALuint *sources)
 typedef void(AL_APIENTRY *PFN_alSourceStop)(ALuint source);
 typedef void(AL_APIENTRY *PFN_alSourceStopv)(ALsizei n, const ALuint *sources);
 typedef void(AL_APIENTRY *PFN_alSourceUnqueueBuffers)(ALuint source, ALsizei nb, ALuint *buffers);
-typedef void*(AL_APIENTRY *PFN_alGetProcAddress)(const ALchar *fname);
+typedef void(AL_APIENTRY *PFN_alSourcef)(ALuint source, ALenum param, ALfloat value);
+typedef void(AL_APIENTRY *PFN_alSourcefv)(ALuint source, ALenum param, const ALfloat *values);
+typedef void(AL_APIENTRY *PFN_alSourcei)(ALuint source, ALenum param, ALint value);
+typedef void(AL_APIENTRY *PFN_alSourceiv)(ALuint source, ALenum param, const ALint *values);
 
+#if defined(SALAD_DIRECT_LINK)
+SALAD_EXTERN void AL_APIENTRY alBuffer3f(ALuint buffer, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3);
+SALAD_EXTERN void AL_APIENTRY alBuffer3i(ALuint buffer, ALenum param, ALint value1, ALint value2, ALint value3);
+SALAD_EXTERN void AL_APIENTRY alBufferData(ALuint buffer, ALenum format, const ALvoid *data, ALsizei size, ALsizei freq);
+SALAD_EXTERN void AL_APIENTRY alBufferf(ALuint buffer, ALenum param, ALfloat value);
+SALAD_EXTERN void AL_APIENTRY alBufferfv(ALuint buffer, ALenum param, const ALfloat *values);
+SALAD_EXTERN void AL_APIENTRY alBufferi(ALuint buffer, ALenum param, ALint value);
+SALAD_EXTERN void AL_APIENTRY alBufferiv(ALuint buffer, ALenum param, const ALint *values);
+SALAD_EXTERN void AL_APIENTRY alDeleteBuffers(ALsizei n, const ALuint *buffers);
+SALAD_EXTERN void AL_APIENTRY alDeleteSources(ALsizei n, const ALuint *sources);
+SALAD_EXTERN void AL_APIENTRY alDisable(ALenum capability);
+SALAD_EXTERN void AL_APIENTRY alEnable(ALenum capability);
+SALAD_EXTERN void AL_APIENTRY alGenBuffers(ALsizei n, ALuint *buffers);
+SALAD_EXTERN void AL_APIENTRY alGenSources(ALsizei n, ALuint *sources);
+SALAD_EXTERN ALboolean AL_APIENTRY alGetBoolean(ALenum param);
+SALAD_EXTERN void AL_APIENTRY alGetBooleanv(ALenum param, ALboolean *values);
+SALAD_EXTERN void AL_APIENTRY alGetBuffer3f(ALuint buffer, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3);
+SALAD_EXTERN void AL_APIENTRY alGetBuffer3i(ALuint buffer, ALenum param, ALint *value1, ALint *value2, ALint *value3);
+SALAD_EXTERN void AL_APIENTRY alGetBufferf(ALuint buffer, ALenum param, ALfloat *value);
+SALAD_EXTERN void AL_APIENTRY alGetBufferfv(ALuint buffer, ALenum param, ALfloat *values);
+SALAD_EXTERN void AL_APIENTRY alGetBufferi(ALuint buffer, ALenum param, ALint *value);
+SALAD_EXTERN void AL_APIENTRY alGetBufferiv(ALuint buffer, ALenum param, ALint *values);
+SALAD_EXTERN ALdouble AL_APIENTRY alGetDouble(ALenum param);
+SALAD_EXTERN void AL_APIENTRY alGetDoublev(ALenum param, ALdouble *values);
+SALAD_EXTERN ALenum AL_APIENTRY alGetEnumValue(const ALchar *ename);
+SALAD_EXTERN ALenum AL_APIENTRY alGetError(void);
+SALAD_EXTERN ALfloat AL_APIENTRY alGetFloat(ALenum param);
+SALAD_EXTERN void AL_APIENTRY alGetFloatv(ALenum param, ALfloat *values);
+SALAD_EXTERN ALint AL_APIENTRY alGetInteger(ALenum param);
+SALAD_EXTERN void AL_APIENTRY alGetIntegerv(ALenum param, ALint *values);
+SALAD_EXTERN void AL_APIENTRY alGetListener3f(ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3);
+SALAD_EXTERN void AL_APIENTRY alGetListener3i(ALenum param, ALint *value1, ALint *value2, ALint *value3);
+SALAD_EXTERN void AL_APIENTRY alGetListenerf(ALenum param, ALfloat *value);
+SALAD_EXTERN void AL_APIENTRY alGetListenerfv(ALenum param, ALfloat *values);
+SALAD_EXTERN void AL_APIENTRY alGetListeneri(ALenum param, ALint *value);
+SALAD_EXTERN void AL_APIENTRY alGetListeneriv(ALenum param, ALint *values);
+SALAD_EXTERN void *AL_APIENTRY alGetProcAddress(const ALchar *fname);
+SALAD_EXTERN void AL_APIENTRY alGetSource3f(ALuint source, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3);
+SALAD_EXTERN void AL_APIENTRY alGetSource3i(ALuint source, ALenum param, ALint *value1, ALint *value2, ALint *value3);
+SALAD_EXTERN void AL_APIENTRY alGetSourcef(ALuint source, ALenum param, ALfloat *value);
+SALAD_EXTERN void AL_APIENTRY alGetSourcefv(ALuint source, ALenum param, ALfloat *values);
+SALAD_EXTERN void AL_APIENTRY alGetSourcei(ALuint source, ALenum param, ALint *value);
+SALAD_EXTERN void AL_APIENTRY alGetSourceiv(ALuint source, ALenum param, ALint *values);
+SALAD_EXTERN const ALchar *AL_APIENTRY alGetString(ALenum param);
+SALAD_EXTERN ALboolean AL_APIENTRY alIsBuffer(ALuint buffer);
+SALAD_EXTERN ALboolean AL_APIENTRY alIsEnabled(ALenum capability);
+SALAD_EXTERN ALboolean AL_APIENTRY alIsExtensionPresent(const ALchar *extname);
+SALAD_EXTERN ALboolean AL_APIENTRY alIsSource(ALuint source);
+SALAD_EXTERN void AL_APIENTRY alListener3f(ALenum param, ALfloat value1, ALfloat value2, ALfloat value3);
+SALAD_EXTERN void AL_APIENTRY alListener3i(ALenum param, ALint value1, ALint value2, ALint value3);
+SALAD_EXTERN void AL_APIENTRY alListenerf(ALenum param, ALfloat value);
+SALAD_EXTERN void AL_APIENTRY alListenerfv(ALenum param, const ALfloat *values);
+SALAD_EXTERN void AL_APIENTRY alListeneri(ALenum param, ALint value);
+SALAD_EXTERN void AL_APIENTRY alListeneriv(ALenum param, const ALint *values);
+SALAD_EXTERN void AL_APIENTRY alSource3f(ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3);
+SALAD_EXTERN void AL_APIENTRY alSource3i(ALuint source, ALenum param, ALint value1, ALint value2, ALint value3);
+SALAD_EXTERN void AL_APIENTRY alSourcef(ALuint source, ALenum param, ALfloat value);
+SALAD_EXTERN void AL_APIENTRY alSourcefv(ALuint source, ALenum param, const ALfloat *values);
+SALAD_EXTERN void AL_APIENTRY alSourcei(ALuint source, ALenum param, ALint value);
+SALAD_EXTERN void AL_APIENTRY alSourceiv(ALuint source, ALenum param, const ALint *values);
+SALAD_EXTERN void AL_APIENTRY alSourcePause(ALuint source);
+SALAD_EXTERN void AL_APIENTRY alSourcePausev(ALsizei n, const ALuint *sources);
+SALAD_EXTERN void AL_APIENTRY alSourcePlay(ALuint source);
+SALAD_EXTERN void AL_APIENTRY alSourcePlayv(ALsizei n, const ALuint *sources);
+SALAD_EXTERN void AL_APIENTRY alSourceQueueBuffers(ALuint source, ALsizei nb, const ALuint *buffers);
+SALAD_EXTERN void AL_APIENTRY alSourceRewind(ALuint source);
+SALAD_EXTERN void AL_APIENTRY alSourceRewindv(ALsizei n, const ALuint *sources);
+SALAD_EXTERN void AL_APIENTRY alSourceStop(ALuint source);
+SALAD_EXTERN void AL_APIENTRY alSourceStopv(ALsizei n, const ALuint *sources);
+SALAD_EXTERN void AL_APIENTRY alSourceUnqueueBuffers(ALuint source, ALsizei nb, ALuint *buffers);
+#else
 SALAD_EXTERN PFN_alBuffer3f             SALAD_alBuffer3f;
 SALAD_EXTERN PFN_alBuffer3i             SALAD_alBuffer3i;
 SALAD_EXTERN PFN_alBufferData           SALAD_alBufferData;
@@ -326,5 +398,6 @@ SALAD_EXTERN PFN_alSourceUnqueueBuffers SALAD_alSourceUnqueueBuffers;
 #define alSourceStop            SALAD_alSourceStop
 #define alSourceStopv           SALAD_alSourceStopv
 #define alSourceUnqueueBuffers  SALAD_alSourceUnqueueBuffers
+#endif /* SALAD_DIRECT_LINK */
 
 #endif /* AL_AL_H */
@@ -1,6 +1,6 @@
 /*
  * alc.h - Context OpenAL functions
- * Copyright (C) 2021-2025, Kirill Dmtirievich
+ * Copyright (C) 2021-2026, Kirill Dmitrievich
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -23,6 +23,7 @@
  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
+/* Generated by salad_gen from gen/salad.reg, do not edit */
 #ifndef AL_ALC_H
 #define AL_ALC_H 1
 #include <AL/salad.h>
@@ -51,9 +52,9 @@ struct ALCcontext;
 typedef struct ALCdevice ALCdevice;
 typedef struct ALCcontext ALCcontext;
 
-#define ALC_INVALID (0x0000)
-#define ALC_FALSE   (0x0000)
-#define ALC_TRUE    (0x0001)
+#define ALC_INVALID                             (0x0000)
+#define ALC_FALSE                               (0x0000)
+#define ALC_TRUE                                (0x0001)
 
 #define ALC_ALL_ATTRIBUTES                      (0x1003)
 #define ALC_ALL_DEVICES_SPECIFIER               (0x1013)
@@ -81,32 +82,39 @@ typedef struct ALCcontext ALCcontext;
 #define ALC_STEREO_SOURCES                      (0x1011)
 #define ALC_SYNC                                (0x1009)
 
-typedef ALCboolean(ALC_APIENTRY *PFN_alcCaptureCloseDevice)(ALCdevice *device);
 typedef ALCboolean(ALC_APIENTRY *PFN_alcCloseDevice)(ALCdevice *device);
 typedef ALCboolean(ALC_APIENTRY *PFN_alcIsExtensionPresent)(ALCdevice *device, const ALCchar *extname);
 typedef ALCboolean(ALC_APIENTRY *PFN_alcMakeContextCurrent)(ALCcontext *context);
 typedef ALCcontext *(ALC_APIENTRY *PFN_alcCreateContext)(ALCdevice *device, const ALCint *attrlist);
 typedef ALCcontext *(ALC_APIENTRY *PFN_alcGetCurrentContext)(void);
-typedef ALCdevice *(ALC_APIENTRY *PFN_alcCaptureOpenDevice)(const ALCchar *devicename, ALCuint frequency, ALCenum format, ALCsizei buffersize);
 typedef ALCdevice *(ALC_APIENTRY *PFN_alcGetContextsDevice)(ALCcontext *context);
 typedef ALCdevice *(ALC_APIENTRY *PFN_alcOpenDevice)(const ALCchar *devicename);
 typedef ALCenum(ALC_APIENTRY *PFN_alcGetEnumValue)(ALCdevice *device, const ALCchar *enumname);
 typedef ALCenum(ALC_APIENTRY *PFN_alcGetError)(ALCdevice *device);
 typedef ALCvoid *(ALC_APIENTRY *PFN_alcGetProcAddress)(ALCdevice *device, const ALCchar *funcname);
 typedef const ALCchar *(ALC_APIENTRY *PFN_alcGetString)(ALCdevice *device, ALCenum param);
-typedef void(ALC_APIENTRY *PFN_alcCaptureSamples)(ALCdevice *device, ALCvoid *buffer, ALCsizei samples);
-typedef void(ALC_APIENTRY *PFN_alcCaptureStart)(ALCdevice *device);
-typedef void(ALC_APIENTRY *PFN_alcCaptureStop)(ALCdevice *device);
 typedef void(ALC_APIENTRY *PFN_alcDestroyContext)(ALCcontext *context);
 typedef void(ALC_APIENTRY *PFN_alcGetIntegerv)(ALCdevice *device, ALCenum param, ALCsizei size, ALCint *values);
 typedef void(ALC_APIENTRY *PFN_alcProcessContext)(ALCcontext *context);
 typedef void(ALC_APIENTRY *PFN_alcSuspendContext)(ALCcontext *context);
 
-SALAD_EXTERN PFN_alcCaptureCloseDevice  SALAD_alcCaptureCloseDevice;
-SALAD_EXTERN PFN_alcCaptureOpenDevice   SALAD_alcCaptureOpenDevice;
-SALAD_EXTERN PFN_alcCaptureSamples      SALAD_alcCaptureSamples;
-SALAD_EXTERN PFN_alcCaptureStart        SALAD_alcCaptureStart;
-SALAD_EXTERN PFN_alcCaptureStop         SALAD_alcCaptureStop;
+#if defined(SALAD_DIRECT_LINK)
+SALAD_EXTERN ALCboolean ALC_APIENTRY alcCloseDevice(ALCdevice *device);
+SALAD_EXTERN ALCcontext *ALC_APIENTRY alcCreateContext(ALCdevice *device, const ALCint *attrlist);
+SALAD_EXTERN void ALC_APIENTRY alcDestroyContext(ALCcontext *context);
+SALAD_EXTERN ALCdevice *ALC_APIENTRY alcGetContextsDevice(ALCcontext *context);
+SALAD_EXTERN ALCcontext *ALC_APIENTRY alcGetCurrentContext(void);
+SALAD_EXTERN ALCenum ALC_APIENTRY alcGetEnumValue(ALCdevice *device, const ALCchar *enumname);
+SALAD_EXTERN ALCenum ALC_APIENTRY alcGetError(ALCdevice *device);
+SALAD_EXTERN void ALC_APIENTRY alcGetIntegerv(ALCdevice *device, ALCenum param, ALCsizei size, ALCint *values);
+SALAD_EXTERN ALCvoid *ALC_APIENTRY alcGetProcAddress(ALCdevice *device, const ALCchar *funcname);
+SALAD_EXTERN const ALCchar *ALC_APIENTRY alcGetString(ALCdevice *device, ALCenum param);
+SALAD_EXTERN ALCboolean ALC_APIENTRY alcIsExtensionPresent(ALCdevice *device, const ALCchar *extname);
+SALAD_EXTERN ALCboolean ALC_APIENTRY alcMakeContextCurrent(ALCcontext *context);
+SALAD_EXTERN ALCdevice *ALC_APIENTRY alcOpenDevice(const ALCchar *devicename);
+SALAD_EXTERN void ALC_APIENTRY alcProcessContext(ALCcontext *context);
+SALAD_EXTERN void ALC_APIENTRY alcSuspendContext(ALCcontext *context);
+#else
 SALAD_EXTERN PFN_alcCloseDevice         SALAD_alcCloseDevice;
 SALAD_EXTERN PFN_alcCreateContext       SALAD_alcCreateContext;
 SALAD_EXTERN PFN_alcDestroyContext      SALAD_alcDestroyContext;
@@ -123,11 +131,6 @@ SALAD_EXTERN PFN_alcOpenDevice          SALAD_alcOpenDevice;
 SALAD_EXTERN PFN_alcProcessContext      SALAD_alcProcessContext;
 SALAD_EXTERN PFN_alcSuspendContext      SALAD_alcSuspendContext;
 
-#define alcCaptureCloseDevice   SALAD_alcCaptureCloseDevice
-#define alcCaptureOpenDevice    SALAD_alcCaptureOpenDevice
-#define alcCaptureSamples       SALAD_alcCaptureSamples
-#define alcCaptureStart         SALAD_alcCaptureStart
-#define alcCaptureStop          SALAD_alcCaptureStop
 #define alcCloseDevice          SALAD_alcCloseDevice
 #define alcCreateContext        SALAD_alcCreateContext
 #define alcDestroyContext       SALAD_alcDestroyContext
@@ -143,5 +146,33 @@ SALAD_EXTERN PFN_alcSuspendContext      SALAD_alcSuspendContext;
 #define alcOpenDevice           SALAD_alcOpenDevice
 #define alcProcessContext       SALAD_alcProcessContext
 #define alcSuspendContext       SALAD_alcSuspendContext
+#endif /* SALAD_DIRECT_LINK */
+
+
+typedef ALCboolean(ALC_APIENTRY *PFN_alcCaptureCloseDevice)(ALCdevice *device);
+typedef ALCdevice *(ALC_APIENTRY *PFN_alcCaptureOpenDevice)(const ALCchar *devicename, ALCuint frequency, ALCenum format, ALCsizei buffersize);
+typedef void(ALC_APIENTRY *PFN_alcCaptureSamples)(ALCdevice *device, ALCvoid *buffer, ALCsizei samples);
+typedef void(ALC_APIENTRY *PFN_alcCaptureStart)(ALCdevice *device);
+typedef void(ALC_APIENTRY *PFN_alcCaptureStop)(ALCdevice *device);
+
+#if defined(SALAD_DIRECT_LINK)
+SALAD_EXTERN ALCboolean ALC_APIENTRY alcCaptureCloseDevice(ALCdevice *device);
+SALAD_EXTERN ALCdevice *ALC_APIENTRY alcCaptureOpenDevice(const ALCchar *devicename, ALCuint frequency, ALCenum format, ALCsizei buffersize);
+SALAD_EXTERN void ALC_APIENTRY alcCaptureSamples(ALCdevice *device, ALCvoid *buffer, ALCsizei samples);
+SALAD_EXTERN void ALC_APIENTRY alcCaptureStart(ALCdevice *device);
+SALAD_EXTERN void ALC_APIENTRY alcCaptureStop(ALCdevice *device);
+#else
+SALAD_EXTERN PFN_alcCaptureCloseDevice  SALAD_alcCaptureCloseDevice;
+SALAD_EXTERN PFN_alcCaptureOpenDevice   SALAD_alcCaptureOpenDevice;
+SALAD_EXTERN PFN_alcCaptureSamples      SALAD_alcCaptureSamples;
+SALAD_EXTERN PFN_alcCaptureStart        SALAD_alcCaptureStart;
+SALAD_EXTERN PFN_alcCaptureStop         SALAD_alcCaptureStop;
+
+#define alcCaptureCloseDevice   SALAD_alcCaptureCloseDevice
+#define alcCaptureOpenDevice    SALAD_alcCaptureOpenDevice
+#define alcCaptureSamples       SALAD_alcCaptureSamples
+#define alcCaptureStart         SALAD_alcCaptureStart
+#define alcCaptureStop          SALAD_alcCaptureStop
+#endif /* SALAD_DIRECT_LINK */
 
 #endif /* AL_ALC_H */
@@ -0,0 +1,179 @@
+/*
+ * alext.h - OpenAL extension functions
+ * Copyright (C) 2021-2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* Generated by salad_gen from gen/salad.reg, do not edit */
+#ifndef AL_ALEXT_H
+#define AL_ALEXT_H 1
+#include <AL/al.h>
+#include <AL/alc.h>
+
+#define AL_SOFT_deferred_updates 1
+#define SALAD_AL_SOFT_deferred_updates 0x00000002U
+
+#define AL_DEFERRED_UPDATES_SOFT    (0xC002)
+
+typedef void(AL_APIENTRY *PFN_alDeferUpdatesSOFT)(void);
+typedef void(AL_APIENTRY *PFN_alProcessUpdatesSOFT)(void);
+
+#if defined(SALAD_DIRECT_LINK)
+SALAD_EXTERN void AL_APIENTRY alDeferUpdatesSOFT(void);
+SALAD_EXTERN void AL_APIENTRY alProcessUpdatesSOFT(void);
+#else
+SALAD_EXTERN PFN_alDeferUpdatesSOFT     SALAD_alDeferUpdatesSOFT;
+SALAD_EXTERN PFN_alProcessUpdatesSOFT   SALAD_alProcessUpdatesSOFT;
+
+#define alDeferUpdatesSOFT      SALAD_alDeferUpdatesSOFT
+#define alProcessUpdatesSOFT    SALAD_alProcessUpdatesSOFT
+#endif /* SALAD_DIRECT_LINK */
+
+#define AL_EXT_float32 1
+#define SALAD_AL_EXT_float32 0x00000004U
+
+#define AL_FORMAT_MONO_FLOAT32      (0x10010)
+#define AL_FORMAT_STEREO_FLOAT32    (0x10011)
+
+#define AL_EXT_MCFORMATS 1
+#define SALAD_AL_EXT_MCFORMATS 0x00000008U
+
+#define AL_FORMAT_QUAD8     (0x1204)
+#define AL_FORMAT_QUAD16    (0x1205)
+#define AL_FORMAT_QUAD32    (0x1206)
+#define AL_FORMAT_REAR8     (0x1207)
+#define AL_FORMAT_REAR16    (0x1208)
+#define AL_FORMAT_REAR32    (0x1209)
+#define AL_FORMAT_51CHN8    (0x120A)
+#define AL_FORMAT_51CHN16   (0x120B)
+#define AL_FORMAT_51CHN32   (0x120C)
+#define AL_FORMAT_61CHN8    (0x120D)
+#define AL_FORMAT_61CHN16   (0x120E)
+#define AL_FORMAT_61CHN32   (0x120F)
+#define AL_FORMAT_71CHN8    (0x1210)
+#define AL_FORMAT_71CHN16   (0x1211)
+#define AL_FORMAT_71CHN32   (0x1212)
+
+#define ALC_SOFT_loopback 1
+#define SALAD_ALC_SOFT_loopback 0x00000010U
+
+#define ALC_BYTE_SOFT               (0x1400)
+#define ALC_UNSIGNED_BYTE_SOFT      (0x1401)
+#define ALC_SHORT_SOFT              (0x1402)
+#define ALC_UNSIGNED_SHORT_SOFT     (0x1403)
+#define ALC_INT_SOFT                (0x1404)
+#define ALC_UNSIGNED_INT_SOFT       (0x1405)
+#define ALC_FLOAT_SOFT              (0x1406)
+#define ALC_MONO_SOFT               (0x1500)
+#define ALC_STEREO_SOFT             (0x1501)
+#define ALC_QUAD_SOFT               (0x1503)
+#define ALC_5POINT1_SOFT            (0x1504)
+#define ALC_6POINT1_SOFT            (0x1505)
+#define ALC_7POINT1_SOFT            (0x1506)
+#define ALC_FORMAT_CHANNELS_SOFT    (0x1990)
+#define ALC_FORMAT_TYPE_SOFT        (0x1991)
+
+typedef ALCboolean(ALC_APIENTRY *PFN_alcIsRenderFormatSupportedSOFT)(ALCdevice *device, ALCsizei freq, ALCenum channels, ALCenum type);
+typedef ALCdevice *(ALC_APIENTRY *PFN_alcLoopbackOpenDeviceSOFT)(const ALCchar *deviceName);
+typedef void(ALC_APIENTRY *PFN_alcRenderSamplesSOFT)(ALCdevice *device, ALCvoid *buffer, ALCsizei samples);
+
+#if defined(SALAD_DIRECT_LINK)
+SALAD_EXTERN ALCboolean ALC_APIENTRY alcIsRenderFormatSupportedSOFT(ALCdevice *device, ALCsizei freq, ALCenum channels, ALCenum type);
+SALAD_EXTERN ALCdevice *ALC_APIENTRY alcLoopbackOpenDeviceSOFT(const ALCchar *deviceName);
+SALAD_EXTERN void ALC_APIENTRY alcRenderSamplesSOFT(ALCdevice *device, ALCvoid *buffer, ALCsizei samples);
+#else
+SALAD_EXTERN PFN_alcIsRenderFormatSupportedSOFT SALAD_alcIsRenderFormatSupportedSOFT;
+SALAD_EXTERN PFN_alcLoopbackOpenDeviceSOFT      SALAD_alcLoopbackOpenDeviceSOFT;
+SALAD_EXTERN PFN_alcRenderSamplesSOFT           SALAD_alcRenderSamplesSOFT;
+
+#define alcIsRenderFormatSupportedSOFT  SALAD_alcIsRenderFormatSupportedSOFT
+#define alcLoopbackOpenDeviceSOFT       SALAD_alcLoopbackOpenDeviceSOFT
+#define alcRenderSamplesSOFT            SALAD_alcRenderSamplesSOFT
+#endif /* SALAD_DIRECT_LINK */
+
+#define AL_SOFT_callback_buffer 1
+#define SALAD_AL_SOFT_callback_buffer 0x00000020U
+
+#define AL_BUFFER_CALLBACK_FUNCTION_SOFT    (0x19A0)
+#define AL_BUFFER_CALLBACK_USER_PARAM_SOFT  (0x19A1)
+
+typedef ALsizei(AL_APIENTRY *ALBUFFERCALLBACKTYPESOFT)(ALvoid *userptr, ALvoid *sampledata, ALsizei numbytes);
+
+typedef void(AL_APIENTRY *PFN_alBufferCallbackSOFT)(ALuint buffer, ALenum format, ALsizei freq, ALBUFFERCALLBACKTYPESOFT callback, ALvoid *userptr);
+typedef void(AL_APIENTRY *PFN_alGetBuffer3PtrSOFT)(ALuint buffer, ALenum param, ALvoid **ptr0, ALvoid **ptr1, ALvoid **ptr2);
+typedef void(AL_APIENTRY *PFN_alGetBufferPtrSOFT)(ALuint buffer, ALenum param, ALvoid **ptr);
+typedef void(AL_APIENTRY *PFN_alGetBufferPtrvSOFT)(ALuint buffer, ALenum param, ALvoid **ptr);
+
+#if defined(SALAD_DIRECT_LINK)
+SALAD_EXTERN void AL_APIENTRY alBufferCallbackSOFT(ALuint buffer, ALenum format, ALsizei freq, ALBUFFERCALLBACKTYPESOFT callback, ALvoid *userptr);
+SALAD_EXTERN void AL_APIENTRY alGetBuffer3PtrSOFT(ALuint buffer, ALenum param, ALvoid **ptr0, ALvoid **ptr1, ALvoid **ptr2);
+SALAD_EXTERN void AL_APIENTRY alGetBufferPtrSOFT(ALuint buffer, ALenum param, ALvoid **ptr);
+SALAD_EXTERN void AL_APIENTRY alGetBufferPtrvSOFT(ALuint buffer, ALenum param, ALvoid **ptr);
+#else
+SALAD_EXTERN PFN_alBufferCallbackSOFT   SALAD_alBufferCallbackSOFT;
+SALAD_EXTERN PFN_alGetBuffer3PtrSOFT    SALAD_alGetBuffer3PtrSOFT;
+SALAD_EXTERN PFN_alGetBufferPtrSOFT     SALAD_alGetBufferPtrSOFT;
+SALAD_EXTERN PFN_alGetBufferPtrvSOFT    SALAD_alGetBufferPtrvSOFT;
+
+#define alBufferCallbackSOFT    SALAD_alBufferCallbackSOFT
+#define alGetBuffer3PtrSOFT     SALAD_alGetBuffer3PtrSOFT
+#define alGetBufferPtrSOFT      SALAD_alGetBufferPtrSOFT
+#define alGetBufferPtrvSOFT     SALAD_alGetBufferPtrvSOFT
+#endif /* SALAD_DIRECT_LINK */
+
+#define ALC_EXT_thread_local_context 1
+#define SALAD_ALC_EXT_thread_local_context 0x00000040U
+
+typedef ALCboolean(ALC_APIENTRY *PFN_alcSetThreadContext)(ALCcontext *context);
+typedef ALCcontext *(ALC_APIENTRY *PFN_alcGetThreadContext)(void);
+
+#if defined(SALAD_DIRECT_LINK)
+SALAD_EXTERN ALCcontext *ALC_APIENTRY alcGetThreadContext(void);
+SALAD_EXTERN ALCboolean ALC_APIENTRY alcSetThreadContext(ALCcontext *context);
+#else
+SALAD_EXTERN PFN_alcGetThreadContext    SALAD_alcGetThreadContext;
+SALAD_EXTERN PFN_alcSetThreadContext    SALAD_alcSetThreadContext;
+
+#define alcGetThreadContext SALAD_alcGetThreadContext
+#define alcSetThreadContext SALAD_alcSetThreadContext
+#endif /* SALAD_DIRECT_LINK */
+
+#define AL_EXT_STATIC_BUFFER 1
+#define SALAD_AL_EXT_STATIC_BUFFER 0x00000080U
+
+typedef void(AL_APIENTRY *PFN_alBufferDataStatic)(ALint buffer, ALenum format, ALvoid *data, ALsizei size, ALsizei freq);
+
+#if defined(SALAD_DIRECT_LINK)
+SALAD_EXTERN void AL_APIENTRY alBufferDataStatic(ALint buffer, ALenum format, ALvoid *data, ALsizei size, ALsizei freq);
+#else
+SALAD_EXTERN PFN_alBufferDataStatic SALAD_alBufferDataStatic;
+
+#define alBufferDataStatic  SALAD_alBufferDataStatic
+#endif /* SALAD_DIRECT_LINK */
+
+#define AL_EXT_IMA4 1
+#define SALAD_AL_EXT_IMA4 0x00000100U
+
+#define AL_FORMAT_MONO_IMA4     (0x1300)
+#define AL_FORMAT_STEREO_IMA4   (0x1301)
+
+#endif /* AL_ALEXT_H */
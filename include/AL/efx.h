@@ -1,6 +1,6 @@
 /*
  * efx.h - ALC_EXT_EFX extension functions
- * Copyright (C) 2021-2025, Kirill Dmitrievich
+ * Copyright (C) 2021-2026, Kirill Dmitrievich
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions are met:
@@ -23,15 +23,18 @@
  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
+/* Generated by salad_gen from gen/salad.reg, do not edit */
 #ifndef AL_EFX_H
 #define AL_EFX_H 1
 #include <AL/al.h>
 
+#define ALC_EXT_EFX 1
+#define SALAD_ALC_EXT_EFX 0x00000001U
 #define ALC_EXT_EFX_NAME "ALC_EXT_EFX"
 
-#define ALC_EFX_MAJOR_VERSION   (0x20001)
-#define ALC_EFX_MINOR_VERSION   (0x20002)
-#define ALC_MAX_AUXILIARY_SENDS (0x20003)
+#define ALC_EFX_MAJOR_VERSION                           (0x20001)
+#define ALC_EFX_MINOR_VERSION                           (0x20002)
+#define ALC_MAX_AUXILIARY_SENDS                         (0x20003)
 
 #define AL_AIR_ABSORPTION_FACTOR                        (0x20007)
 
@@ -112,7 +115,7 @@
 #define AL_FILTER_HIGHPASS                              (0x00002)
 #define AL_FILTER_LAST_PARAMETER                        (0x08000)
 #define AL_FILTER_LOWPASS                               (0x00001)
-#define AL_FILTER_NULL                                  (0x00000) 
+#define AL_FILTER_NULL                                  (0x00000)
 #define AL_FILTER_TYPE                                  (0x08001)
 
 #define AL_FLANGER_DELAY                                (0x00006)
@@ -458,41 +461,65 @@
 #define LOWPASS_MIN_GAIN                                (0.0f)
 #define LOWPASS_MIN_GAINHF                              (0.0f)
 
-typedef ALboolean (AL_APIENTRY *PFN_alIsEffect)(ALuint eid);
-typedef ALboolean (AL_APIENTRY *PFN_alIsFilter)(ALuint fid);
-typedef void (AL_APIENTRY *PFN_alDeleteEffects)(ALsizei n, ALuint *effects);
-typedef void (AL_APIENTRY *PFN_alDeleteFilters)(ALsizei n, ALuint *filters);
-typedef void (AL_APIENTRY *PFN_alEffectf)(ALuint eid, ALenum param, ALfloat value); 
-typedef void (AL_APIENTRY *PFN_alEffectfv)(ALuint eid, ALenum param, ALfloat *values); 
-typedef void (AL_APIENTRY *PFN_alEffecti)(ALuint eid, ALenum param, ALint value); 
-typedef void (AL_APIENTRY *PFN_alEffectiv)(ALuint eid, ALenum param, ALint *values); 
-typedef void (AL_APIENTRY *PFN_alFilterf)(ALuint fid, ALenum param, ALfloat value); 
-typedef void (AL_APIENTRY *PFN_alFilterfv)(ALuint fid, ALenum param, ALfloat *values); 
-typedef void (AL_APIENTRY *PFN_alFilteri)(ALuint fid, ALenum param, ALint value); 
-typedef void (AL_APIENTRY *PFN_alFilteriv)(ALuint fid, ALenum param, ALint *values); 
-typedef void (AL_APIENTRY *PFN_alGenEffects)(ALsizei n, ALuint *effects);
-typedef void (AL_APIENTRY *PFN_alGenFilters)(ALsizei n, ALuint *filters); 
-typedef void (AL_APIENTRY *PFN_alGetEffectf)(ALuint eid, ALenum pname, ALfloat *value);
-typedef void (AL_APIENTRY *PFN_alGetEffectfv)(ALuint eid, ALenum pname, ALfloat *values);
-typedef void (AL_APIENTRY *PFN_alGetEffecti)(ALuint eid, ALenum pname, ALint *value);
-typedef void (AL_APIENTRY *PFN_alGetEffectiv)(ALuint eid, ALenum pname, ALint *values);
-typedef void (AL_APIENTRY *PFN_alGetFilterf)(ALuint fid, ALenum pname, ALfloat *value);
-typedef void (AL_APIENTRY *PFN_alGetFilterfv)(ALuint fid, ALenum pname, ALfloat *values);
-typedef void (AL_APIENTRY *PFN_alGetFilteri)(ALuint fid, ALenum pname, ALint *value);
-typedef void (AL_APIENTRY *PFN_alGetFilteriv)(ALuint fid, ALenum pname, ALint *values);
-
+typedef ALboolean(AL_APIENTRY *PFN_alIsEffect)(ALuint eid);
+typedef ALboolean(AL_APIENTRY *PFN_alIsFilter)(ALuint fid);
+typedef void(AL_APIENTRY *PFN_alDeleteEffects)(ALsizei n, ALuint *effects);
+typedef void(AL_APIENTRY *PFN_alDeleteFilters)(ALsizei n, ALuint *filters);
+typedef void(AL_APIENTRY *PFN_alEffectf)(ALuint eid, ALenum param, ALfloat value);
+typedef void(AL_APIENTRY *PFN_alEffectfv)(ALuint eid, ALenum param, ALfloat *values);
+typedef void(AL_APIENTRY *PFN_alEffecti)(ALuint eid, ALenum param, ALint value);
+typedef void(AL_APIENTRY *PFN_alEffectiv)(ALuint eid, ALenum param, ALint *values);
+typedef void(AL_APIENTRY *PFN_alFilterf)(ALuint fid, ALenum param, ALfloat value);
+typedef void(AL_APIENTRY *PFN_alFilterfv)(ALuint fid, ALenum param, ALfloat *values);
+typedef void(AL_APIENTRY *PFN_alFilteri)(ALuint fid, ALenum param, ALint value);
+typedef void(AL_APIENTRY *PFN_alFilteriv)(ALuint fid, ALenum param, ALint *values);
+typedef void(AL_APIENTRY *PFN_alGenEffects)(ALsizei n, ALuint *effects);
+typedef void(AL_APIENTRY *PFN_alGenFilters)(ALsizei n, ALuint *filters);
+typedef void(AL_APIENTRY *PFN_alGetEffectf)(ALuint eid, ALenum pname, ALfloat *value);
+typedef void(AL_APIENTRY *PFN_alGetEffectfv)(ALuint eid, ALenum pname, ALfloat *values);
+typedef void(AL_APIENTRY *PFN_alGetEffecti)(ALuint eid, ALenum pname, ALint *value);
+typedef void(AL_APIENTRY *PFN_alGetEffectiv)(ALuint eid, ALenum pname, ALint *values);
+typedef void(AL_APIENTRY *PFN_alGetFilterf)(ALuint fid, ALenum pname, ALfloat *value);
+typedef void(AL_APIENTRY *PFN_alGetFilterfv)(ALuint fid, ALenum pname, ALfloat *values);
+typedef void(AL_APIENTRY *PFN_alGetFilteri)(ALuint fid, ALenum pname, ALint *value);
+typedef void(AL_APIENTRY *PFN_alGetFilteriv)(ALuint fid, ALenum pname, ALint *values);
+
+#if defined(SALAD_DIRECT_LINK)
+SALAD_EXTERN void AL_APIENTRY alDeleteEffects(ALsizei n, ALuint *effects);
+SALAD_EXTERN void AL_APIENTRY alDeleteFilters(ALsizei n, ALuint *filters);
+SALAD_EXTERN void AL_APIENTRY alEffectf(ALuint eid, ALenum param, ALfloat value);
+SALAD_EXTERN void AL_APIENTRY alEffectfv(ALuint eid, ALenum param, ALfloat *values);
+SALAD_EXTERN void AL_APIENTRY alEffecti(ALuint eid, ALenum param, ALint value);
+SALAD_EXTERN void AL_APIENTRY alEffectiv(ALuint eid, ALenum param, ALint *values);
+SALAD_EXTERN void AL_APIENTRY alFilterf(ALuint fid, ALenum param, ALfloat value);
+SALAD_EXTERN void AL_APIENTRY alFilterfv(ALuint fid, ALenum param, ALfloat *values);
+SALAD_EXTERN void AL_APIENTRY alFilteri(ALuint fid, ALenum param, ALint value);
+SALAD_EXTERN void AL_APIENTRY alFilteriv(ALuint fid, ALenum param, ALint *values);
+SALAD_EXTERN void AL_APIENTRY alGenEffects(ALsizei n, ALuint *effects);
+SALAD_EXTERN void AL_APIENTRY alGenFilters(ALsizei n, ALuint *filters);
+SALAD_EXTERN void AL_APIENTRY alGetEffectf(ALuint eid, ALenum pname, ALfloat *value);
+SALAD_EXTERN void AL_APIENTRY alGetEffectfv(ALuint eid, ALenum pname, ALfloat *values);
+SALAD_EXTERN void AL_APIENTRY alGetEffecti(ALuint eid, ALenum pname, ALint *value);
+SALAD_EXTERN void AL_APIENTRY alGetEffectiv(ALuint eid, ALenum pname, ALint *values);
+SALAD_EXTERN void AL_APIENTRY alGetFilterf(ALuint fid, ALenum pname, ALfloat *value);
+SALAD_EXTERN void AL_APIENTRY alGetFilterfv(ALuint fid, ALenum pname, ALfloat *values);
+SALAD_EXTERN void AL_APIENTRY alGetFilteri(ALuint fid, ALenum pname, ALint *value);
+SALAD_EXTERN void AL_APIENTRY alGetFilteriv(ALuint fid, ALenum pname, ALint *values);
+SALAD_EXTERN ALboolean AL_APIENTRY alIsEffect(ALuint eid);
+SALAD_EXTERN ALboolean AL_APIENTRY alIsFilter(ALuint fid);
+#else
 SALAD_EXTERN PFN_alDeleteEffects    SALAD_alDeleteEffects;
 SALAD_EXTERN PFN_alDeleteFilters    SALAD_alDeleteFilters;
-SALAD_EXTERN PFN_alEffectf          SALAD_alEffectf; 
-SALAD_EXTERN PFN_alEffectfv         SALAD_alEffectfv; 
-SALAD_EXTERN PFN_alEffecti          SALAD_alEffecti; 
-SALAD_EXTERN PFN_alEffectiv         SALAD_alEffectiv; 
-SALAD_EXTERN PFN_alFilterf          SALAD_alFilterf; 
-SALAD_EXTERN PFN_alFilterfv         SALAD_alFilterfv; 
-SALAD_EXTERN PFN_alFilteri          SALAD_alFilteri; 
-SALAD_EXTERN PFN_alFilteriv         SALAD_alFilteriv; 
+SALAD_EXTERN PFN_alEffectf          SALAD_alEffectf;
+SALAD_EXTERN PFN_alEffectfv         SALAD_alEffectfv;
+SALAD_EXTERN PFN_alEffecti          SALAD_alEffecti;
+SALAD_EXTERN PFN_alEffectiv         SALAD_alEffectiv;
+SALAD_EXTERN PFN_alFilterf          SALAD_alFilterf;
+SALAD_EXTERN PFN_alFilterfv         SALAD_alFilterfv;
+SALAD_EXTERN PFN_alFilteri          SALAD_alFilteri;
+SALAD_EXTERN PFN_alFilteriv         SALAD_alFilteriv;
 SALAD_EXTERN PFN_alGenEffects       SALAD_alGenEffects;
-SALAD_EXTERN PFN_alGenFilters       SALAD_alGenFilters; 
+SALAD_EXTERN PFN_alGenFilters       SALAD_alGenFilters;
 SALAD_EXTERN PFN_alGetEffectf       SALAD_alGetEffectf;
 SALAD_EXTERN PFN_alGetEffectfv      SALAD_alGetEffectfv;
 SALAD_EXTERN PFN_alGetEffecti       SALAD_alGetEffecti;
@@ -506,16 +533,16 @@ SALAD_EXTERN PFN_alIsFilter         SALAD_alIsFilter;
 
 #define alDeleteEffects SALAD_alDeleteEffects
 #define alDeleteFilters SALAD_alDeleteFilters
-#define alEffectf       SALAD_alEffectf 
-#define alEffectfv      SALAD_alEffectfv 
-#define alEffecti       SALAD_alEffecti 
-#define alEffectiv      SALAD_alEffectiv 
-#define alFilterf       SALAD_alFilterf 
-#define alFilterfv      SALAD_alFilterfv 
-#define alFilteri       SALAD_alFilteri 
-#define alFilteriv      SALAD_alFilteriv 
+#define alEffectf       SALAD_alEffectf
+#define alEffectfv      SALAD_alEffectfv
+#define alEffecti       SALAD_alEffecti
+#define alEffectiv      SALAD_alEffectiv
+#define alFilterf       SALAD_alFilterf
+#define alFilterfv      SALAD_alFilterfv
+#define alFilteri       SALAD_alFilteri
+#define alFilteriv      SALAD_alFilteriv
 #define alGenEffects    SALAD_alGenEffects
-#define alGenFilters    SALAD_alGenFilters 
+#define alGenFilters    SALAD_alGenFilters
 #define alGetEffectf    SALAD_alGetEffectf
 #define alGetEffectfv   SALAD_alGetEffectfv
 #define alGetEffecti    SALAD_alGetEffecti
@@ -526,5 +553,6 @@ SALAD_EXTERN PFN_alIsFilter         SALAD_alIsFilter;
 #define alGetFilteriv   SALAD_alGetFilteriv
 #define alIsEffect      SALAD_alIsEffect
 #define alIsFilter      SALAD_alIsFilter
+#endif /* SALAD_DIRECT_LINK */
 
 #endif /* AL_EFX_H */
@@ -79,6 +79,41 @@ typedef unsigned int        salad_uint32_type;
  */
 typedef void* (SALAD_APIENTRY *SALAD_loadfunc_type)(const char *procname, void *arg);
 
+/**
+ * A per-instance set of OpenAL function pointers;
+ * the complete definition lives in <AL/salad_table.h>
+ */
+typedef struct SALAD_table SALAD_table_type;
+
+/* Same as ALCdevice from <AL/alc.h> */
+struct ALCdevice;
+
+/* Groups of functions that can be loaded
+ * separately with saladLoadALgroups; every extension
+ * belongs to one of the extension groups */
+#define SALAD_GROUP_CORE    0x0001U /* Core OpenAL functions <AL/al.h> */
+#define SALAD_GROUP_ALC     0x0002U /* Context OpenAL functions <AL/alc.h> */
+#define SALAD_GROUP_CAPTURE 0x0004U /* Capture OpenAL functions <AL/alc.h> */
+#define SALAD_GROUP_EFX     0x0008U /* ALC_EXT_EFX extension <AL/efx.h> */
+#define SALAD_GROUP_SOFT    0x0010U /* AL_SOFT_* extensions <AL/alext.h> */
+#define SALAD_GROUP_THREAD  0x0020U /* ALC_EXT_thread_local_context extension <AL/alext.h> */
+#define SALAD_GROUP_STATIC  0x0040U /* AL_EXT_STATIC_BUFFER extension <AL/alext.h> */
+#define SALAD_GROUP_ALL     0x007FU
+
+/* Extensions the loaded implementation supports, one
+ * SALAD_<extension name> bit per extension SALAD knows about,
+ * for example SALAD_ALC_EXT_EFX; updated by saladUpdateALextensions
+ * and saladLoadALdevice and reset to zero by every other loader */
+SALAD_EXTERN unsigned int SALAD_extensions;
+
+/**
+ * Checks the cached extension bits, so unlike
+ * alIsExtensionPresent this costs a single AND
+ * @param ext       SALAD_<extension name> bit or a mask of them
+ * @returns         Non-zero if any of the extensions is present
+ */
+#define saladHasExtension(ext) ((SALAD_extensions & (ext)) != 0)
+
 /**
  * Loads OpenAL and extensions using implementation-defined
  * dynamic library paths and using implementation-defined API
@@ -86,6 +121,25 @@ typedef void* (SALAD_APIENTRY *SALAD_loadfunc_type)(const char *procname, void *
  */
 SALAD_EXTERN int saladLoadALdefault(void);
 
+/**
+ * Same as saladLoadALdefault but core and context functions
+ * are resolved lazily, see saladLoadALlazy for details
+ * @returns         Zero on failure, non-zero on success
+ */
+SALAD_EXTERN int saladLoadALdefaultLazy(void);
+
+/**
+ * Loads OpenAL and extensions from a specific library, for
+ * example a custom OpenAL Soft build; whatever module SALAD has
+ * opened before is closed after the new one has been loaded, so
+ * this doubles as a way to switch drivers in a running process.
+ * All devices and contexts of the previous driver must be destroyed
+ * and no other thread may be calling OpenAL functions meanwhile
+ * @param libname   Library name or path, NULL for the default ones
+ * @returns         Zero on failure, non-zero on success
+ */
+SALAD_EXTERN int saladLoadALlibrary(const char *libname);
+
 /**
  * Loads OpenAL and extensions using a user-provided load
  * function; Initially this was used to mate Source SDK's dynamic
@@ -96,4 +150,106 @@ SALAD_EXTERN int saladLoadALdefault(void);
  */
 SALAD_EXTERN int saladLoadALfunc(SALAD_loadfunc_type loadfunc, void *arg);
 
+/**
+ * Loads only the given groups of functions using a user-provided
+ * load function, the pointers of every other group are reset to NULL.
+ * A group counts as loaded once all of its functions are resolved; with
+ * SALAD_PARANOID the pointers of a feature or an extension that only
+ * resolved partially are reset to NULL as well
+ * @param loadfunc  User-provided load function
+ * @param arg       Optional argument for the function
+ * @param groups    SALAD_GROUP_* mask of groups to load
+ * @returns         SALAD_GROUP_* mask of groups that were loaded
+ */
+SALAD_EXTERN unsigned int saladLoadALgroups(SALAD_loadfunc_type loadfunc, void *arg, unsigned int groups);
+
+/**
+ * Loads OpenAL using a user-provided load function without
+ * resolving core and context functions up front; every such
+ * SALAD_* pointer starts on a trampoline that resolves the real
+ * function on its first call and patches the pointer in place.
+ * Extension functions are still resolved eagerly. The load function
+ * must be safe to call from any thread that calls into OpenAL.
+ * Only alGetError is checked up front; a core or context function
+ * that fails to resolve on its first call aborts the process with
+ * SALAD_PARANOID and otherwise silently does nothing and returns zero
+ * @param loadfunc  User-provided load function
+ * @param arg       Optional argument for the function
+ * @returns         Zero on failure, non-zero on success
+ */
+SALAD_EXTERN int saladLoadALlazy(SALAD_loadfunc_type loadfunc, void *arg);
+
+/**
+ * Loads OpenAL and extensions into a user-provided function
+ * table instead of the global SALAD_* pointers; this allows a single
+ * process to talk to several OpenAL implementations at the same time
+ * @param table     Function table to fill
+ * @param loadfunc  User-provided load function
+ * @param arg       Optional argument for the function
+ * @returns         Zero on failure, non-zero on success
+ */
+SALAD_EXTERN int saladLoadALtable(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg);
+
+/**
+ * Loads the software renderer built into SALAD with
+ * SALAD_SOFTWARE instead of a system library; it mixes sources
+ * with distance attenuation and panning but has no audio output
+ * of its own, ALC_SOFT_loopback renders it into memory. The default
+ * loaders fall back to it when no OpenAL library can be found
+ * @returns         Zero on failure or if it's not built in, non-zero on success
+ */
+SALAD_EXTERN int saladLoadALsoftware(void);
+
+/**
+ * Re-resolves extension functions of the global SALAD_*
+ * pointers through the driver itself, using alGetProcAddress
+ * and alcGetProcAddress of an opened device instead of the symbols
+ * exported by the library; this picks up extensions that are only
+ * available per device and the driver's own entry points, which a
+ * router library would otherwise forward every call through.
+ * Functions the driver doesn't return for the device become NULL
+ * and SALAD_extensions is updated for the device as well
+ * @param device    Device opened with alcOpenDevice
+ * @returns         SALAD_GROUP_* mask of extension groups that were loaded
+ */
+SALAD_EXTERN unsigned int saladLoadALdevice(struct ALCdevice *device);
+
+/**
+ * Same as saladLoadALdevice but for a function table
+ * that has been loaded with saladLoadALtable
+ * @param table     Function table to update
+ * @param device    Device opened with table->alcOpenDevice
+ * @returns         SALAD_GROUP_* mask of extension groups that were loaded
+ */
+SALAD_EXTERN unsigned int saladLoadALtableDevice(SALAD_table_type *table, struct ALCdevice *device);
+
+/**
+ * Queries every extension SALAD knows about through
+ * alcIsExtensionPresent and alIsExtensionPresent once and
+ * caches the result in SALAD_extensions; AL extensions are
+ * only checked while a context is current, so call this after
+ * alcMakeContextCurrent and again after switching devices
+ * @param device    Device to check ALC extensions for, may be NULL
+ * @returns         The new value of SALAD_extensions
+ */
+SALAD_EXTERN unsigned int saladUpdateALextensions(struct ALCdevice *device);
+
+/**
+ * Same as saladUpdateALextensions but for a function
+ * table; the result is returned and not cached anywhere
+ * @param table     Function table to query through
+ * @param device    Device to check ALC extensions for, may be NULL
+ * @returns         SALAD_<extension name> bits of present extensions
+ */
+SALAD_EXTERN unsigned int saladQueryALtableExtensions(const SALAD_table_type *table, struct ALCdevice *device);
+
+/**
+ * Resets all the global SALAD_* pointers to NULL and closes
+ * the module SALAD has opened, if any; the next call to any global
+ * loader, including saladLoadALdefault, loads everything again.
+ * All devices and contexts must be destroyed beforehand and no
+ * other thread may be calling OpenAL functions meanwhile
+ */
+SALAD_EXTERN void saladUnloadAL(void);
+
 #endif /* AL_SALAD_H */
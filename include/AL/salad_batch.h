@@ -0,0 +1,60 @@
+/*
+ * salad_batch.h - Batched source updates
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AL_SALAD_BATCH_H
+#define AL_SALAD_BATCH_H 1
+#include <AL/al.h>
+#include <AL/salad.h>
+
+/**
+ * Sets the position, velocity and gain of many sources in one
+ * call; every parameter is a separate array indexed the same way as
+ * the source names and any of them may be NULL to leave it alone.
+ * Positions and velocities take three floats per source. With
+ * AL_SOFT_deferred_updates the whole batch is deferred and applied
+ * at once, unless updates are already deferred by the caller
+ * @param count         Number of sources
+ * @param sources       Source names
+ * @param positions     AL_POSITION of every source, may be NULL
+ * @param velocities    AL_VELOCITY of every source, may be NULL
+ * @param gains         AL_GAIN of every source, may be NULL
+ * @returns             Zero if the functions it needs aren't loaded, non-zero otherwise
+ */
+SALAD_EXTERN int saladUpdateALsources(ALsizei count, const ALuint *sources, const ALfloat *positions, const ALfloat *velocities, const ALfloat *gains);
+
+/**
+ * Same as saladUpdateALsources but calls through a
+ * function table loaded with saladLoadALtable
+ * @param table         Function table to call through
+ * @param count         Number of sources
+ * @param sources       Source names
+ * @param positions     AL_POSITION of every source, may be NULL
+ * @param velocities    AL_VELOCITY of every source, may be NULL
+ * @param gains         AL_GAIN of every source, may be NULL
+ * @returns             Zero if the functions it needs aren't loaded, non-zero otherwise
+ */
+SALAD_EXTERN int saladUpdateALtableSources(const SALAD_table_type *table, ALsizei count, const ALuint *sources, const ALfloat *positions, const ALfloat *velocities, const ALfloat *gains);
+
+#endif /* AL_SALAD_BATCH_H */
@@ -0,0 +1,110 @@
+/*
+ * salad_buffers.h - Recycling pool of buffer names
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AL_SALAD_BUFFERS_H
+#define AL_SALAD_BUFFERS_H 1
+#include <AL/al.h>
+#include <AL/salad.h>
+
+/**
+ * A pool of buffer names that are generated in batches and
+ * recycled instead of deleted; released buffers are kept on a free
+ * list per size class, so a buffer handed out again has already held
+ * about as much data and the driver can refill it in place, the
+ * complete definition is private
+ */
+typedef struct SALAD_buffer_pool SALAD_buffer_pool_type;
+
+/* What a buffer pool has done since it was created */
+typedef struct SALAD_buffer_pool_stats {
+    unsigned long acquires;     /* Buffers handed out */
+    unsigned long hits;         /* Buffers handed out without calling alGenBuffers */
+    unsigned long gen_calls;    /* Calls to alGenBuffers */
+    unsigned long delete_calls; /* Calls to alDeleteBuffers */
+    unsigned long buffers;      /* Buffers the pool owns, handed out or not */
+    unsigned long free;         /* Buffers ready to be handed out */
+} SALAD_buffer_pool_stats_type;
+
+/**
+ * Creates an empty buffer pool calling
+ * through the global SALAD_* pointers
+ * @param batch     Buffers to generate per alGenBuffers call, zero for a default
+ * @returns         The pool, NULL if out of memory
+ */
+SALAD_EXTERN SALAD_buffer_pool_type *saladCreateALbufferPool(ALsizei batch);
+
+/**
+ * Same as saladCreateALbufferPool but calls through a function
+ * table loaded with saladLoadALtable; the table must outlive the pool
+ * @param table     Function table to call through
+ * @param batch     Buffers to generate per alGenBuffers call, zero for a default
+ * @returns         The pool, NULL if out of memory
+ */
+SALAD_EXTERN SALAD_buffer_pool_type *saladCreateALtableBufferPool(const SALAD_table_type *table, ALsizei batch);
+
+/**
+ * Deletes every buffer of a pool that isn't handed out and the
+ * pool itself; buffers that are still handed out become the caller's
+ * to delete. The context the pool was used with must be current
+ * @param pool      Pool to destroy, may be NULL
+ */
+SALAD_EXTERN void saladDestroyALbufferPool(SALAD_buffer_pool_type *pool);
+
+/**
+ * Hands out a buffer for about the given amount of data,
+ * preferring one that has held data of the same size class before;
+ * alGenBuffers is only called when nothing is left to recycle
+ * @param pool      Pool to take the buffer from
+ * @param size      Bytes the buffer is going to hold, zero if unknown
+ * @returns         Buffer name, zero on failure
+ */
+SALAD_EXTERN ALuint saladAcquireALbuffer(SALAD_buffer_pool_type *pool, ALsizei size);
+
+/**
+ * Puts a buffer handed out by saladAcquireALbuffer back into
+ * the pool; the buffer must no longer be attached to or queued on any
+ * source, its data is left alone until it's filled again
+ * @param pool      Pool the buffer came from
+ * @param buffer    Buffer to put back
+ * @returns         Zero if the buffer isn't handed out by the pool
+ */
+SALAD_EXTERN int saladReleaseALbuffer(SALAD_buffer_pool_type *pool, ALuint buffer);
+
+/**
+ * Deletes every buffer of a pool that isn't handed out
+ * with a single alDeleteBuffers call, giving its memory back
+ * @param pool      Pool to trim
+ */
+SALAD_EXTERN void saladTrimALbufferPool(SALAD_buffer_pool_type *pool);
+
+/**
+ * Reads the buffer pool counters; hits divided by
+ * acquires is how often no driver call was needed
+ * @param pool      Pool to check
+ * @param stats     Counters to fill
+ */
+SALAD_EXTERN void saladGetALbufferPoolStats(const SALAD_buffer_pool_type *pool, SALAD_buffer_pool_stats_type *stats);
+
+#endif /* AL_SALAD_BUFFERS_H */
@@ -0,0 +1,126 @@
+/*
+ * salad_capture.h - Threaded audio capture
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AL_SALAD_CAPTURE_H
+#define AL_SALAD_CAPTURE_H 1
+#include <AL/al.h>
+#include <AL/alc.h>
+#include <AL/salad.h>
+
+/**
+ * A capture device drained by a worker thread into a
+ * lock-free ring; the complete definition is private
+ */
+typedef struct SALAD_capture SALAD_capture_type;
+
+/* What a capture has done since it was opened */
+typedef struct SALAD_capture_stats {
+    unsigned long blocks;           /* Blocks drained from the device into the ring */
+    unsigned long frames;           /* Frames read by the consumer */
+    unsigned long overruns;         /* Blocks dropped because the ring was full */
+    unsigned long device_overruns;  /* Times the device buffer was full and may have lost frames */
+    ALuint latency;                 /* Microseconds the oldest frame of the last read had waited */
+    ALuint max_latency;             /* Most microseconds any read frame has waited */
+} SALAD_capture_stats_type;
+
+/**
+ * Opens a capture device and starts a worker thread that
+ * moves what it records into a ring of fixed-size blocks, calling
+ * through the global SALAD_* pointers. The worker wakes twice per
+ * block, so small blocks keep latency low, and the ring absorbs
+ * consumers that stall for up to its length; the device buffer
+ * is as long as the ring on top of that. The capture starts stopped
+ * @param devicename    Capture device to open, NULL for the default one
+ * @param frequency     Sample rate
+ * @param format        Format of the samples, mono or stereo AL_FORMAT_*
+ * @param block         Frames per block
+ * @param count         Number of blocks in the ring, at least two
+ * @returns             The capture, NULL on failure
+ */
+SALAD_EXTERN SALAD_capture_type *saladOpenALcapture(const ALCchar *devicename, ALCuint frequency, ALCenum format, ALsizei block, ALsizei count);
+
+/**
+ * Same as saladOpenALcapture but calls through a function
+ * table loaded with saladLoadALtable; the table must outlive the capture
+ * @param table         Function table to call through
+ * @param devicename    Capture device to open, NULL for the default one
+ * @param frequency     Sample rate
+ * @param format        Format of the samples, mono or stereo AL_FORMAT_*
+ * @param block         Frames per block
+ * @param count         Number of blocks in the ring, at least two
+ * @returns             The capture, NULL on failure
+ */
+SALAD_EXTERN SALAD_capture_type *saladOpenALtableCapture(const SALAD_table_type *table, const ALCchar *devicename, ALCuint frequency, ALCenum format, ALsizei block, ALsizei count);
+
+/**
+ * Stops the worker thread and closes the device;
+ * whatever is left in the ring is dropped
+ * @param capture   Capture to close, may be NULL
+ */
+SALAD_EXTERN void saladCloseALcapture(SALAD_capture_type *capture);
+
+/**
+ * Starts recording; the worker drains the device
+ * from its next wakeup on
+ * @param capture   Capture to start
+ */
+SALAD_EXTERN void saladStartALcapture(SALAD_capture_type *capture);
+
+/**
+ * Stops recording; what has been drained into the
+ * ring can still be read
+ * @param capture   Capture to stop
+ */
+SALAD_EXTERN void saladStopALcapture(SALAD_capture_type *capture);
+
+/**
+ * Counts the frames the ring holds, without locking
+ * @param capture   Capture to check
+ * @returns         Frames there are to be read
+ */
+SALAD_EXTERN ALsizei saladGetALcaptureFrames(SALAD_capture_type *capture);
+
+/**
+ * Reads frames out of the ring, at most as many as it
+ * holds, without locking; only a single thread may read a
+ * capture but it doesn't have to be the one that starts it.
+ * When the consumer falls behind by the whole ring the worker
+ * drops the newest blocks and counts them as overruns
+ * @param capture   Capture to read
+ * @param data      Frames to fill
+ * @param frames    Number of frames to read at most
+ * @returns         Frames read
+ */
+SALAD_EXTERN ALsizei saladReadALcapture(SALAD_capture_type *capture, ALvoid *data, ALsizei frames);
+
+/**
+ * Reads the capture counters; the latencies are those of
+ * the reading thread, so this is meant to be called from it
+ * @param capture   Capture to check
+ * @param stats     Counters to fill
+ */
+SALAD_EXTERN void saladGetALcaptureStats(SALAD_capture_type *capture, SALAD_capture_stats_type *stats);
+
+#endif /* AL_SALAD_CAPTURE_H */
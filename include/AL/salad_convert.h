@@ -0,0 +1,122 @@
+/*
+ * salad_convert.h - Sample format conversion
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AL_SALAD_CONVERT_H
+#define AL_SALAD_CONVERT_H 1
+#include <AL/al.h>
+#include <AL/salad.h>
+
+/* Sets of conversion kernels, the best one the
+ * CPU supports is picked on the first conversion */
+#define SALAD_CONVERT_SCALAR    0x0001U /* Plain C, always available */
+#define SALAD_CONVERT_SSE2      0x0002U /* x86 SSE2 */
+#define SALAD_CONVERT_AVX2      0x0004U /* x86 AVX2, checked at runtime */
+#define SALAD_CONVERT_NEON      0x0008U /* AArch64 NEON */
+
+/**
+ * Gets the kernels this build can run on this CPU
+ * @returns         SALAD_CONVERT_* mask of available kernels
+ */
+SALAD_EXTERN unsigned int saladGetALconvertKernels(void);
+
+/**
+ * Switches every conversion to a specific set of kernels,
+ * for example to compare them; all of them produce exactly
+ * the same output. Oscillators of <AL/salad_oscillator.h> and
+ * resamplers of <AL/salad_resample.h> follow the switch as well.
+ * Not safe while other threads convert
+ * @param kernel    SALAD_CONVERT_* kernel to use, zero for the best one
+ * @returns         SALAD_CONVERT_* kernel in use, unchanged if it's unavailable
+ */
+SALAD_EXTERN unsigned int saladSetALconvertKernel(unsigned int kernel);
+
+/**
+ * Converts float samples to 16-bit ones, scaling
+ * by 32767 and rounding to the nearest even integer;
+ * anything out of [-1, 1] is clamped and NaN is unspecified
+ * @param out       Output samples
+ * @param in        Input samples
+ * @param count     Number of samples
+ */
+SALAD_EXTERN void saladConvertALfloatToShort(ALshort *out, const ALfloat *in, ALsizei count);
+
+/**
+ * Converts 16-bit samples to float ones in [-1, 1)
+ * @param out       Output samples
+ * @param in        Input samples
+ * @param count     Number of samples
+ */
+SALAD_EXTERN void saladConvertALshortToFloat(ALfloat *out, const ALshort *in, ALsizei count);
+
+/**
+ * Converts unsigned 8-bit samples, as in AL_FORMAT_MONO8,
+ * to 16-bit ones
+ * @param out       Output samples
+ * @param in        Input samples
+ * @param count     Number of samples
+ */
+SALAD_EXTERN void saladConvertALbyteToShort(ALshort *out, const ALubyte *in, ALsizei count);
+
+/**
+ * Converts 16-bit samples to unsigned 8-bit ones,
+ * dropping the low byte
+ * @param out       Output samples
+ * @param in        Input samples
+ * @param count     Number of samples
+ */
+SALAD_EXTERN void saladConvertALshortToByte(ALubyte *out, const ALshort *in, ALsizei count);
+
+/**
+ * Interleaves two planar channels into stereo frames
+ * @param out       Output of frames * 2 samples
+ * @param left      Samples of the left channel
+ * @param right     Samples of the right channel
+ * @param frames    Number of frames
+ */
+SALAD_EXTERN void saladInterleaveALshort(ALshort *out, const ALshort *left, const ALshort *right, ALsizei frames);
+
+/**
+ * Splits stereo frames into two planar channels
+ * @param left      Output samples of the left channel
+ * @param right     Output samples of the right channel
+ * @param in        Input of frames * 2 samples
+ * @param frames    Number of frames
+ */
+SALAD_EXTERN void saladDeinterleaveALshort(ALshort *left, ALshort *right, const ALshort *in, ALsizei frames);
+
+/**
+ * Changes the number of channels of interleaved 16-bit frames;
+ * a single channel is copied into every output channel, a single
+ * output channel gets the average of all the input ones and otherwise
+ * the first channels are copied and the rest are silent
+ * @param out           Output of frames * out_channels samples, not overlapping in
+ * @param out_channels  Number of output channels
+ * @param in            Input of frames * in_channels samples
+ * @param in_channels   Number of input channels
+ * @param frames        Number of frames
+ */
+SALAD_EXTERN void saladRemixALshort(ALshort *out, ALsizei out_channels, const ALshort *in, ALsizei in_channels, ALsizei frames);
+
+#endif /* AL_SALAD_CONVERT_H */
@@ -0,0 +1,103 @@
+/*
+ * salad_format.h - Upload format negotiation
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AL_SALAD_FORMAT_H
+#define AL_SALAD_FORMAT_H 1
+#include <AL/al.h>
+#include <AL/salad.h>
+
+/* Sample types of a source layout */
+#define SALAD_SAMPLE_UBYTE      1   /* Unsigned 8-bit */
+#define SALAD_SAMPLE_SHORT      2   /* Signed 16-bit, native byte order */
+#define SALAD_SAMPLE_FLOAT      3   /* 32-bit float in [-1, 1] */
+
+/* Conversion passes between a source layout and its upload format */
+#define SALAD_FORMAT_CONVERT    0x0001U /* Samples change type, float ones are quantized */
+#define SALAD_FORMAT_DOWNMIX    0x0002U /* Channels are mixed down to stereo */
+
+/* What saladChooseALformat picked for a source layout */
+typedef struct SALAD_format {
+    ALsizei channels;           /* Channels of the source */
+    ALenum type;                /* SALAD_SAMPLE_* of the source */
+    ALenum format;              /* AL_FORMAT_* the driver gets */
+    ALsizei format_channels;    /* Channels of the format */
+    ALenum format_type;         /* SALAD_SAMPLE_* of the format */
+    unsigned int passes;        /* SALAD_FORMAT_* passes in between, zero if none */
+} SALAD_format_type;
+
+/**
+ * Picks the cheapest format the current context accepts
+ * for samples of a given layout: the layout itself if the driver
+ * takes it, float samples quantized to 16-bit ones without
+ * AL_EXT_float32 and a stereo downmix of quad, 5.1, 6.1 or 7.1
+ * without AL_EXT_MCFORMATS. Channels are in the AL_EXT_MCFORMATS
+ * order; the downmix drops the LFE channel. The extensions are queried
+ * on every call, so keep the result for as long as the context lives
+ * @param channels  Channels of the source, 1, 2, 4, 6, 7 or 8
+ * @param type      SALAD_SAMPLE_* of the source
+ * @param format    Filled with the chosen format on success
+ * @returns         Zero if the layout is unsupported, non-zero otherwise
+ */
+SALAD_EXTERN int saladChooseALformat(ALsizei channels, ALenum type, SALAD_format_type *format);
+
+/**
+ * Same as saladChooseALformat but calls through
+ * a function table loaded with saladLoadALtable
+ * @param table     Function table to call through
+ * @param channels  Channels of the source, 1, 2, 4, 6, 7 or 8
+ * @param type      SALAD_SAMPLE_* of the source
+ * @param format    Filled with the chosen format on success
+ * @returns         Zero if the layout is unsupported, non-zero otherwise
+ */
+SALAD_EXTERN int saladChooseALtableFormat(const SALAD_table_type *table, ALsizei channels, ALenum type, SALAD_format_type *format);
+
+/**
+ * Fills a buffer with samples of the source layout of a
+ * format chosen by saladChooseALformat; without passes they go
+ * straight to alBufferData, otherwise they're converted into a
+ * temporary copy with the kernels of <AL/salad_convert.h> first
+ * @param format    Format chosen for the samples
+ * @param buffer    Buffer to fill
+ * @param data      Interleaved samples of the source layout
+ * @param frames    Number of frames
+ * @param frequency Sample rate
+ * @returns         Zero on failure, non-zero on success
+ */
+SALAD_EXTERN int saladUploadALsamples(const SALAD_format_type *format, ALuint buffer, const ALvoid *data, ALsizei frames, ALsizei frequency);
+
+/**
+ * Same as saladUploadALsamples but calls through
+ * a function table loaded with saladLoadALtable
+ * @param table     Function table to call through
+ * @param format    Format chosen for the samples
+ * @param buffer    Buffer to fill
+ * @param data      Interleaved samples of the source layout
+ * @param frames    Number of frames
+ * @param frequency Sample rate
+ * @returns         Zero on failure, non-zero on success
+ */
+SALAD_EXTERN int saladUploadALtableSamples(const SALAD_table_type *table, const SALAD_format_type *format, ALuint buffer, const ALvoid *data, ALsizei frames, ALsizei frequency);
+
+#endif /* AL_SALAD_FORMAT_H */
@@ -0,0 +1,115 @@
+/*
+ * salad_oscillator.h - Table-based oscillators
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AL_SALAD_OSCILLATOR_H
+#define AL_SALAD_OSCILLATOR_H 1
+#include <AL/al.h>
+#include <AL/salad.h>
+
+/**
+ * A phase accumulator stepping through a single period
+ * of a wavetable plus optional white noise, rendering mono
+ * blocks with the vector kernels of <AL/salad_convert.h>;
+ * the complete definition is private
+ */
+typedef struct SALAD_oscillator SALAD_oscillator_type;
+
+/* Most harmonics an oscillator can have */
+#define SALAD_OSCILLATOR_HARMONICS 64
+
+/**
+ * Creates a silent oscillator; give it harmonics,
+ * noise or both before rendering anything
+ * @param frequency Sample rate of the output
+ * @returns         The oscillator, NULL on failure
+ */
+SALAD_EXTERN SALAD_oscillator_type *saladCreateALoscillator(ALsizei frequency);
+
+/**
+ * Destroys an oscillator
+ * @param osc       Oscillator to destroy, may be NULL
+ */
+SALAD_EXTERN void saladDestroyALoscillator(SALAD_oscillator_type *osc);
+
+/**
+ * Sets the pitch of the oscillator, the phase carries on
+ * from where it is so changes don't click; harmonics at or
+ * above half the sample rate are left out of the wavetable
+ * so they don't alias, which rebuilds it when that changes
+ * @param osc       Oscillator to change
+ * @param pitch     Frequency of the first harmonic in Hz
+ */
+SALAD_EXTERN void saladSetALoscillatorPitch(SALAD_oscillator_type *osc, ALfloat pitch);
+
+/**
+ * Sets the harmonics of the oscillator and rebuilds its
+ * wavetable; a plain sine is a single harmonic of gain one.
+ * Nothing is normalised, so harmonics adding up past one clip
+ * once the output is converted to 16-bit samples
+ * @param osc       Oscillator to change
+ * @param gains     Gain of every harmonic, the first one at the pitch itself
+ * @param count     Number of harmonics, at most SALAD_OSCILLATOR_HARMONICS
+ * @returns         AL_TRUE on success, AL_FALSE if there are too many harmonics
+ */
+SALAD_EXTERN ALboolean saladSetALoscillatorHarmonics(SALAD_oscillator_type *osc, const ALfloat *gains, ALsizei count);
+
+/**
+ * Sets the gain of white noise added to the harmonics
+ * @param osc       Oscillator to change
+ * @param gain      Peak level of the noise, zero to turn it off
+ */
+SALAD_EXTERN void saladSetALoscillatorNoise(SALAD_oscillator_type *osc, ALfloat gain);
+
+/**
+ * Renders the next float samples of the oscillator
+ * @param osc       Oscillator to render
+ * @param out       Output samples
+ * @param count     Number of samples
+ */
+SALAD_EXTERN void saladRenderALoscillator(SALAD_oscillator_type *osc, ALfloat *out, ALsizei count);
+
+/**
+ * Renders the next 16-bit samples of the oscillator,
+ * ready for AL_FORMAT_MONO16 buffers; anything out of
+ * range is clamped
+ * @param osc       Oscillator to render
+ * @param out       Output samples
+ * @param count     Number of samples
+ */
+SALAD_EXTERN void saladRenderALoscillatorShort(SALAD_oscillator_type *osc, ALshort *out, ALsizei count);
+
+/**
+ * Stream callback rendering an oscillator forever,
+ * pass it to saladCreateALstream with the oscillator as
+ * its argument and AL_FORMAT_MONO16 as the format; the worker
+ * renders it, so only change it while the stream is stopped
+ * @param data      Block to fill
+ * @param size      Size of the block in bytes
+ * @param arg       Oscillator to render
+ * @returns         Bytes written, always a whole number of samples
+ */
+SALAD_EXTERN ALsizei SALAD_APIENTRY saladPullALoscillator(void *data, ALsizei size, void *arg);
+
+#endif /* AL_SALAD_OSCILLATOR_H */
@@ -0,0 +1,188 @@
+/*
+ * salad_pool.h - Source pool with virtual voices
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AL_SALAD_POOL_H
+#define AL_SALAD_POOL_H 1
+#include <AL/al.h>
+#include <AL/salad.h>
+
+/**
+ * A fixed set of real sources shared by any number of
+ * virtual voices; voices describe what should be playing and
+ * saladUpdateALpool hands the real sources to the voices that
+ * matter the most, the complete definition is private
+ */
+typedef struct SALAD_pool SALAD_pool_type;
+
+/* A voice of a pool, zero never names one; a voice
+ * that has been deleted stays invalid even if its slot
+ * is taken over by another voice later on */
+typedef salad_uint32_type SALAD_voice_type;
+
+/* Voice parameter for saladSetALvoicef, outside of
+ * the AL_* parameter range; the priority is multiplied by
+ * how audible a voice is to pick the voices that get a real
+ * source, zero keeps a voice from ever getting one */
+#define SALAD_PRIORITY 0x5A01
+
+/* What a pool has done since it was created */
+typedef struct SALAD_pool_stats {
+    unsigned long voices;   /* Voices that exist */
+    unsigned long playing;  /* Voices that are playing with or without a real source */
+    unsigned long bound;    /* Voices that have a real source */
+    unsigned long binds;    /* Times a voice has got a real source */
+    unsigned long culls;    /* Times a playing voice has lost its real source */
+} SALAD_pool_stats_type;
+
+/**
+ * Creates a pool and generates its real sources through the
+ * global SALAD_* pointers, a context must be current; sources are
+ * generated one at a time until the driver runs out of them, so the
+ * pool may end up with fewer sources than asked for
+ * @param max_sources   Most real sources to generate, zero for as many
+ *                      as ALC_MONO_SOURCES of the current device tells
+ * @returns             The pool, NULL if not a single source could be generated
+ */
+SALAD_EXTERN SALAD_pool_type *saladCreateALpool(ALsizei max_sources);
+
+/**
+ * Same as saladCreateALpool but calls through a function
+ * table loaded with saladLoadALtable; the table must outlive the pool
+ * @param table         Function table to call through
+ * @param max_sources   Most real sources to generate, zero for as many
+ *                      as ALC_MONO_SOURCES of the current device tells
+ * @returns             The pool, NULL if not a single source could be generated
+ */
+SALAD_EXTERN SALAD_pool_type *saladCreateALtablePool(const SALAD_table_type *table, ALsizei max_sources);
+
+/**
+ * Deletes the real sources and every voice of a pool;
+ * the context the pool was created in must be current
+ * @param pool          Pool to destroy, may be NULL
+ */
+SALAD_EXTERN void saladDestroyALpool(SALAD_pool_type *pool);
+
+/**
+ * @param pool          Pool to check
+ * @returns             Number of real sources the pool has
+ */
+SALAD_EXTERN ALsizei saladGetALpoolSources(const SALAD_pool_type *pool);
+
+/**
+ * Creates a stopped voice; it starts with the default
+ * AL source parameters, no buffer and a priority of one
+ * @param pool          Pool to create the voice in
+ * @returns             The voice, zero if out of memory
+ */
+SALAD_EXTERN SALAD_voice_type saladCreateALvoice(SALAD_pool_type *pool);
+
+/**
+ * Deletes a voice, handing its real source back to the pool
+ * @param pool          Pool the voice belongs to
+ * @param voice         Voice to delete
+ */
+SALAD_EXTERN void saladDeleteALvoice(SALAD_pool_type *pool, SALAD_voice_type voice);
+
+/**
+ * Sets a float parameter of a voice; the driver only
+ * sees it on the next saladUpdateALpool
+ * @param pool          Pool the voice belongs to
+ * @param voice         Voice to change
+ * @param param         AL_GAIN, AL_PITCH, AL_REFERENCE_DISTANCE,
+ *                      AL_ROLLOFF_FACTOR, AL_MAX_DISTANCE or SALAD_PRIORITY
+ * @param value         New value, must not be negative
+ * @returns             Zero if the voice, the parameter or the value is invalid
+ */
+SALAD_EXTERN int saladSetALvoicef(SALAD_pool_type *pool, SALAD_voice_type voice, ALenum param, ALfloat value);
+
+/**
+ * Sets a vector parameter of a voice; the driver only
+ * sees it on the next saladUpdateALpool
+ * @param pool          Pool the voice belongs to
+ * @param voice         Voice to change
+ * @param param         AL_POSITION or AL_VELOCITY
+ * @param value1        New X value
+ * @param value2        New Y value
+ * @param value3        New Z value
+ * @returns             Zero if the voice or the parameter is invalid
+ */
+SALAD_EXTERN int saladSetALvoice3f(SALAD_pool_type *pool, SALAD_voice_type voice, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3);
+
+/**
+ * Sets an integer parameter of a voice; changing
+ * the buffer stops the voice
+ * @param pool          Pool the voice belongs to
+ * @param voice         Voice to change
+ * @param param         AL_BUFFER, AL_LOOPING or AL_SOURCE_RELATIVE
+ * @param value         New value
+ * @returns             Zero if the voice, the parameter or the buffer is invalid
+ */
+SALAD_EXTERN int saladSetALvoicei(SALAD_pool_type *pool, SALAD_voice_type voice, ALenum param, ALint value);
+
+/**
+ * Starts a voice from the beginning of its buffer,
+ * it competes for a real source from then on
+ * @param pool          Pool the voice belongs to
+ * @param voice         Voice to play
+ * @returns             Zero if the voice is invalid or has no buffer
+ */
+SALAD_EXTERN int saladPlayALvoice(SALAD_pool_type *pool, SALAD_voice_type voice);
+
+/**
+ * Stops a voice, handing its real source back to the pool
+ * @param pool          Pool the voice belongs to
+ * @param voice         Voice to stop
+ */
+SALAD_EXTERN void saladStopALvoice(SALAD_pool_type *pool, SALAD_voice_type voice);
+
+/**
+ * Checks whether a voice is still playing; a voice without
+ * a real source is playing as long as it would have been heard
+ * @param pool          Pool the voice belongs to
+ * @param voice         Voice to check
+ * @returns             AL_TRUE if the voice is playing, AL_FALSE otherwise
+ */
+SALAD_EXTERN ALboolean saladIsALvoicePlaying(const SALAD_pool_type *pool, SALAD_voice_type voice);
+
+/**
+ * Runs a tick of a pool: finished voices are stopped, voices
+ * without a real source move on by the time that has passed, the
+ * playing voices are ranked by their priority times how audible they
+ * are to the listener and the real sources go to the best ones.
+ * A voice that loses its source keeps its playback position and
+ * resumes from where it would have been when it gets one back
+ * @param pool          Pool to update
+ * @param seconds       Time since the previous update
+ */
+SALAD_EXTERN void saladUpdateALpool(SALAD_pool_type *pool, ALfloat seconds);
+
+/**
+ * Reads the pool counters
+ * @param pool          Pool to check
+ * @param stats         Counters to fill
+ */
+SALAD_EXTERN void saladGetALpoolStats(const SALAD_pool_type *pool, SALAD_pool_stats_type *stats);
+
+#endif /* AL_SALAD_POOL_H */
@@ -0,0 +1,167 @@
+/*
+ * salad_render.h - Offline rendering through loopback devices
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AL_SALAD_RENDER_H
+#define AL_SALAD_RENDER_H 1
+#include <AL/al.h>
+#include <AL/alc.h>
+#include <AL/salad.h>
+
+/**
+ * A loopback device with a context of its own that renders
+ * as fast as it's asked to instead of in real time; needs
+ * ALC_SOFT_loopback, the complete definition is private
+ */
+typedef struct SALAD_renderer SALAD_renderer_type;
+
+/**
+ * A pointer to a function that renders one job of
+ * saladRunALrenderJobs; it's called on a worker thread with
+ * the renderer's context current for that thread, sets up its
+ * scene, renders it and deletes whatever it has created
+ * @param renderer  Renderer of the worker thread
+ * @param index     Index of the job, from zero to count - 1
+ * @param arg       Argument given to saladRunALrenderJobs
+ * @returns         Non-zero if the job succeeded, zero otherwise
+ */
+typedef int (SALAD_APIENTRY *SALAD_render_job_type)(SALAD_renderer_type *renderer, ALsizei index, void *arg);
+
+/**
+ * Opens a loopback device through the global SALAD_*
+ * pointers and creates a context for it
+ * @param frequency Output sample rate
+ * @param channels  Output channels, ALC_MONO_SOFT, ALC_STEREO_SOFT and so on
+ * @param type      Output sample type, ALC_SHORT_SOFT, ALC_FLOAT_SOFT and so on
+ * @returns         The renderer, NULL if the format isn't supported or on failure
+ */
+SALAD_EXTERN SALAD_renderer_type *saladCreateALrenderer(ALCsizei frequency, ALCenum channels, ALCenum type);
+
+/**
+ * Same as saladCreateALrenderer but calls through a function
+ * table loaded with saladLoadALtable; the table must outlive the renderer
+ * @param table     Function table to call through
+ * @param frequency Output sample rate
+ * @param channels  Output channels, ALC_MONO_SOFT, ALC_STEREO_SOFT and so on
+ * @param type      Output sample type, ALC_SHORT_SOFT, ALC_FLOAT_SOFT and so on
+ * @returns         The renderer, NULL if the format isn't supported or on failure
+ */
+SALAD_EXTERN SALAD_renderer_type *saladCreateALtableRenderer(const SALAD_table_type *table, ALCsizei frequency, ALCenum channels, ALCenum type);
+
+/**
+ * Destroys the context of a renderer, making it no longer
+ * current first if it is, and closes its loopback device
+ * @param renderer  Renderer to destroy, may be NULL
+ */
+SALAD_EXTERN void saladDestroyALrenderer(SALAD_renderer_type *renderer);
+
+/**
+ * Makes the context of a renderer current so AL calls set up
+ * its scene; with ALC_EXT_thread_local_context it's only current
+ * for the calling thread and renderers on other threads are left
+ * alone, otherwise it replaces the context of the whole process
+ * @param renderer  Renderer to make current
+ * @returns         Zero on failure, non-zero on success
+ */
+SALAD_EXTERN int saladMakeALrendererCurrent(SALAD_renderer_type *renderer);
+
+/**
+ * Checks whether saladMakeALrendererCurrent only affects
+ * the calling thread, which is what lets several renderers
+ * work from several threads at the same time
+ * @param renderer  Renderer to check
+ * @returns         AL_TRUE if the context is current per thread, AL_FALSE otherwise
+ */
+SALAD_EXTERN ALboolean saladIsALrendererThreadLocal(SALAD_renderer_type *renderer);
+
+/**
+ * Gets the loopback device of a renderer, for example
+ * to pass it to saladLoadALtableDevice
+ * @param renderer  Renderer to query
+ * @returns         The loopback device
+ */
+SALAD_EXTERN ALCdevice *saladGetALrendererDevice(SALAD_renderer_type *renderer);
+
+/**
+ * Gets the size of an output frame of a renderer
+ * @param renderer  Renderer to query
+ * @returns         Bytes per frame of all the channels
+ */
+SALAD_EXTERN ALCsizei saladGetALrendererFrameSize(SALAD_renderer_type *renderer);
+
+/**
+ * Renders the next frames of a renderer's scene into memory
+ * @param renderer  Renderer to render
+ * @param buffer    Output of frames * saladGetALrendererFrameSize bytes
+ * @param frames    Number of frames to render
+ * @returns         Zero on failure, non-zero on success
+ */
+SALAD_EXTERN int saladRenderALmemory(SALAD_renderer_type *renderer, ALCvoid *buffer, ALCsizei frames);
+
+/**
+ * Renders the next frames of a renderer's scene into a WAV file,
+ * a block at a time through a small scratch buffer. Only types a WAV
+ * file can hold are accepted: ALC_UNSIGNED_BYTE_SOFT, ALC_SHORT_SOFT,
+ * ALC_INT_SOFT and ALC_FLOAT_SOFT
+ * @param renderer  Renderer to render
+ * @param path      File to create or overwrite
+ * @param frames    Number of frames to render
+ * @returns         Zero on failure, non-zero on success
+ */
+SALAD_EXTERN int saladRenderALwave(SALAD_renderer_type *renderer, const char *path, ALCsizei frames);
+
+/**
+ * Runs a batch of render jobs through the global SALAD_* pointers
+ * on up to the given number of threads, the calling thread included,
+ * each with a renderer of its own; jobs are handed out in order as
+ * threads become free. Without ALC_EXT_thread_local_context every
+ * job runs on the calling thread, whose current context is restored
+ * afterwards
+ * @param frequency Output sample rate
+ * @param channels  Output channels, ALC_MONO_SOFT, ALC_STEREO_SOFT and so on
+ * @param type      Output sample type, ALC_SHORT_SOFT, ALC_FLOAT_SOFT and so on
+ * @param job       Function that renders a job
+ * @param arg       Optional argument for the function
+ * @param count     Number of jobs
+ * @param threads   Number of threads, zero or one for the calling thread only
+ * @returns         Number of jobs that succeeded
+ */
+SALAD_EXTERN ALsizei saladRunALrenderJobs(ALCsizei frequency, ALCenum channels, ALCenum type, SALAD_render_job_type job, void *arg, ALsizei count, ALsizei threads);
+
+/**
+ * Same as saladRunALrenderJobs but calls through
+ * a function table loaded with saladLoadALtable
+ * @param table     Function table to call through
+ * @param frequency Output sample rate
+ * @param channels  Output channels, ALC_MONO_SOFT, ALC_STEREO_SOFT and so on
+ * @param type      Output sample type, ALC_SHORT_SOFT, ALC_FLOAT_SOFT and so on
+ * @param job       Function that renders a job
+ * @param arg       Optional argument for the function
+ * @param count     Number of jobs
+ * @param threads   Number of threads, zero or one for the calling thread only
+ * @returns         Number of jobs that succeeded
+ */
+SALAD_EXTERN ALsizei saladRunALtableRenderJobs(const SALAD_table_type *table, ALCsizei frequency, ALCenum channels, ALCenum type, SALAD_render_job_type job, void *arg, ALsizei count, ALsizei threads);
+
+#endif /* AL_SALAD_RENDER_H */
@@ -0,0 +1,111 @@
+/*
+ * salad_resample.h - Polyphase sample rate conversion
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AL_SALAD_RESAMPLE_H
+#define AL_SALAD_RESAMPLE_H 1
+#include <AL/al.h>
+#include <AL/salad.h>
+
+/**
+ * A polyphase windowed-sinc filter converting interleaved
+ * frames from one sample rate to another, a block at a time;
+ * the complete definition is private
+ */
+typedef struct SALAD_resampler SALAD_resampler_type;
+
+/* Most channels a resampler can convert at once */
+#define SALAD_RESAMPLE_CHANNELS 8
+
+/**
+ * Creates a resampler; converting assets to the rate the
+ * device mixes at, ALC_FREQUENCY, once when they're loaded
+ * saves the driver from resampling them on every mix
+ * @param in_frequency  Sample rate of the input
+ * @param out_frequency Sample rate of the output, at least an eighth of the input
+ * @param channels      Number of interleaved channels
+ * @returns             The resampler, NULL on failure
+ */
+SALAD_EXTERN SALAD_resampler_type *saladCreateALresampler(ALsizei in_frequency, ALsizei out_frequency, ALsizei channels);
+
+/**
+ * Destroys a resampler
+ * @param resampler Resampler to destroy, may be NULL
+ */
+SALAD_EXTERN void saladDestroyALresampler(SALAD_resampler_type *resampler);
+
+/**
+ * Gets the most frames a single call can write,
+ * for sizing output buffers
+ * @param resampler Resampler to check
+ * @param frames    Number of input frames, zero for a flush
+ * @returns         Output frames that fit any such call
+ */
+SALAD_EXTERN ALsizei saladGetALresamplerOutput(const SALAD_resampler_type *resampler, ALsizei frames);
+
+/**
+ * Resamples the next input frames; the filter looks
+ * ahead, so the output lags behind the input until the
+ * resampler is flushed. Every set of kernels of
+ * <AL/salad_convert.h> is used, their results differ
+ * only in rounding
+ * @param resampler Resampler to run
+ * @param out       Output frames, see saladGetALresamplerOutput
+ * @param in        Input frames
+ * @param frames    Number of input frames
+ * @returns         Number of output frames written
+ */
+SALAD_EXTERN ALsizei saladResampleALfloat(SALAD_resampler_type *resampler, ALfloat *out, const ALfloat *in, ALsizei frames);
+
+/**
+ * Same as saladResampleALfloat for 16-bit frames,
+ * clamping the output if the filter overshoots
+ * @param resampler Resampler to run
+ * @param out       Output frames, see saladGetALresamplerOutput
+ * @param in        Input frames
+ * @param frames    Number of input frames
+ * @returns         Number of output frames written
+ */
+SALAD_EXTERN ALsizei saladResampleALshort(SALAD_resampler_type *resampler, ALshort *out, const ALshort *in, ALsizei frames);
+
+/**
+ * Writes whatever output is still held back by the
+ * filter and resets the resampler for a new input; all
+ * in all ceil(input frames * out_frequency / in_frequency)
+ * frames come out of a resampler between flushes
+ * @param resampler Resampler to flush
+ * @param out       Output frames, see saladGetALresamplerOutput
+ * @returns         Number of output frames written
+ */
+SALAD_EXTERN ALsizei saladFlushALresampler(SALAD_resampler_type *resampler, ALfloat *out);
+
+/**
+ * Same as saladFlushALresampler for 16-bit frames
+ * @param resampler Resampler to flush
+ * @param out       Output frames, see saladGetALresamplerOutput
+ * @returns         Number of output frames written
+ */
+SALAD_EXTERN ALsizei saladFlushALresamplerShort(SALAD_resampler_type *resampler, ALshort *out);
+
+#endif /* AL_SALAD_RESAMPLE_H */
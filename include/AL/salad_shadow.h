@@ -0,0 +1,75 @@
+/*
+ * salad_shadow.h - Shadow state for source and listener parameters
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AL_SALAD_SHADOW_H
+#define AL_SALAD_SHADOW_H 1
+#include <AL/salad.h>
+
+/* What the shadow state has done since it was enabled
+ * or since the last call to saladResetALshadowStats */
+typedef struct SALAD_shadow_stats {
+    unsigned long writes;           /* Float source and listener setter calls */
+    unsigned long skipped_writes;   /* Setter calls that set what was already set */
+    unsigned long reads;            /* Float source and listener getter calls */
+    unsigned long cached_reads;     /* Getter calls answered from the shadow state */
+} SALAD_shadow_stats_type;
+
+/**
+ * Puts a shadow state in front of the global SALAD_* source
+ * and listener functions; it keeps a copy of the float parameters
+ * that have been set (gains, distances, cone angles, positions,
+ * velocities, directions and the orientation), drops setter calls
+ * that don't change anything and answers getters of those parameters
+ * itself. The copy is dropped when a source is deleted and whenever
+ * the current context changes, through alcSetThreadContext as well. A value out of the range the
+ * specification allows is passed on without being cached.
+ * Must be called after loading, any global loader replaces the
+ * shadowing functions again. After saladLoadALlazy the functions
+ * it shadows are resolved right away instead of on their first call;
+ * the shadow state has no locks of its own and must only be used
+ * from a single thread
+ * @returns         Zero if the functions it needs aren't loaded
+ *                  or can't be resolved, non-zero otherwise
+ */
+SALAD_EXTERN int saladEnableALshadow(void);
+
+/**
+ * Puts back whatever functions saladEnableALshadow
+ * has replaced, unless they've been reloaded since
+ */
+SALAD_EXTERN void saladDisableALshadow(void);
+
+/**
+ * Reads the shadow state counters
+ * @param stats     Counters to fill
+ */
+SALAD_EXTERN void saladGetALshadowStats(SALAD_shadow_stats_type *stats);
+
+/**
+ * Resets the shadow state counters to zero
+ */
+SALAD_EXTERN void saladResetALshadowStats(void);
+
+#endif /* AL_SALAD_SHADOW_H */
@@ -0,0 +1,179 @@
+/*
+ * salad_stream.h - Background streaming through buffer queues
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AL_SALAD_STREAM_H
+#define AL_SALAD_STREAM_H 1
+#include <AL/al.h>
+#include <AL/salad.h>
+
+/**
+ * A worker thread that keeps any number of streams fed;
+ * the complete definition is private
+ */
+typedef struct SALAD_streamer SALAD_streamer_type;
+
+/**
+ * A source that plays whatever a callback pulls in, a block
+ * at a time through a ring of buffers queued on the source;
+ * the complete definition is private
+ */
+typedef struct SALAD_stream SALAD_stream_type;
+
+/**
+ * A pointer to a function that pulls the next block of a stream;
+ * it's called on the worker thread with the worker locked, so it
+ * should only copy or decode what's already at hand
+ * @param data      Block to fill
+ * @param size      Size of the block in bytes, a whole number of frames
+ * @param arg       Argument given to saladCreateALstream
+ * @returns         Bytes written, anything less than size ends the stream
+ */
+typedef ALsizei (SALAD_APIENTRY *SALAD_stream_callback_type)(void *data, ALsizei size, void *arg);
+
+/* What a stream has done since it was created */
+typedef struct SALAD_stream_stats {
+    unsigned long blocks;       /* Blocks pulled from the callback and queued */
+    unsigned long bytes;        /* Bytes pulled from the callback */
+    unsigned long underruns;    /* Times the source ran dry and had to be restarted */
+} SALAD_stream_stats_type;
+
+/**
+ * Starts a worker thread calling through the global SALAD_*
+ * pointers; the worker calls into whatever context is current, so
+ * the context the streams were created in must stay current
+ * @param period    Milliseconds between refills, zero for a default
+ * @returns         The streamer, NULL if the thread couldn't be started
+ */
+SALAD_EXTERN SALAD_streamer_type *saladCreateALstreamer(ALuint period);
+
+/**
+ * Same as saladCreateALstreamer but calls through a function
+ * table loaded with saladLoadALtable; the table must outlive the streamer
+ * @param table     Function table to call through
+ * @param period    Milliseconds between refills, zero for a default
+ * @returns         The streamer, NULL if the thread couldn't be started
+ */
+SALAD_EXTERN SALAD_streamer_type *saladCreateALtableStreamer(const SALAD_table_type *table, ALuint period);
+
+/**
+ * Stops the worker thread and deletes every stream
+ * that's left, see saladDeleteALstream
+ * @param streamer  Streamer to destroy, may be NULL
+ */
+SALAD_EXTERN void saladDestroyALstreamer(SALAD_streamer_type *streamer);
+
+/**
+ * Creates a stopped stream playing on an existing source;
+ * the source must not be used for anything else while the stream
+ * lives. Its buffers are generated at once and never reallocated
+ * @param streamer  Streamer to feed the stream
+ * @param source    Source to queue buffers on
+ * @param format    Format of the data the callback writes, AL_FORMAT_*
+ * @param frequency Sample rate of the data
+ * @param size      Bytes per block, a whole number of frames
+ * @param count     Number of blocks in the ring, at least two
+ * @param callback  Function that pulls the next block
+ * @param arg       Optional argument for the function
+ * @returns         The stream, NULL on failure
+ */
+SALAD_EXTERN SALAD_stream_type *saladCreateALstream(SALAD_streamer_type *streamer, ALuint source, ALenum format, ALsizei frequency, ALsizei size, ALsizei count, SALAD_stream_callback_type callback, void *arg);
+
+/**
+ * Creates a stopped stream fed by saladWriteALstream
+ * instead of a callback; the data goes through a lock-free
+ * ring that the driver reads straight from its mixer when it
+ * supports AL_SOFT_callback_buffer, otherwise the worker queues
+ * it in blocks of a quarter of the ring like any other stream.
+ * Whenever the ring runs dry silence is played in its place
+ * and counted as an underrun, the stream never ends on its own
+ * @param streamer  Streamer to feed the stream
+ * @param source    Source to play on, taken over by the stream
+ * @param format    Format of the data, AL_FORMAT_MONO8, AL_FORMAT_MONO16,
+ *                  AL_FORMAT_STEREO8, AL_FORMAT_STEREO16 or one of
+ *                  AL_EXT_float32 and AL_EXT_MCFORMATS
+ * @param frequency Sample rate of the data
+ * @param size      Size of the ring in bytes, at least four frames
+ * @returns         The stream, NULL on failure
+ */
+SALAD_EXTERN SALAD_stream_type *saladCreateALringStream(SALAD_streamer_type *streamer, ALuint source, ALenum format, ALsizei frequency, ALsizei size);
+
+/**
+ * Writes data into the ring of a ring stream, at most
+ * as much as fits; only a single thread may write a stream
+ * but it doesn't have to be the one that plays or stops it
+ * @param stream    Ring stream to write
+ * @param data      Data in the format of the stream
+ * @param size      Size of the data in bytes
+ * @returns         Bytes written, a whole number of frames
+ */
+SALAD_EXTERN ALsizei saladWriteALstream(SALAD_stream_type *stream, const ALvoid *data, ALsizei size);
+
+/**
+ * Checks whether the driver reads a ring stream by itself
+ * through AL_SOFT_callback_buffer; such a stream doesn't count
+ * blocks and bytes since the worker never sees its data
+ * @param stream    Stream to check
+ * @returns         AL_TRUE if the driver pulls the data, AL_FALSE otherwise
+ */
+SALAD_EXTERN ALboolean saladIsALstreamDirect(SALAD_stream_type *stream);
+
+/**
+ * Stops a stream, unqueues its buffers from the source
+ * and deletes them; the source itself is left alone
+ * @param stream    Stream to delete, may be NULL
+ */
+SALAD_EXTERN void saladDeleteALstream(SALAD_stream_type *stream);
+
+/**
+ * Starts a stream; the worker fills the whole ring from
+ * the callback and plays the source on its next wakeup.
+ * A stream that ended starts pulling from the callback again
+ * @param stream    Stream to play
+ */
+SALAD_EXTERN void saladPlayALstream(SALAD_stream_type *stream);
+
+/**
+ * Stops a stream and unqueues its buffers right away,
+ * whatever has been pulled but not played is dropped
+ * @param stream    Stream to stop
+ */
+SALAD_EXTERN void saladStopALstream(SALAD_stream_type *stream);
+
+/**
+ * Checks whether a stream is playing; it stops playing once
+ * the callback has ended it and every block has been played
+ * @param stream    Stream to check
+ * @returns         AL_TRUE if the stream is playing, AL_FALSE otherwise
+ */
+SALAD_EXTERN ALboolean saladIsALstreamPlaying(SALAD_stream_type *stream);
+
+/**
+ * Reads the stream counters
+ * @param stream    Stream to check
+ * @param stats     Counters to fill
+ */
+SALAD_EXTERN void saladGetALstreamStats(SALAD_stream_type *stream, SALAD_stream_stats_type *stats);
+
+#endif /* AL_SALAD_STREAM_H */
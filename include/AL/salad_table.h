@@ -0,0 +1,184 @@
+/*
+ * salad_table.h - Per-instance OpenAL function tables
+ * Copyright (C) 2021-2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* Generated by salad_gen from gen/salad.reg, do not edit */
+#ifndef AL_SALAD_TABLE_H
+#define AL_SALAD_TABLE_H 1
+#include <AL/al.h>
+#include <AL/alc.h>
+#include <AL/efx.h>
+#include <AL/alext.h>
+#include <AL/salad.h>
+
+/**
+ * A complete set of OpenAL function pointers resolved from
+ * a single implementation; unlike the global SALAD_* pointers
+ * any number of tables can be loaded side by side, one per driver,
+ * and called through directly: table.alSourcef(source, AL_GAIN, 1.0f)
+ */
+struct SALAD_table {
+    /* Core OpenAL functions <AL/al.h> */
+    PFN_alBuffer3f             alBuffer3f;
+    PFN_alBuffer3i             alBuffer3i;
+    PFN_alBufferData           alBufferData;
+    PFN_alBufferf              alBufferf;
+    PFN_alBufferfv             alBufferfv;
+    PFN_alBufferi              alBufferi;
+    PFN_alBufferiv             alBufferiv;
+    PFN_alDeleteBuffers        alDeleteBuffers;
+    PFN_alDeleteSources        alDeleteSources;
+    PFN_alDisable              alDisable;
+    PFN_alEnable               alEnable;
+    PFN_alGenBuffers           alGenBuffers;
+    PFN_alGenSources           alGenSources;
+    PFN_alGetBoolean           alGetBoolean;
+    PFN_alGetBooleanv          alGetBooleanv;
+    PFN_alGetBuffer3f          alGetBuffer3f;
+    PFN_alGetBuffer3i          alGetBuffer3i;
+    PFN_alGetBufferf           alGetBufferf;
+    PFN_alGetBufferfv          alGetBufferfv;
+    PFN_alGetBufferi           alGetBufferi;
+    PFN_alGetBufferiv          alGetBufferiv;
+    PFN_alGetDouble            alGetDouble;
+    PFN_alGetDoublev           alGetDoublev;
+    PFN_alGetEnumValue         alGetEnumValue;
+    PFN_alGetError             alGetError;
+    PFN_alGetFloat             alGetFloat;
+    PFN_alGetFloatv            alGetFloatv;
+    PFN_alGetInteger           alGetInteger;
+    PFN_alGetIntegerv          alGetIntegerv;
+    PFN_alGetListener3f        alGetListener3f;
+    PFN_alGetListener3i        alGetListener3i;
+    PFN_alGetListenerf         alGetListenerf;
+    PFN_alGetListenerfv        alGetListenerfv;
+    PFN_alGetListeneri         alGetListeneri;
+    PFN_alGetListeneriv        alGetListeneriv;
+    PFN_alGetProcAddress       alGetProcAddress;
+    PFN_alGetSource3f          alGetSource3f;
+    PFN_alGetSource3i          alGetSource3i;
+    PFN_alGetSourcef           alGetSourcef;
+    PFN_alGetSourcefv          alGetSourcefv;
+    PFN_alGetSourcei           alGetSourcei;
+    PFN_alGetSourceiv          alGetSourceiv;
+    PFN_alGetString            alGetString;
+    PFN_alIsBuffer             alIsBuffer;
+    PFN_alIsEnabled            alIsEnabled;
+    PFN_alIsExtensionPresent   alIsExtensionPresent;
+    PFN_alIsSource             alIsSource;
+    PFN_alListener3f           alListener3f;
+    PFN_alListener3i           alListener3i;
+    PFN_alListenerf            alListenerf;
+    PFN_alListenerfv           alListenerfv;
+    PFN_alListeneri            alListeneri;
+    PFN_alListeneriv           alListeneriv;
+    PFN_alSource3f             alSource3f;
+    PFN_alSource3i             alSource3i;
+    PFN_alSourcef              alSourcef;
+    PFN_alSourcefv             alSourcefv;
+    PFN_alSourcei              alSourcei;
+    PFN_alSourceiv             alSourceiv;
+    PFN_alSourcePause          alSourcePause;
+    PFN_alSourcePausev         alSourcePausev;
+    PFN_alSourcePlay           alSourcePlay;
+    PFN_alSourcePlayv          alSourcePlayv;
+    PFN_alSourceQueueBuffers   alSourceQueueBuffers;
+    PFN_alSourceRewind         alSourceRewind;
+    PFN_alSourceRewindv        alSourceRewindv;
+    PFN_alSourceStop           alSourceStop;
+    PFN_alSourceStopv          alSourceStopv;
+    PFN_alSourceUnqueueBuffers alSourceUnqueueBuffers;
+
+    /* Context OpenAL functions <AL/alc.h> */
+    PFN_alcCloseDevice        alcCloseDevice;
+    PFN_alcCreateContext      alcCreateContext;
+    PFN_alcDestroyContext     alcDestroyContext;
+    PFN_alcGetContextsDevice  alcGetContextsDevice;
+    PFN_alcGetCurrentContext  alcGetCurrentContext;
+    PFN_alcGetEnumValue       alcGetEnumValue;
+    PFN_alcGetError           alcGetError;
+    PFN_alcGetIntegerv        alcGetIntegerv;
+    PFN_alcGetProcAddress     alcGetProcAddress;
+    PFN_alcGetString          alcGetString;
+    PFN_alcIsExtensionPresent alcIsExtensionPresent;
+    PFN_alcMakeContextCurrent alcMakeContextCurrent;
+    PFN_alcOpenDevice         alcOpenDevice;
+    PFN_alcProcessContext     alcProcessContext;
+    PFN_alcSuspendContext     alcSuspendContext;
+
+    /* Capture OpenAL functions <AL/alc.h> */
+    PFN_alcCaptureCloseDevice alcCaptureCloseDevice;
+    PFN_alcCaptureOpenDevice  alcCaptureOpenDevice;
+    PFN_alcCaptureSamples     alcCaptureSamples;
+    PFN_alcCaptureStart       alcCaptureStart;
+    PFN_alcCaptureStop        alcCaptureStop;
+
+    /* Extension: ALC_EXT_EFX <AL/efx.h> */
+    PFN_alDeleteEffects alDeleteEffects;
+    PFN_alDeleteFilters alDeleteFilters;
+    PFN_alEffectf       alEffectf;
+    PFN_alEffectfv      alEffectfv;
+    PFN_alEffecti       alEffecti;
+    PFN_alEffectiv      alEffectiv;
+    PFN_alFilterf       alFilterf;
+    PFN_alFilterfv      alFilterfv;
+    PFN_alFilteri       alFilteri;
+    PFN_alFilteriv      alFilteriv;
+    PFN_alGenEffects    alGenEffects;
+    PFN_alGenFilters    alGenFilters;
+    PFN_alGetEffectf    alGetEffectf;
+    PFN_alGetEffectfv   alGetEffectfv;
+    PFN_alGetEffecti    alGetEffecti;
+    PFN_alGetEffectiv   alGetEffectiv;
+    PFN_alGetFilterf    alGetFilterf;
+    PFN_alGetFilterfv   alGetFilterfv;
+    PFN_alGetFilteri    alGetFilteri;
+    PFN_alGetFilteriv   alGetFilteriv;
+    PFN_alIsEffect      alIsEffect;
+    PFN_alIsFilter      alIsFilter;
+
+    /* Extension: AL_SOFT_deferred_updates <AL/alext.h> */
+    PFN_alDeferUpdatesSOFT   alDeferUpdatesSOFT;
+    PFN_alProcessUpdatesSOFT alProcessUpdatesSOFT;
+
+    /* Extension: ALC_SOFT_loopback <AL/alext.h> */
+    PFN_alcIsRenderFormatSupportedSOFT alcIsRenderFormatSupportedSOFT;
+    PFN_alcLoopbackOpenDeviceSOFT      alcLoopbackOpenDeviceSOFT;
+    PFN_alcRenderSamplesSOFT           alcRenderSamplesSOFT;
+
+    /* Extension: AL_SOFT_callback_buffer <AL/alext.h> */
+    PFN_alBufferCallbackSOFT alBufferCallbackSOFT;
+    PFN_alGetBuffer3PtrSOFT  alGetBuffer3PtrSOFT;
+    PFN_alGetBufferPtrSOFT   alGetBufferPtrSOFT;
+    PFN_alGetBufferPtrvSOFT  alGetBufferPtrvSOFT;
+
+    /* Extension: ALC_EXT_thread_local_context <AL/alext.h> */
+    PFN_alcGetThreadContext alcGetThreadContext;
+    PFN_alcSetThreadContext alcSetThreadContext;
+
+    /* Extension: AL_EXT_STATIC_BUFFER <AL/alext.h> */
+    PFN_alBufferDataStatic alBufferDataStatic;
+};
+
+#endif /* AL_SALAD_TABLE_H */
@@ -0,0 +1,131 @@
+/*
+ * salad_wave.h - Memory-mapped WAV files
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef AL_SALAD_WAVE_H
+#define AL_SALAD_WAVE_H 1
+#include <stddef.h>
+#include <AL/al.h>
+#include <AL/salad.h>
+
+/**
+ * A WAV file mapped into memory read-only;
+ * the complete definition is private
+ */
+typedef struct SALAD_wave SALAD_wave_type;
+
+/* What saladParseALwave found, pointing into the file */
+typedef struct SALAD_wave_info {
+    ALenum format;              /* AL_FORMAT_* of the samples */
+    ALsizei frequency;          /* Sample rate */
+    ALsizei size;               /* Bytes of sample data, a whole number of frames */
+    ALsizei frames;             /* Number of frames */
+    const ALvoid *data;         /* First sample, inside the file and not a copy */
+} SALAD_wave_info_type;
+
+/* What saladUploadALwave did with the samples */
+#define SALAD_WAVE_COPIED   1   /* Copied by alBufferData */
+#define SALAD_WAVE_STATIC   2   /* Referenced by alBufferDataStatic */
+
+/**
+ * Validates a RIFF WAVE image in memory without copying anything;
+ * unsigned 8-bit and signed 16-bit PCM mono and stereo are accepted,
+ * WAVE_FORMAT_EXTENSIBLE included. A data chunk running past the end
+ * of the image, as written by a recorder that never finished, is cut
+ * down to the whole frames that are there
+ * @param data      RIFF image
+ * @param size      Size of the image in bytes
+ * @param info      Filled with the format and the sample region on success
+ * @returns         Zero if the image is malformed or unsupported, non-zero otherwise
+ */
+SALAD_EXTERN int saladParseALwave(const void *data, size_t size, SALAD_wave_info_type *info);
+
+/**
+ * Maps a WAV file into memory and parses it; the samples
+ * are only read from disk when something touches them
+ * @param path      File to open
+ * @returns         The mapped file, NULL if it can't be mapped or parsed
+ */
+SALAD_EXTERN SALAD_wave_type *saladOpenALwave(const char *path);
+
+/**
+ * Unmaps a WAV file; a buffer that was given its samples
+ * with SALAD_WAVE_STATIC must have been deleted or refilled
+ * @param wave      Mapped file to close, may be NULL
+ */
+SALAD_EXTERN void saladCloseALwave(SALAD_wave_type *wave);
+
+/**
+ * Gets what parsing a mapped WAV file has found
+ * @param wave      Mapped file to query
+ * @param info      Filled with the format and the sample region
+ */
+SALAD_EXTERN void saladGetALwaveInfo(SALAD_wave_type *wave, SALAD_wave_info_type *info);
+
+/**
+ * Fills a buffer with the samples of a mapped WAV file through
+ * the global SALAD_* pointers; with AL_EXT_STATIC_BUFFER the driver
+ * plays straight from the mapping, otherwise alBufferData copies it
+ * once from the mapping without a heap buffer in between
+ * @param wave      Mapped file to upload
+ * @param buffer    Buffer to fill
+ * @returns         Zero on failure, SALAD_WAVE_COPIED or SALAD_WAVE_STATIC on success
+ */
+SALAD_EXTERN int saladUploadALwave(SALAD_wave_type *wave, ALuint buffer);
+
+/**
+ * Same as saladUploadALwave but calls through
+ * a function table loaded with saladLoadALtable
+ * @param table     Function table to call through
+ * @param wave      Mapped file to upload
+ * @param buffer    Buffer to fill
+ * @returns         Zero on failure, SALAD_WAVE_COPIED or SALAD_WAVE_STATIC on success
+ */
+SALAD_EXTERN int saladUploadALtableWave(const SALAD_table_type *table, SALAD_wave_type *wave, ALuint buffer);
+
+/**
+ * Same as saladUploadALwave but resamples the samples to
+ * another rate first, usually the ALC_FREQUENCY of the device,
+ * so the driver doesn't have to while mixing; the buffer gets
+ * 16-bit samples copied by alBufferData then. Nothing is
+ * resampled if the rates already match
+ * @param wave      Mapped file to upload
+ * @param buffer    Buffer to fill
+ * @param frequency Sample rate to upload at, zero to keep the rate of the file
+ * @returns         Zero on failure, SALAD_WAVE_COPIED or SALAD_WAVE_STATIC on success
+ */
+SALAD_EXTERN int saladUploadALwaveAt(SALAD_wave_type *wave, ALuint buffer, ALsizei frequency);
+
+/**
+ * Same as saladUploadALwaveAt but calls through
+ * a function table loaded with saladLoadALtable
+ * @param table     Function table to call through
+ * @param wave      Mapped file to upload
+ * @param buffer    Buffer to fill
+ * @param frequency Sample rate to upload at, zero to keep the rate of the file
+ * @returns         Zero on failure, SALAD_WAVE_COPIED or SALAD_WAVE_STATIC on success
+ */
+SALAD_EXTERN int saladUploadALtableWaveAt(const SALAD_table_type *table, SALAD_wave_type *wave, ALuint buffer, ALsizei frequency);
+
+#endif /* AL_SALAD_WAVE_H */
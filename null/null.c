@@ -0,0 +1,3450 @@
+/*
+ * null.c - null OpenAL implementation and software renderer
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <AL/al.h>
+#include <AL/alc.h>
+#include <AL/alext.h>
+#include <AL/efx.h>
+
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define NULL_SSE 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define NULL_NEON 1
+#endif
+
+#include "salad_platform.h"
+
+#if SALAD_POSIX
+#include <time.h>
+#endif
+
+/* Built into salad itself with SALAD_SOFTWARE the
+ * entry points are private and only reachable through
+ * salad_software_loadfunc, so nothing clashes with a
+ * system OpenAL library loaded into the same process */
+#if defined(SALAD_SOFTWARE)
+#define NULL_EXPORT         static
+#define NULL_API(name)      salad_software_##name
+#else
+#define NULL_EXPORT
+#define NULL_API(name)      name
+#endif
+
+/* Every object lives in a fixed flat array and its
+ * name is the array index plus one; object names are
+ * shared between all the devices and contexts */
+#define NULL_MAX_DEVICES    8
+#define NULL_MAX_CONTEXTS   8
+#define NULL_MAX_SOURCES    256
+#define NULL_MAX_BUFFERS    4096
+#define NULL_MAX_EFFECTS    256
+#define NULL_MAX_FILTERS    256
+#define NULL_MAX_QUEUE      64
+
+#define NULL_FREQUENCY      44100
+#define NULL_REFRESH        50
+#define NULL_EFFECT_VALUES  16
+#define NULL_FILTER_VALUES  4
+
+/* Loopback devices are rendered in blocks of NULL_BLOCK
+ * frames; sources are resampled with a fixed-point step
+ * of FRACTION_BITS and a pitch of at most NULL_MAX_PITCH */
+#define NULL_BLOCK          256
+#define NULL_MAX_PITCH      255
+#define FRACTION_BITS       16
+#define FRACTION_ONE        (1 << FRACTION_BITS)
+#define FRACTION_MASK       (FRACTION_ONE - 1)
+
+#define NULL_OUTPUT_NAME    "Null Output"
+#define NULL_CAPTURE_NAME   "Null Capture"
+
+/* Parameter flags */
+#define PARAM_INT           0x0001
+
+enum {
+    SOURCE_PITCH,
+    SOURCE_GAIN,
+    SOURCE_MIN_GAIN,
+    SOURCE_MAX_GAIN,
+    SOURCE_REFERENCE_DISTANCE,
+    SOURCE_ROLLOFF_FACTOR,
+    SOURCE_MAX_DISTANCE,
+    SOURCE_CONE_INNER_ANGLE,
+    SOURCE_CONE_OUTER_ANGLE,
+    SOURCE_CONE_OUTER_GAIN,
+    SOURCE_POSITION,
+    SOURCE_VELOCITY = SOURCE_POSITION + 3,
+    SOURCE_DIRECTION = SOURCE_VELOCITY + 3,
+    SOURCE_RELATIVE = SOURCE_DIRECTION + 3,
+    SOURCE_LOOPING,
+    SOURCE_SEC_OFFSET,
+    SOURCE_SAMPLE_OFFSET,
+    SOURCE_BYTE_OFFSET,
+    SOURCE_DIRECT_FILTER,
+    SOURCE_DIRECT_FILTER_GAINHF_AUTO,
+    SOURCE_AUXILIARY_SEND_FILTER_GAIN_AUTO,
+    SOURCE_AUXILIARY_SEND_FILTER_GAINHF_AUTO,
+    SOURCE_AIR_ABSORPTION_FACTOR,
+    SOURCE_ROOM_ROLLOFF_FACTOR,
+    SOURCE_CONE_OUTER_GAINHF,
+    SOURCE_VALUES
+};
+
+enum {
+    LISTENER_GAIN,
+    LISTENER_POSITION,
+    LISTENER_VELOCITY = LISTENER_POSITION + 3,
+    LISTENER_ORIENTATION = LISTENER_VELOCITY + 3,
+    LISTENER_METERS_PER_UNIT = LISTENER_ORIENTATION + 6,
+    LISTENER_VALUES
+};
+
+/* A parameter kept as floats in a value array;
+ * integer parameters are stored the same way since
+ * every value they take is exactly representable */
+struct null_param {
+    ALenum param;
+    int index;
+    int count;
+    int flags;
+    ALfloat initial;
+};
+
+/* Samples are kept as interleaved floats, whatever
+ * the format they were uploaded in, so that the mixer
+ * only ever has to deal with a single sample type; a
+ * callback buffer only holds the block it pulled last */
+struct null_buffer {
+    ALint frequency;
+    ALint bits;
+    ALint channels;
+    ALint size;
+    ALint refs;
+    ALfloat *samples;
+    ALsizei frames;
+    ALBUFFERCALLBACKTYPESOFT callback;
+    ALvoid *userptr;
+    int ended;
+};
+
+struct null_source {
+    ALfloat values[SOURCE_VALUES];
+    ALenum state;
+    ALenum type;
+    ALCcontext *context;
+    ALuint queue[NULL_MAX_QUEUE];
+    ALsizei queued;
+    ALsizei processed;
+    ALsizei current;
+    ALsizei position;
+    ALuint fraction;
+    ALenum offset;
+};
+
+struct null_effect {
+    ALint type;
+    ALfloat values[NULL_EFFECT_VALUES];
+};
+
+struct null_filter {
+    ALint type;
+    ALfloat values[NULL_FILTER_VALUES];
+};
+
+struct ALCdevice {
+    int used;
+    int capture;
+    int capturing;
+    int loopback;
+    ALCenum channels;
+    ALCenum type;
+    ALCenum error;
+    ALCint frequency;
+    ALCint frame_size;
+    ALCint silence;
+    ALCsizei capture_size;
+    double capture_clock;       /* When the next frame to be captured was recorded */
+};
+
+struct ALCcontext {
+    int used;
+    ALCdevice *device;
+    ALenum error;
+    ALboolean deferred;
+    ALfloat listener[LISTENER_VALUES];
+};
+
+struct null_name {
+    const char *name;
+    ALenum value;
+    void (*proc)(void);
+};
+
+static const struct null_param source_params[] = {
+    { AL_PITCH,                                 SOURCE_PITCH,                                   1, 0,           1.0f            },
+    { AL_GAIN,                                  SOURCE_GAIN,                                    1, 0,           1.0f            },
+    { AL_MIN_GAIN,                              SOURCE_MIN_GAIN,                                1, 0,           0.0f            },
+    { AL_MAX_GAIN,                              SOURCE_MAX_GAIN,                                1, 0,           1.0f            },
+    { AL_REFERENCE_DISTANCE,                    SOURCE_REFERENCE_DISTANCE,                      1, 0,           1.0f            },
+    { AL_ROLLOFF_FACTOR,                        SOURCE_ROLLOFF_FACTOR,                          1, 0,           1.0f            },
+    { AL_MAX_DISTANCE,                          SOURCE_MAX_DISTANCE,                            1, 0,           FLT_MAX         },
+    { AL_CONE_INNER_ANGLE,                      SOURCE_CONE_INNER_ANGLE,                        1, 0,           360.0f          },
+    { AL_CONE_OUTER_ANGLE,                      SOURCE_CONE_OUTER_ANGLE,                        1, 0,           360.0f          },
+    { AL_CONE_OUTER_GAIN,                       SOURCE_CONE_OUTER_GAIN,                         1, 0,           0.0f            },
+    { AL_POSITION,                              SOURCE_POSITION,                                3, 0,           0.0f            },
+    { AL_VELOCITY,                              SOURCE_VELOCITY,                                3, 0,           0.0f            },
+    { AL_DIRECTION,                             SOURCE_DIRECTION,                               3, 0,           0.0f            },
+    { AL_SOURCE_RELATIVE,                       SOURCE_RELATIVE,                                1, PARAM_INT,   0.0f            },
+    { AL_LOOPING,                               SOURCE_LOOPING,                                 1, PARAM_INT,   0.0f            },
+    { AL_SEC_OFFSET,                            SOURCE_SEC_OFFSET,                              1, 0,           0.0f            },
+    { AL_SAMPLE_OFFSET,                         SOURCE_SAMPLE_OFFSET,                           1, 0,           0.0f            },
+    { AL_BYTE_OFFSET,                           SOURCE_BYTE_OFFSET,                             1, 0,           0.0f            },
+    { AL_DIRECT_FILTER,                         SOURCE_DIRECT_FILTER,                           1, PARAM_INT,   0.0f            },
+    { AL_DIRECT_FILTER_GAINHF_AUTO,             SOURCE_DIRECT_FILTER_GAINHF_AUTO,               1, PARAM_INT,   1.0f            },
+    { AL_AUXILIARY_SEND_FILTER_GAIN_AUTO,       SOURCE_AUXILIARY_SEND_FILTER_GAIN_AUTO,         1, PARAM_INT,   1.0f            },
+    { AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO,     SOURCE_AUXILIARY_SEND_FILTER_GAINHF_AUTO,       1, PARAM_INT,   1.0f            },
+    { AL_AIR_ABSORPTION_FACTOR,                 SOURCE_AIR_ABSORPTION_FACTOR,                   1, 0,           0.0f            },
+    { AL_ROOM_ROLLOFF_FACTOR,                   SOURCE_ROOM_ROLLOFF_FACTOR,                     1, 0,           0.0f            },
+    { AL_CONE_OUTER_GAINHF,                     SOURCE_CONE_OUTER_GAINHF,                       1, 0,           1.0f            },
+    { 0, 0, 0, 0, 0.0f }
+};
+
+static const struct null_param listener_params[] = {
+    { AL_GAIN,                                  LISTENER_GAIN,                                  1, 0,           1.0f            },
+    { AL_POSITION,                              LISTENER_POSITION,                              3, 0,           0.0f            },
+    { AL_VELOCITY,                              LISTENER_VELOCITY,                              3, 0,           0.0f            },
+    { AL_ORIENTATION,                           LISTENER_ORIENTATION,                           6, 0,           0.0f            },
+    { AL_METERS_PER_UNIT,                       LISTENER_METERS_PER_UNIT,                       1, 0,           1.0f            },
+    { 0, 0, 0, 0, 0.0f }
+};
+
+static const char al_extensions[] = "AL_EXT_STATIC_BUFFER AL_EXT_float32 AL_SOFT_callback_buffer AL_SOFT_deferred_updates";
+#if defined(SALAD_THREAD_LOCAL)
+static const char alc_extensions[] = "ALC_ENUMERATE_ALL_EXT ALC_ENUMERATION_EXT ALC_EXT_CAPTURE ALC_EXT_EFX ALC_EXT_thread_local_context ALC_SOFT_loopback";
+#else
+static const char alc_extensions[] = "ALC_ENUMERATE_ALL_EXT ALC_ENUMERATION_EXT ALC_EXT_CAPTURE ALC_EXT_EFX ALC_SOFT_loopback";
+#endif
+
+/* Device and context state as well as object allocation
+ * is guarded by the lock; parameters of existing objects
+ * are plain stores, the same way drivers usually handle them */
+static salad_mutex_type null_mutex = SALAD_MUTEX_INIT;
+
+static ALCdevice devices[NULL_MAX_DEVICES];
+static ALCcontext contexts[NULL_MAX_CONTEXTS];
+static ALCcontext *current_context = NULL;
+static ALCenum null_error = ALC_NO_ERROR;
+
+/* A thread context overrides the process-wide
+ * one for its thread; without thread-local storage
+ * there's only one and the extension isn't advertised */
+#if defined(SALAD_THREAD_LOCAL)
+static SALAD_THREAD_LOCAL ALCcontext *thread_context = NULL;
+#else
+static ALCcontext *thread_context = NULL;
+#endif
+
+static unsigned char buffers_used[NULL_MAX_BUFFERS];
+static unsigned char sources_used[NULL_MAX_SOURCES];
+static unsigned char effects_used[NULL_MAX_EFFECTS];
+static unsigned char filters_used[NULL_MAX_FILTERS];
+
+static struct null_buffer buffers[NULL_MAX_BUFFERS];
+static struct null_source sources[NULL_MAX_SOURCES];
+static struct null_effect effects[NULL_MAX_EFFECTS];
+static struct null_filter filters[NULL_MAX_FILTERS];
+
+static void null_lock(void)
+{
+    salad_mutex_lock(&null_mutex);
+}
+
+static void null_unlock(void)
+{
+    salad_mutex_unlock(&null_mutex);
+}
+
+static ALCcontext *get_context(void)
+{
+    /* Another thread may have destroyed it meanwhile */
+    if(thread_context != NULL && thread_context->used)
+        return thread_context;
+    return current_context;
+}
+
+static void set_error(ALCcontext *context, ALenum error)
+{
+    /* The first error sticks until alGetError */
+    if(context->error == AL_NO_ERROR)
+        context->error = error;
+}
+
+static ALCdevice *get_device(ALCdevice *device)
+{
+    int i;
+
+    for(i = 0; i < NULL_MAX_DEVICES; ++i) {
+        if(device == &devices[i] && devices[i].used)
+            return device;
+        continue;
+    }
+
+    return NULL;
+}
+
+static void set_alc_error(ALCdevice *device, ALCenum error)
+{
+    if((device = get_device(device)) != NULL)
+        device->error = error;
+    else null_error = error;
+}
+
+static ALint to_int(ALfloat value)
+{
+    if(value >= (ALfloat)INT_MAX)
+        return INT_MAX;
+    if(value <= (ALfloat)INT_MIN)
+        return INT_MIN;
+    return (ALint)value;
+}
+
+static int compare_name(const void *a, const void *b)
+{
+    return strcmp((const char *)a, ((const struct null_name *)b)->name);
+}
+
+/**
+ * Checks a space-separated extension list
+ * the same case-insensitive way drivers do
+ * @param list      Extension list
+ * @param name      Extension name
+ * @returns         Non-zero if the name is in the list
+ */
+static int has_word(const char *list, const char *name)
+{
+    size_t length = strlen(name);
+    size_t i;
+
+    while(*list) {
+        for(i = 0; i < length && list[i] && (list[i] | 0x20) == (name[i] | 0x20); ++i);
+        if(i == length && (list[i] == ' ' || list[i] == 0))
+            return 1;
+        while(*list && *list != ' ')
+            ++list;
+        while(*list == ' ')
+            ++list;
+    }
+
+    return 0;
+}
+
+/* Seconds on a monotonic clock */
+static double null_now(void)
+{
+#if SALAD_WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1.0e-9;
+#endif
+}
+
+/**
+ * Counts the frames of silence a capture device has recorded
+ * since they were last taken; it records at its sample rate from
+ * the moment it's started and, like a real device, loses the oldest
+ * frames once its buffer is full
+ * @param device    Capture device
+ * @returns         Frames there are to be captured
+ */
+static ALCsizei capture_frames(ALCdevice *device)
+{
+    double now, frames;
+
+    if(!device->capturing)
+        return 0;
+
+    now = null_now();
+    frames = (now - device->capture_clock) * (double)device->frequency;
+    if(frames >= (double)device->capture_size) {
+        device->capture_clock = now - (double)device->capture_size / (double)device->frequency;
+        return device->capture_size;
+    }
+
+    return (ALCsizei)frames;
+}
+
+static ALint format_frame_size(ALenum format, ALint *bits, ALint *channels)
+{
+    switch(format) {
+        case AL_FORMAT_MONO8:             *bits = 8;  *channels = 1; break;
+        case AL_FORMAT_MONO16:            *bits = 16; *channels = 1; break;
+        case AL_FORMAT_STEREO8:           *bits = 8;  *channels = 2; break;
+        case AL_FORMAT_STEREO16:          *bits = 16; *channels = 2; break;
+        case AL_FORMAT_MONO_FLOAT32:      *bits = 32; *channels = 1; break;
+        case AL_FORMAT_STEREO_FLOAT32:    *bits = 32; *channels = 2; break;
+        default:                          return 0;
+    }
+
+    return *bits / 8 * *channels;
+}
+
+/**
+ * Allocates object names from a flat array
+ * @param used      Array of in-use flags
+ * @param max       Size of the array
+ * @param n         Number of names to allocate
+ * @param names     Allocated names
+ * @returns         Zero if there are not enough free names
+ */
+static int gen_names(unsigned char *used, ALsizei max, ALsizei n, ALuint *names)
+{
+    ALsizei found = 0;
+    ALsizei i;
+
+    for(i = 0; i < max && found < n; ++i)
+        found += !used[i];
+    if(found < n)
+        return 0;
+
+    for(i = 0, found = 0; found < n; ++i) {
+        if(used[i])
+            continue;
+        used[i] = 1;
+        names[found++] = (ALuint)i + 1;
+    }
+
+    return 1;
+}
+
+/**
+ * Checks names before deleting them,
+ * zero names are silently ignored
+ * @returns         Zero if any name is invalid
+ */
+static int check_names(const unsigned char *used, ALsizei max, ALsizei n, const ALuint *names)
+{
+    ALsizei i;
+
+    for(i = 0; i < n; ++i) {
+        if(names[i] != 0 && (names[i] > (ALuint)max || !used[names[i] - 1]))
+            return 0;
+        continue;
+    }
+
+    return 1;
+}
+
+static const struct null_param *find_param(const struct null_param *params, ALenum param)
+{
+    for(; params->count != 0; ++params) {
+        if(params->param == param)
+            return params;
+        continue;
+    }
+
+    return NULL;
+}
+
+static void init_values(ALfloat *values, const struct null_param *params)
+{
+    int i;
+
+    for(; params->count != 0; ++params) {
+        for(i = 0; i < params->count; ++i)
+            values[params->index + i] = params->initial;
+    }
+}
+
+/**
+ * Stores a parameter in a value array; exactly one
+ * of the float and the integer inputs must be given
+ * @param context   Current context for errors
+ * @param values    Value array
+ * @param params    Parameter table of the array
+ * @param param     Parameter
+ * @param fin       New float values
+ * @param iin       New integer values
+ * @param count     Number of values the entry point takes, zero for vectors
+ * @returns         Zero if the parameter or the values are invalid
+ */
+static int set_values(ALCcontext *context, ALfloat *values, const struct null_param *params, ALenum param, const ALfloat *fin, const ALint *iin, int count)
+{
+    const struct null_param *p = find_param(params, param);
+    ALfloat value;
+    int i;
+
+    if(p == NULL || (count != 0 && count != p->count)) {
+        set_error(context, AL_INVALID_ENUM);
+        return 0;
+    }
+
+    if(fin == NULL && iin == NULL) {
+        set_error(context, AL_INVALID_VALUE);
+        return 0;
+    }
+
+    /* Vectors are positions and directions, every
+     * scalar float is a gain, a distance or a factor */
+    if(p->count == 1 && !(p->flags & PARAM_INT) && ((fin != NULL) ? fin[0] : (ALfloat)iin[0]) < 0.0f) {
+        set_error(context, AL_INVALID_VALUE);
+        return 0;
+    }
+
+    for(i = 0; i < p->count; ++i) {
+        value = (fin != NULL) ? fin[i] : (ALfloat)iin[i];
+        values[p->index + i] = (p->flags & PARAM_INT) ? (ALfloat)to_int(value) : value;
+    }
+
+    return 1;
+}
+
+/**
+ * Reads a parameter from a value array; exactly
+ * one of the float and the integer outputs must be given
+ * @param context   Current context for errors
+ * @param values    Value array
+ * @param params    Parameter table of the array
+ * @param param     Parameter
+ * @param fout      Float values
+ * @param iout      Integer values
+ * @param count     Number of values the entry point takes, zero for vectors
+ */
+static void get_values(ALCcontext *context, const ALfloat *values, const struct null_param *params, ALenum param, ALfloat *fout, ALint *iout, int count)
+{
+    const struct null_param *p = find_param(params, param);
+    int i;
+
+    if(p == NULL || (count != 0 && count != p->count)) {
+        set_error(context, AL_INVALID_ENUM);
+        return;
+    }
+
+    if(fout == NULL && iout == NULL) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    for(i = 0; i < p->count; ++i) {
+        if(fout != NULL)
+            fout[i] = values[p->index + i];
+        else iout[i] = to_int(values[p->index + i]);
+    }
+}
+
+static struct null_buffer *get_buffer(ALuint name)
+{
+    if(name == 0 || name > NULL_MAX_BUFFERS || !buffers_used[name - 1])
+        return NULL;
+    return &buffers[name - 1];
+}
+
+static struct null_source *get_source(ALuint name)
+{
+    if(name == 0 || name > NULL_MAX_SOURCES || !sources_used[name - 1])
+        return NULL;
+    return &sources[name - 1];
+}
+
+static struct null_effect *get_effect(ALuint name)
+{
+    if(name == 0 || name > NULL_MAX_EFFECTS || !effects_used[name - 1])
+        return NULL;
+    return &effects[name - 1];
+}
+
+static struct null_filter *get_filter(ALuint name)
+{
+    if(name == 0 || name > NULL_MAX_FILTERS || !filters_used[name - 1])
+        return NULL;
+    return &filters[name - 1];
+}
+
+/**
+ * Converts samples to floats in place
+ * @param samples   Floats to write
+ * @param data      Unsigned 8-bit, signed 16-bit or float samples, NULL for silence
+ * @param count     Number of samples
+ * @param bits      Bits per sample
+ */
+static void convert_into(ALfloat *samples, const ALvoid *data, ALsizei count, ALint bits)
+{
+    ALsizei i;
+
+    if(data == NULL) {
+        for(i = 0; i < count; ++i)
+            samples[i] = 0.0f;
+    }
+    else if(bits == 8) {
+        for(i = 0; i < count; ++i)
+            samples[i] = (ALfloat)(((const ALubyte *)data)[i] - 128) * (1.0f / 128.0f);
+    }
+    else if(bits == 32) {
+        memcpy(samples, data, (size_t)count * sizeof(ALfloat));
+    }
+    else {
+        for(i = 0; i < count; ++i)
+            samples[i] = (ALfloat)((const ALshort *)data)[i] * (1.0f / 32768.0f);
+    }
+}
+
+/**
+ * Converts uploaded samples to floats
+ * @param data      Unsigned 8-bit, signed 16-bit or float samples, NULL for silence
+ * @param count     Number of samples
+ * @param bits      Bits per sample
+ * @returns         Allocated samples, NULL on failure or if there are none
+ */
+static ALfloat *convert_samples(const ALvoid *data, ALsizei count, ALint bits)
+{
+    ALfloat *samples;
+
+    if(count == 0 || (samples = malloc((size_t)count * sizeof(ALfloat))) == NULL)
+        return NULL;
+
+    convert_into(samples, data, count, bits);
+    return samples;
+}
+
+static void clear_queue(struct null_source *source)
+{
+    ALsizei i;
+
+    for(i = 0; i < source->queued; ++i)
+        buffers[source->queue[i] - 1].refs--;
+    source->queued = 0;
+    source->processed = 0;
+}
+
+/**
+ * Moves a source to the current buffer of its queue;
+ * buffers of a looping source never count as processed
+ * @param source    Source to update
+ * @param current   Index of the buffer in the queue
+ */
+static void set_current(struct null_source *source, ALsizei current)
+{
+    source->current = current;
+    if(source->values[SOURCE_LOOPING] == 0.0f)
+        source->processed = current;
+}
+
+/**
+ * Moves a source to the offset last set with AL_SEC_OFFSET,
+ * AL_SAMPLE_OFFSET or AL_BYTE_OFFSET, the source must have
+ * at least one buffer queued
+ * @param source    Source to move
+ * @returns         Zero if the offset is past the end of the queue
+ */
+static int seek_source(struct null_source *source)
+{
+    const struct null_buffer *first = &buffers[source->queue[0] - 1];
+    const struct null_buffer *buffer;
+    ALdouble frames;
+    ALsizei i;
+
+    switch(source->offset) {
+        case AL_SEC_OFFSET:
+            frames = (ALdouble)source->values[SOURCE_SEC_OFFSET] * first->frequency;
+            break;
+        case AL_BYTE_OFFSET:
+            frames = (ALdouble)to_int(source->values[SOURCE_BYTE_OFFSET] / (ALfloat)(first->bits / 8 * first->channels));
+            break;
+        default:
+            frames = (ALdouble)to_int(source->values[SOURCE_SAMPLE_OFFSET]);
+            break;
+    }
+
+    source->offset = 0;
+
+    for(i = 0; i < source->queued; ++i) {
+        buffer = &buffers[source->queue[i] - 1];
+
+        if(frames < (ALdouble)buffer->frames) {
+            set_current(source, i);
+            source->position = (ALsizei)frames;
+            source->fraction = (ALuint)((frames - (ALdouble)source->position) * FRACTION_ONE);
+            return 1;
+        }
+
+        frames -= (ALdouble)buffer->frames;
+    }
+
+    return 0;
+}
+
+/**
+ * Reads the playback offset of a source
+ * @param source    Source to read
+ * @param param     AL_SEC_OFFSET, AL_SAMPLE_OFFSET or AL_BYTE_OFFSET
+ * @returns         Offset in the units of the parameter
+ */
+static ALfloat source_offset(const struct null_source *source, ALenum param)
+{
+    const struct null_buffer *first;
+    ALdouble frames;
+    ALsizei i;
+
+    if(source->queued == 0 || (source->state != AL_PLAYING && source->state != AL_PAUSED))
+        return 0.0f;
+
+    first = &buffers[source->queue[0] - 1];
+    frames = (ALdouble)source->position + (ALdouble)source->fraction / FRACTION_ONE;
+
+    for(i = 0; i < source->current; ++i)
+        frames += (ALdouble)buffers[source->queue[i] - 1].frames;
+
+    switch(param) {
+        case AL_SEC_OFFSET:
+            return (first->frequency != 0) ? (ALfloat)(frames / first->frequency) : 0.0f;
+        case AL_BYTE_OFFSET:
+            return (ALfloat)((ALsizei)frames * (first->bits / 8 * first->channels));
+    }
+
+    return (ALfloat)(ALsizei)frames;
+}
+
+/* Playback devices play into the null sink, which takes no
+ * time at all, so a source finishes as soon as it starts unless
+ * it loops; on loopback devices the mixer plays it for real */
+static void play_source(struct null_source *source)
+{
+    if(source->queued == 0) {
+        source->state = AL_STOPPED;
+        return;
+    }
+
+    /* Playing a paused source resumes it,
+     * anything else starts from the beginning */
+    if(source->state != AL_PAUSED) {
+        source->processed = 0;
+        source->current = 0;
+        source->position = 0;
+        source->fraction = 0;
+
+        /* A callback buffer starts pulling anew and has
+         * no offsets to seek to, it's just a stream of samples */
+        if(buffers[source->queue[0] - 1].callback != NULL) {
+            buffers[source->queue[0] - 1].frames = 0;
+            buffers[source->queue[0] - 1].ended = 0;
+            source->offset = 0;
+        }
+
+        if(source->offset != 0 && !seek_source(source)) {
+            source->state = AL_STOPPED;
+            source->processed = source->queued;
+            return;
+        }
+    }
+
+    if(source->context->device->loopback || source->values[SOURCE_LOOPING] != 0.0f) {
+        source->state = AL_PLAYING;
+        return;
+    }
+
+    source->state = AL_STOPPED;
+    source->processed = source->queued;
+}
+
+static void pause_source(struct null_source *source)
+{
+    if(source->state == AL_PLAYING)
+        source->state = AL_PAUSED;
+}
+
+static void stop_source(struct null_source *source)
+{
+    source->state = AL_STOPPED;
+    source->processed = source->queued;
+    source->offset = 0;
+}
+
+static void rewind_source(struct null_source *source)
+{
+    source->state = AL_INITIAL;
+    source->processed = 0;
+    source->offset = 0;
+}
+
+static void change_sources(ALsizei n, const ALuint *names, void (*change)(struct null_source *))
+{
+    ALCcontext *context = get_context();
+    ALsizei i;
+
+    if(context == NULL)
+        return;
+
+    if(n < 0 || (n > 0 && names == NULL)) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    for(i = 0; i < n; ++i) {
+        if(get_source(names[i]) == NULL) {
+            set_error(context, AL_INVALID_NAME);
+            return;
+        }
+    }
+
+    null_lock();
+    for(i = 0; i < n; ++i)
+        change(get_source(names[i]));
+    null_unlock();
+}
+
+static void set_source_buffer(ALCcontext *context, struct null_source *source, ALuint name)
+{
+    null_lock();
+
+    if(source->state == AL_PLAYING || source->state == AL_PAUSED)
+        set_error(context, AL_INVALID_OPERATION);
+    else if(name != 0 && get_buffer(name) == NULL)
+        set_error(context, AL_INVALID_VALUE);
+    else {
+        clear_queue(source);
+        source->type = AL_UNDETERMINED;
+
+        if(name != 0) {
+            buffers[name - 1].refs++;
+            source->queue[0] = name;
+            source->queued = 1;
+            source->type = AL_STATIC;
+        }
+    }
+
+    null_unlock();
+}
+
+static void set_source(ALuint name, ALenum param, const ALfloat *fin, const ALint *iin, int count)
+{
+    ALCcontext *context = get_context();
+    struct null_source *source;
+
+    if(context == NULL)
+        return;
+
+    if((source = get_source(name)) == NULL) {
+        set_error(context, AL_INVALID_NAME);
+        return;
+    }
+
+    if(param == AL_SEC_OFFSET || param == AL_SAMPLE_OFFSET || param == AL_BYTE_OFFSET) {
+        if(!set_values(context, source->values, source_params, param, fin, iin, count))
+            return;
+
+        /* The offset applies right away to a playing source
+         * and the next time it's played to any other one */
+        null_lock();
+        source->offset = param;
+        if((source->state == AL_PLAYING || source->state == AL_PAUSED) && !seek_source(source))
+            set_error(context, AL_INVALID_VALUE);
+        null_unlock();
+        return;
+    }
+
+    if(param != AL_BUFFER) {
+        set_values(context, source->values, source_params, param, fin, iin, count);
+        return;
+    }
+
+    if(count > 1)
+        set_error(context, AL_INVALID_ENUM);
+    else if(fin == NULL && iin == NULL)
+        set_error(context, AL_INVALID_VALUE);
+    else set_source_buffer(context, source, (fin != NULL) ? (ALuint)to_int(fin[0]) : (ALuint)iin[0]);
+}
+
+static void get_source_values(ALuint name, ALenum param, ALfloat *fout, ALint *iout, int count)
+{
+    ALCcontext *context = get_context();
+    struct null_source *source;
+    ALfloat value;
+
+    if(context == NULL)
+        return;
+
+    if((source = get_source(name)) == NULL) {
+        set_error(context, AL_INVALID_NAME);
+        return;
+    }
+
+    switch(param) {
+        case AL_BUFFER:
+            value = 0.0f;
+            if(source->queued != 0)
+                value = (ALfloat)source->queue[(source->current < source->queued) ? source->current : source->queued - 1];
+            break;
+        case AL_SOURCE_STATE:
+            value = (ALfloat)source->state;
+            break;
+        case AL_SOURCE_TYPE:
+            value = (ALfloat)source->type;
+            break;
+        case AL_BUFFERS_QUEUED:
+            value = (ALfloat)source->queued;
+            break;
+        case AL_BUFFERS_PROCESSED:
+            value = (ALfloat)source->processed;
+            break;
+        case AL_SEC_OFFSET:
+        case AL_SAMPLE_OFFSET:
+        case AL_BYTE_OFFSET:
+            value = source_offset(source, param);
+            break;
+        default:
+            get_values(context, source->values, source_params, param, fout, iout, count);
+            return;
+    }
+
+    if(count > 1)
+        set_error(context, AL_INVALID_ENUM);
+    else if(fout != NULL)
+        fout[0] = value;
+    else if(iout != NULL)
+        iout[0] = to_int(value);
+    else set_error(context, AL_INVALID_VALUE);
+}
+
+static void set_listener(ALenum param, const ALfloat *fin, const ALint *iin, int count)
+{
+    ALCcontext *context = get_context();
+
+    if(context != NULL)
+        set_values(context, context->listener, listener_params, param, fin, iin, count);
+}
+
+static void get_listener(ALenum param, ALfloat *fout, ALint *iout, int count)
+{
+    ALCcontext *context = get_context();
+
+    if(context != NULL)
+        get_values(context, context->listener, listener_params, param, fout, iout, count);
+}
+
+static void set_buffer(ALuint name, ALenum param)
+{
+    ALCcontext *context = get_context();
+
+    /* There are no settable buffer parameters in OpenAL 1.1 */
+    if(context != NULL)
+        set_error(context, (get_buffer(name) == NULL) ? AL_INVALID_NAME : AL_INVALID_ENUM);
+    (void)param;
+}
+
+static void get_buffer_values(ALuint name, ALenum param, ALfloat *fout, ALint *iout, int count)
+{
+    ALCcontext *context = get_context();
+    struct null_buffer *buffer;
+    ALint value;
+
+    if(context == NULL)
+        return;
+
+    if((buffer = get_buffer(name)) == NULL) {
+        set_error(context, AL_INVALID_NAME);
+        return;
+    }
+
+    switch(param) {
+        case AL_FREQUENCY:
+            value = buffer->frequency;
+            break;
+        case AL_BITS:
+            value = buffer->bits;
+            break;
+        case AL_CHANNELS:
+            value = buffer->channels;
+            break;
+        case AL_SIZE:
+            value = buffer->size;
+            break;
+        default:
+            set_error(context, AL_INVALID_ENUM);
+            return;
+    }
+
+    if(count > 1)
+        set_error(context, AL_INVALID_ENUM);
+    else if(fout != NULL)
+        fout[0] = (ALfloat)value;
+    else if(iout != NULL)
+        iout[0] = value;
+    else set_error(context, AL_INVALID_VALUE);
+}
+
+/**
+ * Reads a context state value
+ * @param context   Current context
+ * @param param     State parameter
+ * @param value     Value of the parameter
+ * @returns         Zero if the parameter is invalid
+ */
+static int get_state(ALCcontext *context, ALenum param, ALdouble *value)
+{
+    switch(param) {
+        case AL_DOPPLER_FACTOR:
+        case AL_DOPPLER_VELOCITY:
+            *value = 1.0;
+            return 1;
+        case AL_SPEED_OF_SOUND:
+            *value = 343.3;
+            return 1;
+        case AL_DISTANCE_MODEL:
+            *value = AL_INVERSE_DISTANCE_CLAMPED;
+            return 1;
+        case AL_DEFERRED_UPDATES_SOFT:
+            *value = context->deferred ? 1.0 : 0.0;
+            return 1;
+    }
+
+    set_error(context, AL_INVALID_ENUM);
+    return 0;
+}
+
+static ALdouble get_state_value(ALenum param)
+{
+    ALCcontext *context = get_context();
+    ALdouble value = 0.0;
+
+    if(context != NULL)
+        get_state(context, param, &value);
+    return value;
+}
+
+static int check_state_values(const void *values)
+{
+    ALCcontext *context = get_context();
+
+    if(context == NULL)
+        return 0;
+
+    if(values == NULL) {
+        set_error(context, AL_INVALID_VALUE);
+        return 0;
+    }
+
+    return 1;
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alEnable)(ALenum capability)
+{
+    ALCcontext *context = get_context();
+
+    /* No capabilities are supported */
+    if(context != NULL)
+        set_error(context, AL_INVALID_ENUM);
+    (void)capability;
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alDisable)(ALenum capability)
+{
+    NULL_API(alEnable)(capability);
+}
+
+NULL_EXPORT ALboolean AL_APIENTRY NULL_API(alIsEnabled)(ALenum capability)
+{
+    NULL_API(alEnable)(capability);
+    return AL_FALSE;
+}
+
+NULL_EXPORT const ALchar *AL_APIENTRY NULL_API(alGetString)(ALenum param)
+{
+    ALCcontext *context = get_context();
+    const char *value = NULL;
+
+    if(context == NULL)
+        return NULL;
+
+    switch(param) {
+        case AL_VENDOR:             value = "SALAD"; break;
+        case AL_VERSION:            value = "1.1 SALAD null"; break;
+        case AL_RENDERER:           value = "Null Renderer"; break;
+        case AL_EXTENSIONS:         value = al_extensions; break;
+        case AL_NO_ERROR:           value = "No Error"; break;
+        case AL_INVALID_NAME:       value = "Invalid Name"; break;
+        case AL_INVALID_ENUM:       value = "Invalid Enum"; break;
+        case AL_INVALID_VALUE:      value = "Invalid Value"; break;
+        case AL_INVALID_OPERATION:  value = "Invalid Operation"; break;
+        case AL_OUT_OF_MEMORY:      value = "Out of Memory"; break;
+        default:                    set_error(context, AL_INVALID_ENUM); break;
+    }
+
+    return (const ALchar *)value;
+}
+
+NULL_EXPORT ALboolean AL_APIENTRY NULL_API(alGetBoolean)(ALenum param)
+{
+    return (get_state_value(param) != 0.0) ? AL_TRUE : AL_FALSE;
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetBooleanv)(ALenum param, ALboolean *values)
+{
+    if(check_state_values(values))
+        values[0] = NULL_API(alGetBoolean)(param);
+}
+
+NULL_EXPORT ALdouble AL_APIENTRY NULL_API(alGetDouble)(ALenum param)
+{
+    return get_state_value(param);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetDoublev)(ALenum param, ALdouble *values)
+{
+    if(check_state_values(values))
+        values[0] = NULL_API(alGetDouble)(param);
+}
+
+NULL_EXPORT ALfloat AL_APIENTRY NULL_API(alGetFloat)(ALenum param)
+{
+    return (ALfloat)get_state_value(param);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetFloatv)(ALenum param, ALfloat *values)
+{
+    if(check_state_values(values))
+        values[0] = NULL_API(alGetFloat)(param);
+}
+
+NULL_EXPORT ALint AL_APIENTRY NULL_API(alGetInteger)(ALenum param)
+{
+    return to_int((ALfloat)get_state_value(param));
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetIntegerv)(ALenum param, ALint *values)
+{
+    if(check_state_values(values))
+        values[0] = NULL_API(alGetInteger)(param);
+}
+
+NULL_EXPORT ALenum AL_APIENTRY NULL_API(alGetError)(void)
+{
+    ALCcontext *context = get_context();
+    ALenum error;
+
+    if(context == NULL)
+        return AL_INVALID_OPERATION;
+
+    error = context->error;
+    context->error = AL_NO_ERROR;
+    return error;
+}
+
+NULL_EXPORT ALboolean AL_APIENTRY NULL_API(alIsExtensionPresent)(const ALchar *extname)
+{
+    ALCcontext *context = get_context();
+
+    if(context == NULL)
+        return AL_FALSE;
+
+    if(extname == NULL) {
+        set_error(context, AL_INVALID_VALUE);
+        return AL_FALSE;
+    }
+
+    return has_word(al_extensions, (const char *)extname) ? AL_TRUE : AL_FALSE;
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alListenerf)(ALenum param, ALfloat value)
+{
+    set_listener(param, &value, NULL, 1);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alListener3f)(ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
+{
+    ALfloat values[3];
+
+    values[0] = value1;
+    values[1] = value2;
+    values[2] = value3;
+    set_listener(param, values, NULL, 3);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alListenerfv)(ALenum param, const ALfloat *values)
+{
+    set_listener(param, values, NULL, 0);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alListeneri)(ALenum param, ALint value)
+{
+    set_listener(param, NULL, &value, 1);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alListener3i)(ALenum param, ALint value1, ALint value2, ALint value3)
+{
+    ALint values[3];
+
+    values[0] = value1;
+    values[1] = value2;
+    values[2] = value3;
+    set_listener(param, NULL, values, 3);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alListeneriv)(ALenum param, const ALint *values)
+{
+    set_listener(param, NULL, values, 0);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetListenerf)(ALenum param, ALfloat *value)
+{
+    get_listener(param, value, NULL, 1);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetListener3f)(ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
+{
+    ALfloat values[3];
+
+    values[0] = values[1] = values[2] = 0.0f;
+    get_listener(param, values, NULL, 3);
+
+    if(value1 != NULL && value2 != NULL && value3 != NULL) {
+        *value1 = values[0];
+        *value2 = values[1];
+        *value3 = values[2];
+    }
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetListenerfv)(ALenum param, ALfloat *values)
+{
+    get_listener(param, values, NULL, 0);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetListeneri)(ALenum param, ALint *value)
+{
+    get_listener(param, NULL, value, 1);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetListener3i)(ALenum param, ALint *value1, ALint *value2, ALint *value3)
+{
+    ALint values[3];
+
+    values[0] = values[1] = values[2] = 0;
+    get_listener(param, NULL, values, 3);
+
+    if(value1 != NULL && value2 != NULL && value3 != NULL) {
+        *value1 = values[0];
+        *value2 = values[1];
+        *value3 = values[2];
+    }
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetListeneriv)(ALenum param, ALint *values)
+{
+    get_listener(param, NULL, values, 0);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGenSources)(ALsizei n, ALuint *names)
+{
+    ALCcontext *context = get_context();
+    ALsizei i;
+
+    if(context == NULL)
+        return;
+
+    if(n < 0 || (n > 0 && names == NULL)) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    null_lock();
+
+    if(gen_names(sources_used, NULL_MAX_SOURCES, n, names)) {
+        for(i = 0; i < n; ++i) {
+            struct null_source *source = &sources[names[i] - 1];
+            init_values(source->values, source_params);
+            source->state = AL_INITIAL;
+            source->type = AL_UNDETERMINED;
+            source->context = context;
+            source->queued = 0;
+            source->processed = 0;
+            source->current = 0;
+            source->position = 0;
+            source->fraction = 0;
+            source->offset = 0;
+        }
+    }
+    else {
+        set_error(context, AL_OUT_OF_MEMORY);
+    }
+
+    null_unlock();
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alDeleteSources)(ALsizei n, const ALuint *names)
+{
+    ALCcontext *context = get_context();
+    ALsizei i;
+
+    if(context == NULL)
+        return;
+
+    if(n < 0 || (n > 0 && names == NULL)) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    null_lock();
+
+    if(check_names(sources_used, NULL_MAX_SOURCES, n, names)) {
+        for(i = 0; i < n; ++i) {
+            if(names[i] == 0)
+                continue;
+            clear_queue(&sources[names[i] - 1]);
+            sources_used[names[i] - 1] = 0;
+        }
+    }
+    else {
+        set_error(context, AL_INVALID_NAME);
+    }
+
+    null_unlock();
+}
+
+NULL_EXPORT ALboolean AL_APIENTRY NULL_API(alIsSource)(ALuint source)
+{
+    return (get_context() != NULL && get_source(source) != NULL) ? AL_TRUE : AL_FALSE;
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourcef)(ALuint source, ALenum param, ALfloat value)
+{
+    set_source(source, param, &value, NULL, 1);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSource3f)(ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
+{
+    ALfloat values[3];
+
+    values[0] = value1;
+    values[1] = value2;
+    values[2] = value3;
+    set_source(source, param, values, NULL, 3);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourcefv)(ALuint source, ALenum param, const ALfloat *values)
+{
+    set_source(source, param, values, NULL, 0);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourcei)(ALuint source, ALenum param, ALint value)
+{
+    set_source(source, param, NULL, &value, 1);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSource3i)(ALuint source, ALenum param, ALint value1, ALint value2, ALint value3)
+{
+    ALint values[3];
+
+    values[0] = value1;
+    values[1] = value2;
+    values[2] = value3;
+    set_source(source, param, NULL, values, 3);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourceiv)(ALuint source, ALenum param, const ALint *values)
+{
+    set_source(source, param, NULL, values, 0);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetSourcef)(ALuint source, ALenum param, ALfloat *value)
+{
+    get_source_values(source, param, value, NULL, 1);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetSource3f)(ALuint source, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
+{
+    ALfloat values[3];
+
+    values[0] = values[1] = values[2] = 0.0f;
+    get_source_values(source, param, values, NULL, 3);
+
+    if(value1 != NULL && value2 != NULL && value3 != NULL) {
+        *value1 = values[0];
+        *value2 = values[1];
+        *value3 = values[2];
+    }
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetSourcefv)(ALuint source, ALenum param, ALfloat *values)
+{
+    get_source_values(source, param, values, NULL, 0);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetSourcei)(ALuint source, ALenum param, ALint *value)
+{
+    get_source_values(source, param, NULL, value, 1);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetSource3i)(ALuint source, ALenum param, ALint *value1, ALint *value2, ALint *value3)
+{
+    ALint values[3];
+
+    values[0] = values[1] = values[2] = 0;
+    get_source_values(source, param, NULL, values, 3);
+
+    if(value1 != NULL && value2 != NULL && value3 != NULL) {
+        *value1 = values[0];
+        *value2 = values[1];
+        *value3 = values[2];
+    }
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetSourceiv)(ALuint source, ALenum param, ALint *values)
+{
+    get_source_values(source, param, NULL, values, 0);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourcePlay)(ALuint source)
+{
+    change_sources(1, &source, &play_source);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourcePlayv)(ALsizei n, const ALuint *names)
+{
+    change_sources(n, names, &play_source);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourcePause)(ALuint source)
+{
+    change_sources(1, &source, &pause_source);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourcePausev)(ALsizei n, const ALuint *names)
+{
+    change_sources(n, names, &pause_source);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourceStop)(ALuint source)
+{
+    change_sources(1, &source, &stop_source);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourceStopv)(ALsizei n, const ALuint *names)
+{
+    change_sources(n, names, &stop_source);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourceRewind)(ALuint source)
+{
+    change_sources(1, &source, &rewind_source);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourceRewindv)(ALsizei n, const ALuint *names)
+{
+    change_sources(n, names, &rewind_source);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourceQueueBuffers)(ALuint source, ALsizei nb, const ALuint *names)
+{
+    ALCcontext *context = get_context();
+    struct null_source *s;
+    const struct null_buffer *first;
+    const struct null_buffer *buffer;
+    ALsizei i;
+
+    if(context == NULL)
+        return;
+
+    if((s = get_source(source)) == NULL) {
+        set_error(context, AL_INVALID_NAME);
+        return;
+    }
+
+    if(nb < 0 || (nb > 0 && names == NULL)) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    null_lock();
+
+    if(s->type == AL_STATIC) {
+        set_error(context, AL_INVALID_OPERATION);
+        null_unlock();
+        return;
+    }
+
+    if(s->queued + nb > NULL_MAX_QUEUE) {
+        set_error(context, AL_OUT_OF_MEMORY);
+        null_unlock();
+        return;
+    }
+
+    /* Every buffer in a queue must have the same format */
+    first = (s->queued != 0) ? get_buffer(s->queue[0]) : get_buffer(names[0]);
+
+    for(i = 0; i < nb; ++i) {
+        if((buffer = get_buffer(names[i])) == NULL) {
+            set_error(context, AL_INVALID_NAME);
+            null_unlock();
+            return;
+        }
+
+        /* Callback buffers can only be set with AL_BUFFER */
+        if(buffer->bits != first->bits || buffer->channels != first->channels || buffer->callback != NULL) {
+            set_error(context, AL_INVALID_OPERATION);
+            null_unlock();
+            return;
+        }
+    }
+
+    for(i = 0; i < nb; ++i) {
+        s->queue[s->queued++] = names[i];
+        get_buffer(names[i])->refs++;
+    }
+
+    if(nb != 0)
+        s->type = AL_STREAMING;
+
+    null_unlock();
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alSourceUnqueueBuffers)(ALuint source, ALsizei nb, ALuint *names)
+{
+    ALCcontext *context = get_context();
+    struct null_source *s;
+    ALsizei i;
+
+    if(context == NULL)
+        return;
+
+    if((s = get_source(source)) == NULL) {
+        set_error(context, AL_INVALID_NAME);
+        return;
+    }
+
+    if(nb < 0 || (nb > 0 && names == NULL)) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    null_lock();
+
+    if(s->type == AL_STATIC)
+        set_error(context, AL_INVALID_OPERATION);
+    else if(nb > s->processed)
+        set_error(context, AL_INVALID_VALUE);
+    else {
+        for(i = 0; i < nb; ++i) {
+            names[i] = s->queue[i];
+            get_buffer(names[i])->refs--;
+        }
+
+        memmove(s->queue, s->queue + nb, (size_t)(s->queued - nb) * sizeof(ALuint));
+        s->queued -= nb;
+        s->processed -= nb;
+        s->current = (s->current > nb) ? s->current - nb : 0;
+    }
+
+    null_unlock();
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGenBuffers)(ALsizei n, ALuint *names)
+{
+    ALCcontext *context = get_context();
+    ALsizei i;
+
+    if(context == NULL)
+        return;
+
+    if(n < 0 || (n > 0 && names == NULL)) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    null_lock();
+
+    if(gen_names(buffers_used, NULL_MAX_BUFFERS, n, names)) {
+        for(i = 0; i < n; ++i)
+            memset(&buffers[names[i] - 1], 0, sizeof(struct null_buffer));
+    }
+    else {
+        set_error(context, AL_OUT_OF_MEMORY);
+    }
+
+    null_unlock();
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alDeleteBuffers)(ALsizei n, const ALuint *names)
+{
+    ALCcontext *context = get_context();
+    ALsizei i;
+
+    if(context == NULL)
+        return;
+
+    if(n < 0 || (n > 0 && names == NULL)) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    null_lock();
+
+    if(!check_names(buffers_used, NULL_MAX_BUFFERS, n, names)) {
+        set_error(context, AL_INVALID_NAME);
+        null_unlock();
+        return;
+    }
+
+    /* Buffers still attached to a source can't go away */
+    for(i = 0; i < n; ++i) {
+        if(names[i] != 0 && buffers[names[i] - 1].refs != 0) {
+            set_error(context, AL_INVALID_OPERATION);
+            null_unlock();
+            return;
+        }
+    }
+
+    for(i = 0; i < n; ++i) {
+        if(names[i] == 0)
+            continue;
+        free(buffers[names[i] - 1].samples);
+        buffers[names[i] - 1].samples = NULL;
+        buffers_used[names[i] - 1] = 0;
+    }
+
+    null_unlock();
+}
+
+NULL_EXPORT ALboolean AL_APIENTRY NULL_API(alIsBuffer)(ALuint buffer)
+{
+    /* The zero buffer is always valid */
+    return (get_context() != NULL && (buffer == 0 || get_buffer(buffer) != NULL)) ? AL_TRUE : AL_FALSE;
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alBufferData)(ALuint buffer, ALenum format, const ALvoid *data, ALsizei size, ALsizei freq)
+{
+    ALCcontext *context = get_context();
+    struct null_buffer *b;
+    ALfloat *samples;
+    ALint frame_size;
+    ALint bits;
+    ALint channels;
+
+    if(context == NULL)
+        return;
+
+    if((b = get_buffer(buffer)) == NULL) {
+        set_error(context, AL_INVALID_NAME);
+        return;
+    }
+
+    if((frame_size = format_frame_size(format, &bits, &channels)) == 0) {
+        set_error(context, AL_INVALID_ENUM);
+        return;
+    }
+
+    if(size < 0 || size % frame_size != 0 || freq < 1) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    /* Converted before taking the lock, the
+     * mixer only ever sees the finished samples */
+    if((samples = convert_samples(data, size / frame_size * channels, bits)) == NULL && size != 0) {
+        set_error(context, AL_OUT_OF_MEMORY);
+        return;
+    }
+
+    null_lock();
+
+    if(b->refs != 0) {
+        set_error(context, AL_INVALID_OPERATION);
+    }
+    else {
+        free(b->samples);
+        b->frequency = freq;
+        b->bits = bits;
+        b->channels = channels;
+        b->size = size;
+        b->samples = samples;
+        b->frames = size / frame_size;
+        b->callback = NULL;
+        b->userptr = NULL;
+        samples = NULL;
+    }
+
+    null_unlock();
+
+    free(samples);
+}
+
+/* Samples are converted to floats on upload anyway,
+ * so there's no memory of the caller's to hold on to */
+NULL_EXPORT void AL_APIENTRY NULL_API(alBufferDataStatic)(ALint buffer, ALenum format, ALvoid *data, ALsizei size, ALsizei freq)
+{
+    NULL_API(alBufferData)((ALuint)buffer, format, data, size, freq);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alBufferf)(ALuint buffer, ALenum param, ALfloat value)
+{
+    (void)value;
+    set_buffer(buffer, param);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alBuffer3f)(ALuint buffer, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
+{
+    (void)value1;
+    (void)value2;
+    (void)value3;
+    set_buffer(buffer, param);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alBufferfv)(ALuint buffer, ALenum param, const ALfloat *values)
+{
+    (void)values;
+    set_buffer(buffer, param);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alBufferi)(ALuint buffer, ALenum param, ALint value)
+{
+    (void)value;
+    set_buffer(buffer, param);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alBuffer3i)(ALuint buffer, ALenum param, ALint value1, ALint value2, ALint value3)
+{
+    (void)value1;
+    (void)value2;
+    (void)value3;
+    set_buffer(buffer, param);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alBufferiv)(ALuint buffer, ALenum param, const ALint *values)
+{
+    (void)values;
+    set_buffer(buffer, param);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetBufferf)(ALuint buffer, ALenum param, ALfloat *value)
+{
+    get_buffer_values(buffer, param, value, NULL, 1);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetBuffer3f)(ALuint buffer, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
+{
+    ALfloat values[3];
+
+    (void)value1;
+    (void)value2;
+    (void)value3;
+    get_buffer_values(buffer, param, values, NULL, 3);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetBufferfv)(ALuint buffer, ALenum param, ALfloat *values)
+{
+    get_buffer_values(buffer, param, values, NULL, 0);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetBufferi)(ALuint buffer, ALenum param, ALint *value)
+{
+    get_buffer_values(buffer, param, NULL, value, 1);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetBuffer3i)(ALuint buffer, ALenum param, ALint *value1, ALint *value2, ALint *value3)
+{
+    ALint values[3];
+
+    (void)value1;
+    (void)value2;
+    (void)value3;
+    get_buffer_values(buffer, param, NULL, values, 3);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetBufferiv)(ALuint buffer, ALenum param, ALint *values)
+{
+    get_buffer_values(buffer, param, NULL, values, 0);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alDeferUpdatesSOFT)(void)
+{
+    ALCcontext *context = get_context();
+
+    if(context != NULL)
+        context->deferred = AL_TRUE;
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alProcessUpdatesSOFT)(void)
+{
+    ALCcontext *context = get_context();
+
+    /* Nothing is rendered so there's nothing to apply */
+    if(context != NULL)
+        context->deferred = AL_FALSE;
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alBufferCallbackSOFT)(ALuint buffer, ALenum format, ALsizei freq, ALBUFFERCALLBACKTYPESOFT callback, ALvoid *userptr)
+{
+    ALCcontext *context = get_context();
+    struct null_buffer *b;
+    ALfloat *samples;
+    ALint bits;
+    ALint channels;
+
+    if(context == NULL)
+        return;
+
+    if((b = get_buffer(buffer)) == NULL) {
+        set_error(context, AL_INVALID_NAME);
+        return;
+    }
+
+    if(format_frame_size(format, &bits, &channels) == 0) {
+        set_error(context, AL_INVALID_ENUM);
+        return;
+    }
+
+    if(callback == NULL || freq < 1) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    if((samples = convert_samples(NULL, NULL_BLOCK * channels, bits)) == NULL) {
+        set_error(context, AL_OUT_OF_MEMORY);
+        return;
+    }
+
+    null_lock();
+
+    if(b->refs != 0) {
+        set_error(context, AL_INVALID_OPERATION);
+    }
+    else {
+        free(b->samples);
+        b->frequency = freq;
+        b->bits = bits;
+        b->channels = channels;
+        b->size = 0;
+        b->samples = samples;
+        b->frames = 0;
+        b->callback = callback;
+        b->userptr = userptr;
+        b->ended = 0;
+        samples = NULL;
+    }
+
+    null_unlock();
+
+    free(samples);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetBufferPtrSOFT)(ALuint buffer, ALenum param, ALvoid **ptr)
+{
+    ALCcontext *context = get_context();
+    const struct null_buffer *b;
+
+    if(context == NULL)
+        return;
+
+    if((b = get_buffer(buffer)) == NULL) {
+        set_error(context, AL_INVALID_NAME);
+        return;
+    }
+
+    if(ptr == NULL) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    switch(param) {
+        case AL_BUFFER_CALLBACK_FUNCTION_SOFT:
+            *ptr = (ALvoid *)b->callback;
+            break;
+        case AL_BUFFER_CALLBACK_USER_PARAM_SOFT:
+            *ptr = b->userptr;
+            break;
+        default:
+            set_error(context, AL_INVALID_ENUM);
+            break;
+    }
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetBuffer3PtrSOFT)(ALuint buffer, ALenum param, ALvoid **ptr0, ALvoid **ptr1, ALvoid **ptr2)
+{
+    ALCcontext *context = get_context();
+
+    /* There are no three pointer parameters */
+    if(context != NULL)
+        set_error(context, (get_buffer(buffer) == NULL) ? AL_INVALID_NAME : AL_INVALID_ENUM);
+    (void)param;
+    (void)ptr0;
+    (void)ptr1;
+    (void)ptr2;
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetBufferPtrvSOFT)(ALuint buffer, ALenum param, ALvoid **ptr)
+{
+    NULL_API(alGetBufferPtrSOFT)(buffer, param, ptr);
+}
+
+/**
+ * Allocates effect or filter names; both are
+ * a type followed by a few parameters set to zero
+ */
+static void gen_typed(unsigned char *used, ALsizei max, ALsizei n, ALuint *names, char *objects, size_t size)
+{
+    ALCcontext *context = get_context();
+    ALsizei i;
+
+    if(context == NULL)
+        return;
+
+    if(n < 0 || (n > 0 && names == NULL)) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    null_lock();
+
+    if(gen_names(used, max, n, names)) {
+        for(i = 0; i < n; ++i)
+            memset(objects + (names[i] - 1) * size, 0, size);
+    }
+    else {
+        set_error(context, AL_OUT_OF_MEMORY);
+    }
+
+    null_unlock();
+}
+
+static void delete_typed(unsigned char *used, ALsizei max, ALsizei n, const ALuint *names)
+{
+    ALCcontext *context = get_context();
+    ALsizei i;
+
+    if(context == NULL)
+        return;
+
+    if(n < 0 || (n > 0 && names == NULL)) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    null_lock();
+
+    if(check_names(used, max, n, names)) {
+        for(i = 0; i < n; ++i) {
+            if(names[i] != 0)
+                used[names[i] - 1] = 0;
+            continue;
+        }
+    }
+    else {
+        set_error(context, AL_INVALID_NAME);
+    }
+
+    null_unlock();
+}
+
+/**
+ * Sets a parameter of an effect or a filter; parameters
+ * are only checked against the number of value slots
+ * @param context   Current context for errors
+ * @param type      Object type
+ * @param values    Object values
+ * @param num       Number of values
+ * @param last_type Largest valid type
+ * @param param     Parameter
+ * @param fin       New float value
+ * @param iin       New integer value
+ */
+static void set_typed(ALCcontext *context, ALint *type, ALfloat *values, ALenum num, ALint last_type, ALenum param, const ALfloat *fin, const ALint *iin)
+{
+    ALfloat value;
+
+    if(fin == NULL && iin == NULL) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    value = (fin != NULL) ? fin[0] : (ALfloat)iin[0];
+
+    /* Both AL_EFFECT_TYPE and AL_FILTER_TYPE */
+    if(param == AL_EFFECT_TYPE) {
+        if(value < 0.0f || value > (ALfloat)last_type) {
+            set_error(context, AL_INVALID_VALUE);
+            return;
+        }
+
+        *type = to_int(value);
+        memset(values, 0, (size_t)num * sizeof(ALfloat));
+        return;
+    }
+
+    if(*type == 0 || param == 0 || param >= num) {
+        set_error(context, AL_INVALID_ENUM);
+        return;
+    }
+
+    values[param] = value;
+}
+
+static void get_typed(ALCcontext *context, const ALint *type, const ALfloat *values, ALenum num, ALenum param, ALfloat *fout, ALint *iout)
+{
+    ALfloat value;
+
+    if(fout == NULL && iout == NULL) {
+        set_error(context, AL_INVALID_VALUE);
+        return;
+    }
+
+    if(param == AL_EFFECT_TYPE)
+        value = (ALfloat)*type;
+    else if(*type != 0 && param != 0 && param < num)
+        value = values[param];
+    else {
+        set_error(context, AL_INVALID_ENUM);
+        return;
+    }
+
+    if(fout != NULL)
+        fout[0] = value;
+    else iout[0] = to_int(value);
+}
+
+static void set_effect(ALuint name, ALenum param, const ALfloat *fin, const ALint *iin)
+{
+    ALCcontext *context = get_context();
+    struct null_effect *effect;
+
+    if(context == NULL)
+        return;
+
+    if((effect = get_effect(name)) == NULL)
+        set_error(context, AL_INVALID_NAME);
+    else set_typed(context, &effect->type, effect->values, NULL_EFFECT_VALUES, AL_EFFECT_EQUALIZER, param, fin, iin);
+}
+
+static void get_effect_values(ALuint name, ALenum param, ALfloat *fout, ALint *iout)
+{
+    ALCcontext *context = get_context();
+    struct null_effect *effect;
+
+    if(context == NULL)
+        return;
+
+    if((effect = get_effect(name)) == NULL)
+        set_error(context, AL_INVALID_NAME);
+    else get_typed(context, &effect->type, effect->values, NULL_EFFECT_VALUES, param, fout, iout);
+}
+
+static void set_filter(ALuint name, ALenum param, const ALfloat *fin, const ALint *iin)
+{
+    ALCcontext *context = get_context();
+    struct null_filter *filter;
+
+    if(context == NULL)
+        return;
+
+    if((filter = get_filter(name)) == NULL)
+        set_error(context, AL_INVALID_NAME);
+    else set_typed(context, &filter->type, filter->values, NULL_FILTER_VALUES, AL_FILTER_BANDPASS, param, fin, iin);
+}
+
+static void get_filter_values(ALuint name, ALenum param, ALfloat *fout, ALint *iout)
+{
+    ALCcontext *context = get_context();
+    struct null_filter *filter;
+
+    if(context == NULL)
+        return;
+
+    if((filter = get_filter(name)) == NULL)
+        set_error(context, AL_INVALID_NAME);
+    else get_typed(context, &filter->type, filter->values, NULL_FILTER_VALUES, param, fout, iout);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGenEffects)(ALsizei n, ALuint *names)
+{
+    gen_typed(effects_used, NULL_MAX_EFFECTS, n, names, (char *)effects, sizeof(struct null_effect));
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alDeleteEffects)(ALsizei n, ALuint *names)
+{
+    delete_typed(effects_used, NULL_MAX_EFFECTS, n, names);
+}
+
+NULL_EXPORT ALboolean AL_APIENTRY NULL_API(alIsEffect)(ALuint eid)
+{
+    return (get_context() != NULL && (eid == 0 || get_effect(eid) != NULL)) ? AL_TRUE : AL_FALSE;
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alEffectf)(ALuint eid, ALenum param, ALfloat value)
+{
+    set_effect(eid, param, &value, NULL);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alEffectfv)(ALuint eid, ALenum param, ALfloat *values)
+{
+    set_effect(eid, param, values, NULL);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alEffecti)(ALuint eid, ALenum param, ALint value)
+{
+    set_effect(eid, param, NULL, &value);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alEffectiv)(ALuint eid, ALenum param, ALint *values)
+{
+    set_effect(eid, param, NULL, values);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetEffectf)(ALuint eid, ALenum pname, ALfloat *value)
+{
+    get_effect_values(eid, pname, value, NULL);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetEffectfv)(ALuint eid, ALenum pname, ALfloat *values)
+{
+    get_effect_values(eid, pname, values, NULL);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetEffecti)(ALuint eid, ALenum pname, ALint *value)
+{
+    get_effect_values(eid, pname, NULL, value);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetEffectiv)(ALuint eid, ALenum pname, ALint *values)
+{
+    get_effect_values(eid, pname, NULL, values);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGenFilters)(ALsizei n, ALuint *names)
+{
+    gen_typed(filters_used, NULL_MAX_FILTERS, n, names, (char *)filters, sizeof(struct null_filter));
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alDeleteFilters)(ALsizei n, ALuint *names)
+{
+    delete_typed(filters_used, NULL_MAX_FILTERS, n, names);
+}
+
+NULL_EXPORT ALboolean AL_APIENTRY NULL_API(alIsFilter)(ALuint fid)
+{
+    return (get_context() != NULL && (fid == 0 || get_filter(fid) != NULL)) ? AL_TRUE : AL_FALSE;
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alFilterf)(ALuint fid, ALenum param, ALfloat value)
+{
+    set_filter(fid, param, &value, NULL);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alFilterfv)(ALuint fid, ALenum param, ALfloat *values)
+{
+    set_filter(fid, param, values, NULL);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alFilteri)(ALuint fid, ALenum param, ALint value)
+{
+    set_filter(fid, param, NULL, &value);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alFilteriv)(ALuint fid, ALenum param, ALint *values)
+{
+    set_filter(fid, param, NULL, values);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetFilterf)(ALuint fid, ALenum pname, ALfloat *value)
+{
+    get_filter_values(fid, pname, value, NULL);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetFilterfv)(ALuint fid, ALenum pname, ALfloat *values)
+{
+    get_filter_values(fid, pname, values, NULL);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetFilteri)(ALuint fid, ALenum pname, ALint *value)
+{
+    get_filter_values(fid, pname, NULL, value);
+}
+
+NULL_EXPORT void AL_APIENTRY NULL_API(alGetFilteriv)(ALuint fid, ALenum pname, ALint *values)
+{
+    get_filter_values(fid, pname, NULL, values);
+}
+
+/* Mixing and resampling scratch space, only
+ * ever touched by the render loop under the lock */
+static ALfloat mix_buffer[2][NULL_BLOCK];
+static ALfloat source_buffer[2][NULL_BLOCK];
+static ALubyte callback_data[NULL_BLOCK * 4]; /* 16-bit stereo at most */
+
+/**
+ * Adds scaled samples to a mix, the kernel every
+ * source goes through once per output channel
+ * @param dst       Mix to add to
+ * @param src       Samples to add
+ * @param gain      Gain of the samples
+ * @param count     Number of samples
+ */
+static void mix_samples(ALfloat *dst, const ALfloat *src, ALfloat gain, int count)
+{
+    int i = 0;
+
+#if defined(NULL_SSE)
+    __m128 g = _mm_set1_ps(gain);
+
+    for(; i + 4 <= count; i += 4)
+        _mm_storeu_ps(&dst[i], _mm_add_ps(_mm_loadu_ps(&dst[i]), _mm_mul_ps(_mm_loadu_ps(&src[i]), g)));
+#elif defined(NULL_NEON)
+    float32x4_t g = vdupq_n_f32(gain);
+
+    for(; i + 4 <= count; i += 4)
+        vst1q_f32(&dst[i], vmlaq_f32(vld1q_f32(&dst[i]), vld1q_f32(&src[i]), g));
+#endif
+
+    for(; i < count; ++i)
+        dst[i] += src[i] * gain;
+}
+
+/**
+ * Pulls the next block of a callback buffer once the source
+ * has played the previous one; a short block is played to its
+ * end before the source stops. Called with the lock held, like
+ * any other driver the callback runs on the mixer
+ * @param source    Source playing the buffer
+ * @param buffer    Callback buffer
+ * @returns         Zero if the callback has ended the stream
+ */
+static int pull_callback(struct null_source *source, struct null_buffer *buffer)
+{
+    ALsizei frame_size = buffer->bits / 8 * buffer->channels;
+    ALsizei frames;
+
+    while(source->position >= buffer->frames) {
+        if(buffer->ended)
+            return 0;
+
+        source->position -= buffer->frames;
+        frames = buffer->callback(buffer->userptr, callback_data, NULL_BLOCK * frame_size) / frame_size;
+        if(frames < NULL_BLOCK)
+            buffer->ended = 1;
+        if(frames < 0)
+            frames = 0;
+
+        convert_into(buffer->samples, callback_data, frames * buffer->channels, buffer->bits);
+        buffer->frames = frames;
+    }
+
+    return 1;
+}
+
+/**
+ * Resamples the next frames of a playing source into
+ * source_buffer, moving on through its queue; the source
+ * stops once the queue runs out unless it loops.
+ * Samples are interpolated linearly within a buffer
+ * @param source    Source to read
+ * @param step      Fixed-point resampling step
+ * @param count     Number of frames to read
+ * @returns         Number of frames read
+ */
+static int read_source(struct null_source *source, ALuint step, int count)
+{
+    struct null_buffer *buffer;
+    const ALfloat *a;
+    const ALfloat *b;
+    ALfloat t;
+    ALsizei skipped = 0;
+    int channels;
+    int i = 0;
+    int c;
+
+    while(i < count) {
+        buffer = &buffers[source->queue[source->current] - 1];
+
+        if(buffer->callback != NULL && !pull_callback(source, buffer)) {
+            stop_source(source);
+            break;
+        }
+
+        if(source->position >= buffer->frames) {
+            /* A queue of empty buffers would loop forever */
+            if(++skipped > source->queued) {
+                stop_source(source);
+                break;
+            }
+
+            source->position -= buffer->frames;
+            set_current(source, source->current + 1);
+
+            if(source->current < source->queued)
+                continue;
+
+            if(source->values[SOURCE_LOOPING] == 0.0f) {
+                stop_source(source);
+                break;
+            }
+
+            set_current(source, 0);
+            continue;
+        }
+
+        skipped = 0;
+        channels = buffer->channels;
+
+        for(; i < count && source->position < buffer->frames; ++i) {
+            a = &buffer->samples[source->position * channels];
+            b = (source->position + 1 < buffer->frames) ? a + channels : a;
+            t = (ALfloat)source->fraction * (1.0f / FRACTION_ONE);
+
+            for(c = 0; c < channels; ++c)
+                source_buffer[c][i] = a[c] + (b[c] - a[c]) * t;
+
+            source->fraction += step;
+            source->position += (ALsizei)(source->fraction >> FRACTION_BITS);
+            source->fraction &= FRACTION_MASK;
+        }
+    }
+
+    return i;
+}
+
+/**
+ * Works out the left and right gains of a source with the
+ * inverse clamped distance model and constant power panning;
+ * stereo buffers are only attenuated, never panned
+ * @param context   Context of the source
+ * @param source    Source to pan
+ * @param channels  Number of channels of its buffers
+ * @param gains     Left and right gains
+ */
+static void source_gains(const ALCcontext *context, const struct null_source *source, int channels, ALfloat gains[2])
+{
+    const ALfloat *listener = context->listener;
+    const ALfloat *at = &listener[LISTENER_ORIENTATION];
+    const ALfloat *up = &listener[LISTENER_ORIENTATION + 3];
+    ALfloat reference = source->values[SOURCE_REFERENCE_DISTANCE];
+    ALfloat rolloff = source->values[SOURCE_ROLLOFF_FACTOR];
+    ALfloat position[3];
+    ALfloat right[3];
+    ALfloat distance;
+    ALfloat length;
+    ALfloat gain;
+    ALfloat pan;
+    int i;
+
+    for(i = 0; i < 3; ++i) {
+        position[i] = source->values[SOURCE_POSITION + i];
+        if(source->values[SOURCE_RELATIVE] == 0.0f)
+            position[i] -= listener[LISTENER_POSITION + i];
+    }
+
+    distance = (ALfloat)sqrt(position[0] * position[0] + position[1] * position[1] + position[2] * position[2]);
+
+    gain = source->values[SOURCE_GAIN];
+    if(distance > reference && reference > 0.0f)
+        gain *= reference / (reference + rolloff * ((distance < source->values[SOURCE_MAX_DISTANCE] ? distance : source->values[SOURCE_MAX_DISTANCE]) - reference));
+
+    if(gain < source->values[SOURCE_MIN_GAIN])
+        gain = source->values[SOURCE_MIN_GAIN];
+    if(gain > source->values[SOURCE_MAX_GAIN])
+        gain = source->values[SOURCE_MAX_GAIN];
+    gain *= listener[LISTENER_GAIN];
+
+    if(channels != 1 || context->device->channels == ALC_MONO_SOFT) {
+        gains[0] = gain;
+        gains[1] = gain;
+        return;
+    }
+
+    /* Listener space right vector is at x up */
+    right[0] = at[1] * up[2] - at[2] * up[1];
+    right[1] = at[2] * up[0] - at[0] * up[2];
+    right[2] = at[0] * up[1] - at[1] * up[0];
+    length = (ALfloat)sqrt(right[0] * right[0] + right[1] * right[1] + right[2] * right[2]);
+
+    pan = 0.0f;
+    if(distance > 0.0f && length > 0.0f) {
+        if(source->values[SOURCE_RELATIVE] != 0.0f)
+            pan = position[0] / distance;
+        else pan = (position[0] * right[0] + position[1] * right[1] + position[2] * right[2]) / (distance * length);
+    }
+
+    gains[0] = gain * (ALfloat)sqrt((1.0f - pan) * 0.5f);
+    gains[1] = gain * (ALfloat)sqrt((1.0f + pan) * 0.5f);
+}
+
+/**
+ * Mixes a single block of every source that plays
+ * on any context of a device into mix_buffer
+ * @param device    Device to render
+ * @param count     Number of frames, at most NULL_BLOCK
+ */
+static void render_block(ALCdevice *device, int count)
+{
+    struct null_source *source;
+    const struct null_buffer *buffer;
+    ALfloat gains[2];
+    ALdouble step;
+    int channels;
+    int frames;
+    int i;
+
+    memset(mix_buffer, 0, sizeof(mix_buffer));
+
+    for(i = 0; i < NULL_MAX_SOURCES; ++i) {
+        source = &sources[i];
+        if(!sources_used[i] || source->state != AL_PLAYING || source->context->device != device)
+            continue;
+
+        buffer = &buffers[source->queue[source->current] - 1];
+        channels = buffer->channels;
+        source_gains(source->context, source, channels, gains);
+
+        step = (ALdouble)source->values[SOURCE_PITCH] * buffer->frequency / device->frequency;
+        if(step > NULL_MAX_PITCH)
+            step = NULL_MAX_PITCH;
+
+        frames = read_source(source, (step * FRACTION_ONE >= 1.0) ? (ALuint)(step * FRACTION_ONE + 0.5) : 1, count);
+
+        if(device->channels == ALC_MONO_SOFT) {
+            mix_samples(mix_buffer[0], source_buffer[0], (channels == 1) ? gains[0] : gains[0] * 0.5f, frames);
+            if(channels == 2)
+                mix_samples(mix_buffer[0], source_buffer[1], gains[1] * 0.5f, frames);
+        }
+        else {
+            mix_samples(mix_buffer[0], source_buffer[0], gains[0], frames);
+            mix_samples(mix_buffer[1], source_buffer[channels - 1], gains[1], frames);
+        }
+    }
+}
+
+static ALCint sample_size(ALCenum type)
+{
+    switch(type) {
+        case ALC_BYTE_SOFT:
+        case ALC_UNSIGNED_BYTE_SOFT:
+            return 1;
+        case ALC_SHORT_SOFT:
+        case ALC_UNSIGNED_SHORT_SOFT:
+            return 2;
+        case ALC_INT_SOFT:
+        case ALC_UNSIGNED_INT_SOFT:
+        case ALC_FLOAT_SOFT:
+            return 4;
+    }
+
+    return 0;
+}
+
+static ALCint channel_count(ALCenum channels)
+{
+    switch(channels) {
+        case ALC_MONO_SOFT:     return 1;
+        case ALC_STEREO_SOFT:   return 2;
+    }
+
+    return 0;
+}
+
+/**
+ * Clamps the mix and stores it in the output format of a device
+ * @param device    Device to write for
+ * @param out       Output samples
+ * @param count     Number of frames
+ * @returns         Output pointer past the written frames
+ */
+static char *write_block(const ALCdevice *device, char *out, int count)
+{
+    int channels = channel_count(device->channels);
+    ALfloat value;
+    int i;
+    int c;
+
+    for(i = 0; i < count; ++i) {
+        for(c = 0; c < channels; ++c) {
+            value = mix_buffer[c][i];
+            if(value > 1.0f)
+                value = 1.0f;
+            if(value < -1.0f)
+                value = -1.0f;
+
+            switch(device->type) {
+                case ALC_BYTE_SOFT:
+                    *(ALbyte *)out = (ALbyte)(value * 127.0f);
+                    break;
+                case ALC_UNSIGNED_BYTE_SOFT:
+                    *(ALubyte *)out = (ALubyte)(value * 127.0f + 128.0f);
+                    break;
+                case ALC_SHORT_SOFT:
+                    *(ALshort *)out = (ALshort)(value * 32767.0f);
+                    break;
+                case ALC_UNSIGNED_SHORT_SOFT:
+                    *(ALushort *)out = (ALushort)(value * 32767.0f + 32768.0f);
+                    break;
+                case ALC_INT_SOFT:
+                    *(ALint *)out = (ALint)((ALdouble)value * 2147483647.0);
+                    break;
+                case ALC_UNSIGNED_INT_SOFT:
+                    *(ALuint *)out = (ALuint)((ALdouble)value * 2147483647.0 + 2147483648.0);
+                    break;
+                default:
+                    *(ALfloat *)out = value;
+                    break;
+            }
+
+            out += sample_size(device->type);
+        }
+    }
+
+    return out;
+}
+
+static ALCcontext *get_alc_context(ALCcontext *context)
+{
+    int i;
+
+    for(i = 0; i < NULL_MAX_CONTEXTS; ++i) {
+        if(context == &contexts[i] && contexts[i].used)
+            return context;
+        continue;
+    }
+
+    return NULL;
+}
+
+static ALCdevice *open_device(int capture)
+{
+    int i;
+
+    for(i = 0; i < NULL_MAX_DEVICES; ++i) {
+        if(devices[i].used)
+            continue;
+        memset(&devices[i], 0, sizeof(ALCdevice));
+        devices[i].used = 1;
+        devices[i].capture = capture;
+        devices[i].error = ALC_NO_ERROR;
+        devices[i].frequency = NULL_FREQUENCY;
+        devices[i].channels = ALC_STEREO_SOFT;
+        devices[i].type = ALC_FLOAT_SOFT;
+        return &devices[i];
+    }
+
+    null_error = ALC_OUT_OF_MEMORY;
+    return NULL;
+}
+
+NULL_EXPORT ALCdevice *ALC_APIENTRY NULL_API(alcOpenDevice)(const ALCchar *devicename)
+{
+    ALCdevice *device = NULL;
+
+    null_lock();
+
+    if(devicename != NULL && strcmp((const char *)devicename, NULL_OUTPUT_NAME) != 0)
+        null_error = ALC_INVALID_VALUE;
+    else device = open_device(0);
+
+    null_unlock();
+
+    return device;
+}
+
+NULL_EXPORT ALCboolean ALC_APIENTRY NULL_API(alcCloseDevice)(ALCdevice *device)
+{
+    int i;
+
+    null_lock();
+
+    if(get_device(device) == NULL || device->capture) {
+        null_error = ALC_INVALID_DEVICE;
+        null_unlock();
+        return ALC_FALSE;
+    }
+
+    /* Contexts left behind go away with the device */
+    for(i = 0; i < NULL_MAX_CONTEXTS; ++i) {
+        if(!contexts[i].used || contexts[i].device != device)
+            continue;
+        if(current_context == &contexts[i])
+            current_context = NULL;
+        if(thread_context == &contexts[i])
+            thread_context = NULL;
+        contexts[i].used = 0;
+    }
+
+    device->used = 0;
+
+    null_unlock();
+
+    return ALC_TRUE;
+}
+
+NULL_EXPORT ALCcontext *ALC_APIENTRY NULL_API(alcCreateContext)(ALCdevice *device, const ALCint *attrlist)
+{
+    ALCcontext *context = NULL;
+    ALCint frequency = 0;
+    ALCenum channels = 0;
+    ALCenum type = 0;
+    int i;
+
+    null_lock();
+
+    if(get_device(device) == NULL || device->capture) {
+        null_error = ALC_INVALID_DEVICE;
+        null_unlock();
+        return NULL;
+    }
+
+    for(i = 0; attrlist != NULL && attrlist[i] != 0; i += 2) {
+        if(attrlist[i] == ALC_FREQUENCY)
+            frequency = attrlist[i + 1];
+        else if(attrlist[i] == ALC_FORMAT_CHANNELS_SOFT)
+            channels = attrlist[i + 1];
+        else if(attrlist[i] == ALC_FORMAT_TYPE_SOFT)
+            type = attrlist[i + 1];
+        continue;
+    }
+
+    /* Loopback devices have no format of their own,
+     * the first context has to name all of it */
+    if(device->loopback && (channel_count(channels) == 0 || sample_size(type) == 0 || frequency <= 0)) {
+        device->error = ALC_INVALID_VALUE;
+        null_unlock();
+        return NULL;
+    }
+
+    if(frequency > 0)
+        device->frequency = frequency;
+    if(device->loopback) {
+        device->channels = channels;
+        device->type = type;
+    }
+
+    for(i = 0; i < NULL_MAX_CONTEXTS; ++i) {
+        if(contexts[i].used)
+            continue;
+
+        context = &contexts[i];
+        context->used = 1;
+        context->device = device;
+        context->error = AL_NO_ERROR;
+        context->deferred = AL_FALSE;
+
+        init_values(context->listener, listener_params);
+        context->listener[LISTENER_ORIENTATION + 2] = -1.0f;
+        context->listener[LISTENER_ORIENTATION + 4] = 1.0f;
+        break;
+    }
+
+    if(context == NULL)
+        device->error = ALC_OUT_OF_MEMORY;
+
+    null_unlock();
+
+    return context;
+}
+
+NULL_EXPORT void ALC_APIENTRY NULL_API(alcDestroyContext)(ALCcontext *context)
+{
+    null_lock();
+
+    if(get_alc_context(context) != NULL) {
+        if(current_context == context)
+            current_context = NULL;
+        if(thread_context == context)
+            thread_context = NULL;
+        context->used = 0;
+    }
+    else {
+        null_error = ALC_INVALID_CONTEXT;
+    }
+
+    null_unlock();
+}
+
+NULL_EXPORT ALCboolean ALC_APIENTRY NULL_API(alcMakeContextCurrent)(ALCcontext *context)
+{
+    ALCboolean result = ALC_TRUE;
+
+    null_lock();
+
+    if(context == NULL || get_alc_context(context) != NULL)
+        current_context = context;
+    else {
+        null_error = ALC_INVALID_CONTEXT;
+        result = ALC_FALSE;
+    }
+
+    null_unlock();
+
+    return result;
+}
+
+NULL_EXPORT ALCcontext *ALC_APIENTRY NULL_API(alcGetCurrentContext)(void)
+{
+    return get_context();
+}
+
+NULL_EXPORT ALCboolean ALC_APIENTRY NULL_API(alcSetThreadContext)(ALCcontext *context)
+{
+    ALCboolean result = ALC_TRUE;
+
+    null_lock();
+
+    if(context == NULL || get_alc_context(context) != NULL)
+        thread_context = context;
+    else {
+        null_error = ALC_INVALID_CONTEXT;
+        result = ALC_FALSE;
+    }
+
+    null_unlock();
+
+    return result;
+}
+
+NULL_EXPORT ALCcontext *ALC_APIENTRY NULL_API(alcGetThreadContext)(void)
+{
+    return (thread_context != NULL && thread_context->used) ? thread_context : NULL;
+}
+
+NULL_EXPORT ALCdevice *ALC_APIENTRY NULL_API(alcGetContextsDevice)(ALCcontext *context)
+{
+    if(get_alc_context(context) == NULL) {
+        null_error = ALC_INVALID_CONTEXT;
+        return NULL;
+    }
+
+    return context->device;
+}
+
+NULL_EXPORT void ALC_APIENTRY NULL_API(alcProcessContext)(ALCcontext *context)
+{
+    if(get_alc_context(context) == NULL)
+        null_error = ALC_INVALID_CONTEXT;
+}
+
+NULL_EXPORT void ALC_APIENTRY NULL_API(alcSuspendContext)(ALCcontext *context)
+{
+    NULL_API(alcProcessContext)(context);
+}
+
+NULL_EXPORT ALCenum ALC_APIENTRY NULL_API(alcGetError)(ALCdevice *device)
+{
+    ALCenum error;
+
+    if(device != NULL && get_device(device) == NULL)
+        return ALC_INVALID_DEVICE;
+
+    if(device != NULL) {
+        error = device->error;
+        device->error = ALC_NO_ERROR;
+        return error;
+    }
+
+    error = null_error;
+    null_error = ALC_NO_ERROR;
+    return error;
+}
+
+NULL_EXPORT const ALCchar *ALC_APIENTRY NULL_API(alcGetString)(ALCdevice *device, ALCenum param)
+{
+    const char *value = NULL;
+
+    /* Device lists end with an empty string, which
+     * the string literal terminator takes care of */
+    switch(param) {
+        case ALC_NO_ERROR:                          value = "No Error"; break;
+        case ALC_INVALID_DEVICE:                    value = "Invalid Device"; break;
+        case ALC_INVALID_CONTEXT:                   value = "Invalid Context"; break;
+        case ALC_INVALID_ENUM:                      value = "Invalid Enum"; break;
+        case ALC_INVALID_VALUE:                     value = "Invalid Value"; break;
+        case ALC_OUT_OF_MEMORY:                     value = "Out of Memory"; break;
+        case ALC_DEFAULT_DEVICE_SPECIFIER:          value = NULL_OUTPUT_NAME; break;
+        case ALC_DEFAULT_ALL_DEVICES_SPECIFIER:     value = NULL_OUTPUT_NAME; break;
+        case ALC_CAPTURE_DEFAULT_DEVICE_SPECIFIER:  value = NULL_CAPTURE_NAME; break;
+        case ALC_EXTENSIONS:                        value = alc_extensions; break;
+        case ALC_DEVICE_SPECIFIER:
+        case ALC_ALL_DEVICES_SPECIFIER:
+            value = (device != NULL) ? NULL_OUTPUT_NAME : NULL_OUTPUT_NAME "\0";
+            break;
+        case ALC_CAPTURE_DEVICE_SPECIFIER:
+            value = (device != NULL) ? NULL_CAPTURE_NAME : NULL_CAPTURE_NAME "\0";
+            break;
+        default:
+            set_alc_error(device, ALC_INVALID_ENUM);
+            break;
+    }
+
+    return (const ALCchar *)value;
+}
+
+NULL_EXPORT void ALC_APIENTRY NULL_API(alcGetIntegerv)(ALCdevice *device, ALCenum param, ALCsizei size, ALCint *values)
+{
+    ALCdevice *d = get_device(device);
+    ALCint value;
+
+    if(values == NULL || size <= 0) {
+        set_alc_error(device, ALC_INVALID_VALUE);
+        return;
+    }
+
+    switch(param) {
+        case ALC_MAJOR_VERSION:
+        case ALC_MINOR_VERSION:
+        case ALC_EFX_MAJOR_VERSION:
+            values[0] = 1;
+            return;
+        case ALC_EFX_MINOR_VERSION:
+            values[0] = 0;
+            return;
+    }
+
+    if(d == NULL) {
+        set_alc_error(device, ALC_INVALID_DEVICE);
+        return;
+    }
+
+    switch(param) {
+        case ALC_FREQUENCY:             value = d->frequency; break;
+        case ALC_REFRESH:               value = NULL_REFRESH; break;
+        case ALC_SYNC:                  value = ALC_FALSE; break;
+        case ALC_MONO_SOURCES:          value = NULL_MAX_SOURCES - 1; break;
+        case ALC_STEREO_SOURCES:        value = 1; break;
+        case ALC_MAX_AUXILIARY_SENDS:   value = 0; break;
+        case ALC_ATTRIBUTES_SIZE:       value = 13; break;
+        case ALC_FORMAT_CHANNELS_SOFT:
+        case ALC_FORMAT_TYPE_SOFT:
+            if(!d->loopback) {
+                d->error = ALC_INVALID_ENUM;
+                return;
+            }
+
+            value = (param == ALC_FORMAT_CHANNELS_SOFT) ? d->channels : d->type;
+            break;
+        case ALC_CAPTURE_SAMPLES:
+            if(!d->capture) {
+                d->error = ALC_INVALID_ENUM;
+                return;
+            }
+
+            value = capture_frames(d);
+            break;
+        case ALC_ALL_ATTRIBUTES:
+            if(size < 13) {
+                d->error = ALC_INVALID_VALUE;
+                return;
+            }
+
+            values[0] = ALC_FREQUENCY;
+            values[1] = d->frequency;
+            values[2] = ALC_REFRESH;
+            values[3] = NULL_REFRESH;
+            values[4] = ALC_SYNC;
+            values[5] = ALC_FALSE;
+            values[6] = ALC_MONO_SOURCES;
+            values[7] = NULL_MAX_SOURCES - 1;
+            values[8] = ALC_STEREO_SOURCES;
+            values[9] = 1;
+            values[10] = ALC_MAX_AUXILIARY_SENDS;
+            values[11] = 0;
+            values[12] = 0;
+            return;
+        default:
+            d->error = ALC_INVALID_ENUM;
+            return;
+    }
+
+    values[0] = value;
+}
+
+NULL_EXPORT ALCboolean ALC_APIENTRY NULL_API(alcIsExtensionPresent)(ALCdevice *device, const ALCchar *extname)
+{
+    if(extname == NULL) {
+        set_alc_error(device, ALC_INVALID_VALUE);
+        return ALC_FALSE;
+    }
+
+    return has_word(alc_extensions, (const char *)extname) ? ALC_TRUE : ALC_FALSE;
+}
+
+NULL_EXPORT ALCdevice *ALC_APIENTRY NULL_API(alcCaptureOpenDevice)(const ALCchar *devicename, ALCuint frequency, ALCenum format, ALCsizei buffersize)
+{
+    ALCdevice *device = NULL;
+    ALint frame_size;
+    ALint bits;
+    ALint channels;
+
+    null_lock();
+
+    if(devicename != NULL && strcmp((const char *)devicename, NULL_CAPTURE_NAME) != 0)
+        null_error = ALC_INVALID_VALUE;
+    else if((frame_size = format_frame_size((ALenum)format, &bits, &channels)) == 0)
+        null_error = ALC_INVALID_ENUM;
+    else if(frequency == 0 || buffersize <= 0)
+        null_error = ALC_INVALID_VALUE;
+    else if((device = open_device(1)) != NULL) {
+        device->frequency = (ALCint)frequency;
+        device->frame_size = frame_size;
+        device->silence = (bits == 8) ? 0x80 : 0x00;
+        device->capture_size = buffersize;
+    }
+
+    null_unlock();
+
+    return device;
+}
+
+NULL_EXPORT ALCboolean ALC_APIENTRY NULL_API(alcCaptureCloseDevice)(ALCdevice *device)
+{
+    ALCboolean result = ALC_FALSE;
+
+    null_lock();
+
+    if(get_device(device) != NULL && device->capture) {
+        device->used = 0;
+        result = ALC_TRUE;
+    }
+    else {
+        null_error = ALC_INVALID_DEVICE;
+    }
+
+    null_unlock();
+
+    return result;
+}
+
+static void set_capturing(ALCdevice *device, int capturing)
+{
+    if(get_device(device) == NULL || !device->capture)
+        null_error = ALC_INVALID_DEVICE;
+    else {
+        if(capturing && !device->capturing)
+            device->capture_clock = null_now();
+        device->capturing = capturing;
+    }
+}
+
+NULL_EXPORT void ALC_APIENTRY NULL_API(alcCaptureStart)(ALCdevice *device)
+{
+    set_capturing(device, 1);
+}
+
+NULL_EXPORT void ALC_APIENTRY NULL_API(alcCaptureStop)(ALCdevice *device)
+{
+    set_capturing(device, 0);
+}
+
+NULL_EXPORT void ALC_APIENTRY NULL_API(alcCaptureSamples)(ALCdevice *device, ALCvoid *buffer, ALCsizei samples)
+{
+    if(get_device(device) == NULL || !device->capture) {
+        null_error = ALC_INVALID_DEVICE;
+        return;
+    }
+
+    if(samples < 0 || (samples > 0 && buffer == NULL) || samples > capture_frames(device)) {
+        device->error = ALC_INVALID_VALUE;
+        return;
+    }
+
+    memset(buffer, device->silence, (size_t)samples * (size_t)device->frame_size);
+    device->capture_clock += (double)samples / (double)device->frequency;
+}
+
+NULL_EXPORT ALCdevice *ALC_APIENTRY NULL_API(alcLoopbackOpenDeviceSOFT)(const ALCchar *deviceName)
+{
+    ALCdevice *device = NULL;
+
+    null_lock();
+
+    if(deviceName != NULL && strcmp((const char *)deviceName, NULL_OUTPUT_NAME) != 0)
+        null_error = ALC_INVALID_VALUE;
+    else if((device = open_device(0)) != NULL)
+        device->loopback = 1;
+
+    null_unlock();
+
+    return device;
+}
+
+NULL_EXPORT ALCboolean ALC_APIENTRY NULL_API(alcIsRenderFormatSupportedSOFT)(ALCdevice *device, ALCsizei freq, ALCenum channels, ALCenum type)
+{
+    if(get_device(device) == NULL || !device->loopback) {
+        null_error = ALC_INVALID_DEVICE;
+        return ALC_FALSE;
+    }
+
+    if(freq <= 0) {
+        device->error = ALC_INVALID_VALUE;
+        return ALC_FALSE;
+    }
+
+    return (channel_count(channels) != 0 && sample_size(type) != 0) ? ALC_TRUE : ALC_FALSE;
+}
+
+NULL_EXPORT void ALC_APIENTRY NULL_API(alcRenderSamplesSOFT)(ALCdevice *device, ALCvoid *buffer, ALCsizei samples)
+{
+    char *out = buffer;
+    int count;
+
+    null_lock();
+
+    if(get_device(device) == NULL || !device->loopback) {
+        null_error = ALC_INVALID_DEVICE;
+        null_unlock();
+        return;
+    }
+
+    if(samples < 0 || (samples > 0 && buffer == NULL)) {
+        device->error = ALC_INVALID_VALUE;
+        null_unlock();
+        return;
+    }
+
+    for(; samples > 0; samples -= count) {
+        count = (samples < NULL_BLOCK) ? samples : NULL_BLOCK;
+        render_block(device, count);
+        out = write_block(device, out, count);
+    }
+
+    null_unlock();
+}
+
+/* The lookup functions are in the table themselves */
+NULL_EXPORT ALenum AL_APIENTRY NULL_API(alGetEnumValue)(const ALchar *ename);
+NULL_EXPORT ALCenum ALC_APIENTRY NULL_API(alcGetEnumValue)(ALCdevice *device, const ALCchar *enumname);
+NULL_EXPORT void *AL_APIENTRY NULL_API(alGetProcAddress)(const ALchar *fname);
+NULL_EXPORT ALCvoid *ALC_APIENTRY NULL_API(alcGetProcAddress)(ALCdevice *device, const ALCchar *funcname);
+
+#define NULL_ENUM(name) { #name, name, NULL }
+#define NULL_PROC(name) { #name, 0, (void(*)(void))&NULL_API(name) }
+
+/* Sorted by name so lookups can be done with bsearch */
+static const struct null_name null_enums[] = {
+    NULL_ENUM(ALC_5POINT1_SOFT),
+    NULL_ENUM(ALC_6POINT1_SOFT),
+    NULL_ENUM(ALC_7POINT1_SOFT),
+    NULL_ENUM(ALC_ALL_ATTRIBUTES),
+    NULL_ENUM(ALC_ALL_DEVICES_SPECIFIER),
+    NULL_ENUM(ALC_ATTRIBUTES_SIZE),
+    NULL_ENUM(ALC_BYTE_SOFT),
+    NULL_ENUM(ALC_CAPTURE_DEFAULT_DEVICE_SPECIFIER),
+    NULL_ENUM(ALC_CAPTURE_DEVICE_SPECIFIER),
+    NULL_ENUM(ALC_CAPTURE_SAMPLES),
+    NULL_ENUM(ALC_DEFAULT_ALL_DEVICES_SPECIFIER),
+    NULL_ENUM(ALC_DEFAULT_DEVICE_SPECIFIER),
+    NULL_ENUM(ALC_DEVICE_SPECIFIER),
+    NULL_ENUM(ALC_EFX_MAJOR_VERSION),
+    NULL_ENUM(ALC_EFX_MINOR_VERSION),
+    NULL_ENUM(ALC_ENUMERATE_ALL_EXT),
+    NULL_ENUM(ALC_EXTENSIONS),
+    NULL_ENUM(ALC_EXT_CAPTURE),
+    NULL_ENUM(ALC_FALSE),
+    NULL_ENUM(ALC_FLOAT_SOFT),
+    NULL_ENUM(ALC_FORMAT_CHANNELS_SOFT),
+    NULL_ENUM(ALC_FORMAT_TYPE_SOFT),
+    NULL_ENUM(ALC_FREQUENCY),
+    NULL_ENUM(ALC_INT_SOFT),
+    NULL_ENUM(ALC_INVALID),
+    NULL_ENUM(ALC_INVALID_CONTEXT),
+    NULL_ENUM(ALC_INVALID_DEVICE),
+    NULL_ENUM(ALC_INVALID_ENUM),
+    NULL_ENUM(ALC_INVALID_VALUE),
+    NULL_ENUM(ALC_MAJOR_VERSION),
+    NULL_ENUM(ALC_MAX_AUXILIARY_SENDS),
+    NULL_ENUM(ALC_MINOR_VERSION),
+    NULL_ENUM(ALC_MONO_SOFT),
+    NULL_ENUM(ALC_MONO_SOURCES),
+    NULL_ENUM(ALC_NO_ERROR),
+    NULL_ENUM(ALC_OUT_OF_MEMORY),
+    NULL_ENUM(ALC_QUAD_SOFT),
+    NULL_ENUM(ALC_REFRESH),
+    NULL_ENUM(ALC_SHORT_SOFT),
+    NULL_ENUM(ALC_STEREO_SOFT),
+    NULL_ENUM(ALC_STEREO_SOURCES),
+    NULL_ENUM(ALC_SYNC),
+    NULL_ENUM(ALC_TRUE),
+    NULL_ENUM(ALC_UNSIGNED_BYTE_SOFT),
+    NULL_ENUM(ALC_UNSIGNED_INT_SOFT),
+    NULL_ENUM(ALC_UNSIGNED_SHORT_SOFT),
+    NULL_ENUM(AL_AIR_ABSORPTION_FACTOR),
+    NULL_ENUM(AL_AUTOWAH_ATTACK_TIME),
+    NULL_ENUM(AL_AUTOWAH_PEAK_GAIN),
+    NULL_ENUM(AL_AUTOWAH_RELEASE_TIME),
+    NULL_ENUM(AL_AUTOWAH_RESONANCE),
+    NULL_ENUM(AL_AUXILIARY_SEND_FILTER),
+    NULL_ENUM(AL_AUXILIARY_SEND_FILTER_GAINHF_AUTO),
+    NULL_ENUM(AL_AUXILIARY_SEND_FILTER_GAIN_AUTO),
+    NULL_ENUM(AL_BANDPASS_GAIN),
+    NULL_ENUM(AL_BANDPASS_GAINHF),
+    NULL_ENUM(AL_BANDPASS_GAINLF),
+    NULL_ENUM(AL_BITS),
+    NULL_ENUM(AL_BUFFER),
+    NULL_ENUM(AL_BUFFERS_PROCESSED),
+    NULL_ENUM(AL_BUFFERS_QUEUED),
+    NULL_ENUM(AL_BUFFER_CALLBACK_FUNCTION_SOFT),
+    NULL_ENUM(AL_BUFFER_CALLBACK_USER_PARAM_SOFT),
+    NULL_ENUM(AL_BYTE_OFFSET),
+    NULL_ENUM(AL_CHANNELS),
+    NULL_ENUM(AL_CHANNEL_MASK),
+    NULL_ENUM(AL_CHORUS_DELAY),
+    NULL_ENUM(AL_CHORUS_DEPTH),
+    NULL_ENUM(AL_CHORUS_FEEDBACK),
+    NULL_ENUM(AL_CHORUS_PHASE),
+    NULL_ENUM(AL_CHORUS_RATE),
+    NULL_ENUM(AL_CHORUS_WAVEFORM),
+    NULL_ENUM(AL_COMPRESSOR_ONOFF),
+    NULL_ENUM(AL_CONE_INNER_ANGLE),
+    NULL_ENUM(AL_CONE_OUTER_ANGLE),
+    NULL_ENUM(AL_CONE_OUTER_GAIN),
+    NULL_ENUM(AL_CONE_OUTER_GAINHF),
+    NULL_ENUM(AL_DEFERRED_UPDATES_SOFT),
+    NULL_ENUM(AL_DIRECTION),
+    NULL_ENUM(AL_DIRECT_FILTER),
+    NULL_ENUM(AL_DIRECT_FILTER_GAINHF_AUTO),
+    NULL_ENUM(AL_DISTANCE_MODEL),
+    NULL_ENUM(AL_DISTORTION_EDGE),
+    NULL_ENUM(AL_DISTORTION_EQBANDWIDTH),
+    NULL_ENUM(AL_DISTORTION_EQCENTER),
+    NULL_ENUM(AL_DISTORTION_GAIN),
+    NULL_ENUM(AL_DISTORTION_LOWPASS_CUTOFF),
+    NULL_ENUM(AL_DOPPLER_FACTOR),
+    NULL_ENUM(AL_DOPPLER_VELOCITY),
+    NULL_ENUM(AL_ECHO_DAMPING),
+    NULL_ENUM(AL_ECHO_DELAY),
+    NULL_ENUM(AL_ECHO_FEEDBACK),
+    NULL_ENUM(AL_ECHO_LRDELAY),
+    NULL_ENUM(AL_ECHO_SPREAD),
+    NULL_ENUM(AL_EFFECTSLOT_AUXILIARY_SEND_AUTO),
+    NULL_ENUM(AL_EFFECTSLOT_EFFECT),
+    NULL_ENUM(AL_EFFECTSLOT_GAIN),
+    NULL_ENUM(AL_EFFECTSLOT_NULL),
+    NULL_ENUM(AL_EFFECT_AUTOWAH),
+    NULL_ENUM(AL_EFFECT_CHORUS),
+    NULL_ENUM(AL_EFFECT_COMPRESSOR),
+    NULL_ENUM(AL_EFFECT_DISTORTION),
+    NULL_ENUM(AL_EFFECT_ECHO),
+    NULL_ENUM(AL_EFFECT_EQUALIZER),
+    NULL_ENUM(AL_EFFECT_FIRST_PARAMETER),
+    NULL_ENUM(AL_EFFECT_FLANGER),
+    NULL_ENUM(AL_EFFECT_FREQUENCY_SHIFTER),
+    NULL_ENUM(AL_EFFECT_LAST_PARAMETER),
+    NULL_ENUM(AL_EFFECT_NULL),
+    NULL_ENUM(AL_EFFECT_PITCH_SHIFTER),
+    NULL_ENUM(AL_EFFECT_REVERB),
+    NULL_ENUM(AL_EFFECT_RING_MODULATOR),
+    NULL_ENUM(AL_EFFECT_TYPE),
+    NULL_ENUM(AL_EFFECT_VOCAL_MORPHER),
+    NULL_ENUM(AL_EQUALIZER_HIGH_CUTOFF),
+    NULL_ENUM(AL_EQUALIZER_HIGH_GAIN),
+    NULL_ENUM(AL_EQUALIZER_LOW_CUTOFF),
+    NULL_ENUM(AL_EQUALIZER_LOW_GAIN),
+    NULL_ENUM(AL_EQUALIZER_MID1_CENTER),
+    NULL_ENUM(AL_EQUALIZER_MID1_GAIN),
+    NULL_ENUM(AL_EQUALIZER_MID1_WIDTH),
+    NULL_ENUM(AL_EQUALIZER_MID2_CENTER),
+    NULL_ENUM(AL_EQUALIZER_MID2_GAIN),
+    NULL_ENUM(AL_EQUALIZER_MID2_WIDTH),
+    NULL_ENUM(AL_EXPONENT_DISTANCE),
+    NULL_ENUM(AL_EXPONENT_DISTANCE_CLAMPED),
+    NULL_ENUM(AL_EXTENSIONS),
+    NULL_ENUM(AL_FALSE),
+    NULL_ENUM(AL_FILTER_BANDPASS),
+    NULL_ENUM(AL_FILTER_FIRST_PARAMETER),
+    NULL_ENUM(AL_FILTER_HIGHPASS),
+    NULL_ENUM(AL_FILTER_LAST_PARAMETER),
+    NULL_ENUM(AL_FILTER_LOWPASS),
+    NULL_ENUM(AL_FILTER_NULL),
+    NULL_ENUM(AL_FILTER_TYPE),
+    NULL_ENUM(AL_FLANGER_DELAY),
+    NULL_ENUM(AL_FLANGER_DEPTH),
+    NULL_ENUM(AL_FLANGER_FEEDBACK),
+    NULL_ENUM(AL_FLANGER_PHASE),
+    NULL_ENUM(AL_FLANGER_RATE),
+    NULL_ENUM(AL_FLANGER_WAVEFORM),
+    NULL_ENUM(AL_FORMAT_MONO16),
+    NULL_ENUM(AL_FORMAT_MONO8),
+    NULL_ENUM(AL_FORMAT_MONO_FLOAT32),
+    NULL_ENUM(AL_FORMAT_STEREO16),
+    NULL_ENUM(AL_FORMAT_STEREO8),
+    NULL_ENUM(AL_FORMAT_STEREO_FLOAT32),
+    NULL_ENUM(AL_FREQUENCY),
+    NULL_ENUM(AL_FREQUENCY_SHIFTER_FREQUENCY),
+    NULL_ENUM(AL_FREQUENCY_SHIFTER_LEFT_DIRECTION),
+    NULL_ENUM(AL_FREQUENCY_SHIFTER_RIGHT_DIRECTION),
+    NULL_ENUM(AL_GAIN),
+    NULL_ENUM(AL_HIGHPASS_GAIN),
+    NULL_ENUM(AL_HIGHPASS_GAINLF),
+    NULL_ENUM(AL_INITIAL),
+    NULL_ENUM(AL_INVALID),
+    NULL_ENUM(AL_INVALID_ENUM),
+    NULL_ENUM(AL_INVALID_NAME),
+    NULL_ENUM(AL_INVALID_OPERATION),
+    NULL_ENUM(AL_INVALID_VALUE),
+    NULL_ENUM(AL_INVERSE_DISTANCE),
+    NULL_ENUM(AL_INVERSE_DISTANCE_CLAMPED),
+    NULL_ENUM(AL_LINEAR_DISTANCE),
+    NULL_ENUM(AL_LINEAR_DISTANCE_CLAMPED),
+    NULL_ENUM(AL_LOOPING),
+    NULL_ENUM(AL_LOWPASS_GAIN),
+    NULL_ENUM(AL_LOWPASS_GAINHF),
+    NULL_ENUM(AL_MAX_DISTANCE),
+    NULL_ENUM(AL_MAX_GAIN),
+    NULL_ENUM(AL_METERS_PER_UNIT),
+    NULL_ENUM(AL_MIN_GAIN),
+    NULL_ENUM(AL_NONE),
+    NULL_ENUM(AL_NO_ERROR),
+    NULL_ENUM(AL_ORIENTATION),
+    NULL_ENUM(AL_OUT_OF_MEMORY),
+    NULL_ENUM(AL_PAUSED),
+    NULL_ENUM(AL_PENDING),
+    NULL_ENUM(AL_PITCH),
+    NULL_ENUM(AL_PITCH_SHIFTER_COARSE_TUNE),
+    NULL_ENUM(AL_PITCH_SHIFTER_FINE_TUNE),
+    NULL_ENUM(AL_PLAYING),
+    NULL_ENUM(AL_POSITION),
+    NULL_ENUM(AL_PROCESSED),
+    NULL_ENUM(AL_REFERENCE_DISTANCE),
+    NULL_ENUM(AL_RENDERER),
+    NULL_ENUM(AL_REVERB_AIR_ABSORPTION_GAINHF),
+    NULL_ENUM(AL_REVERB_DECAY_HFLIMIT),
+    NULL_ENUM(AL_REVERB_DECAY_HFRATIO),
+    NULL_ENUM(AL_REVERB_DECAY_TIME),
+    NULL_ENUM(AL_REVERB_DENSITY),
+    NULL_ENUM(AL_REVERB_DIFFUSION),
+    NULL_ENUM(AL_REVERB_GAIN),
+    NULL_ENUM(AL_REVERB_GAINHF),
+    NULL_ENUM(AL_REVERB_LATE_REVERB_DELAY),
+    NULL_ENUM(AL_REVERB_LATE_REVERB_GAIN),
+    NULL_ENUM(AL_REVERB_REFLECTIONS_DELAY),
+    NULL_ENUM(AL_REVERB_REFLECTIONS_GAIN),
+    NULL_ENUM(AL_REVERB_ROOM_ROLLOFF_FACTOR),
+    NULL_ENUM(AL_RING_MODULATOR_FREQUENCY),
+    NULL_ENUM(AL_RING_MODULATOR_HIGHPASS_CUTOFF),
+    NULL_ENUM(AL_RING_MODULATOR_WAVEFORM),
+    NULL_ENUM(AL_ROLLOFF_FACTOR),
+    NULL_ENUM(AL_ROOM_ROLLOFF_FACTOR),
+    NULL_ENUM(AL_SAMPLE_OFFSET),
+    NULL_ENUM(AL_SEC_OFFSET),
+    NULL_ENUM(AL_SIZE),
+    NULL_ENUM(AL_SOURCE_RELATIVE),
+    NULL_ENUM(AL_SOURCE_STATE),
+    NULL_ENUM(AL_SOURCE_TYPE),
+    NULL_ENUM(AL_SPEED_OF_SOUND),
+    NULL_ENUM(AL_STATIC),
+    NULL_ENUM(AL_STOPPED),
+    NULL_ENUM(AL_STREAMING),
+    NULL_ENUM(AL_TRUE),
+    NULL_ENUM(AL_UNDETERMINED),
+    NULL_ENUM(AL_UNUSED),
+    NULL_ENUM(AL_VELOCITY),
+    NULL_ENUM(AL_VENDOR),
+    NULL_ENUM(AL_VERSION),
+    NULL_ENUM(AL_VOCAL_MORPHER_PHONEMEA),
+    NULL_ENUM(AL_VOCAL_MORPHER_PHONEMEA_COARSE_TUNING),
+    NULL_ENUM(AL_VOCAL_MORPHER_PHONEMEB),
+    NULL_ENUM(AL_VOCAL_MORPHER_PHONEMEB_COARSE_TUNING),
+    NULL_ENUM(AL_VOCAL_MORPHER_RATE),
+    NULL_ENUM(AL_VOCAL_MORPHER_WAVEFORM),
+};
+
+/* Sorted by name so lookups can be done with bsearch */
+static const struct null_name null_procs[] = {
+    NULL_PROC(alBuffer3f),
+    NULL_PROC(alBuffer3i),
+    NULL_PROC(alBufferCallbackSOFT),
+    NULL_PROC(alBufferData),
+    NULL_PROC(alBufferDataStatic),
+    NULL_PROC(alBufferf),
+    NULL_PROC(alBufferfv),
+    NULL_PROC(alBufferi),
+    NULL_PROC(alBufferiv),
+    NULL_PROC(alDeferUpdatesSOFT),
+    NULL_PROC(alDeleteBuffers),
+    NULL_PROC(alDeleteEffects),
+    NULL_PROC(alDeleteFilters),
+    NULL_PROC(alDeleteSources),
+    NULL_PROC(alDisable),
+    NULL_PROC(alEffectf),
+    NULL_PROC(alEffectfv),
+    NULL_PROC(alEffecti),
+    NULL_PROC(alEffectiv),
+    NULL_PROC(alEnable),
+    NULL_PROC(alFilterf),
+    NULL_PROC(alFilterfv),
+    NULL_PROC(alFilteri),
+    NULL_PROC(alFilteriv),
+    NULL_PROC(alGenBuffers),
+    NULL_PROC(alGenEffects),
+    NULL_PROC(alGenFilters),
+    NULL_PROC(alGenSources),
+    NULL_PROC(alGetBoolean),
+    NULL_PROC(alGetBooleanv),
+    NULL_PROC(alGetBuffer3PtrSOFT),
+    NULL_PROC(alGetBuffer3f),
+    NULL_PROC(alGetBuffer3i),
+    NULL_PROC(alGetBufferPtrSOFT),
+    NULL_PROC(alGetBufferPtrvSOFT),
+    NULL_PROC(alGetBufferf),
+    NULL_PROC(alGetBufferfv),
+    NULL_PROC(alGetBufferi),
+    NULL_PROC(alGetBufferiv),
+    NULL_PROC(alGetDouble),
+    NULL_PROC(alGetDoublev),
+    NULL_PROC(alGetEffectf),
+    NULL_PROC(alGetEffectfv),
+    NULL_PROC(alGetEffecti),
+    NULL_PROC(alGetEffectiv),
+    NULL_PROC(alGetEnumValue),
+    NULL_PROC(alGetError),
+    NULL_PROC(alGetFilterf),
+    NULL_PROC(alGetFilterfv),
+    NULL_PROC(alGetFilteri),
+    NULL_PROC(alGetFilteriv),
+    NULL_PROC(alGetFloat),
+    NULL_PROC(alGetFloatv),
+    NULL_PROC(alGetInteger),
+    NULL_PROC(alGetIntegerv),
+    NULL_PROC(alGetListener3f),
+    NULL_PROC(alGetListener3i),
+    NULL_PROC(alGetListenerf),
+    NULL_PROC(alGetListenerfv),
+    NULL_PROC(alGetListeneri),
+    NULL_PROC(alGetListeneriv),
+    NULL_PROC(alGetProcAddress),
+    NULL_PROC(alGetSource3f),
+    NULL_PROC(alGetSource3i),
+    NULL_PROC(alGetSourcef),
+    NULL_PROC(alGetSourcefv),
+    NULL_PROC(alGetSourcei),
+    NULL_PROC(alGetSourceiv),
+    NULL_PROC(alGetString),
+    NULL_PROC(alIsBuffer),
+    NULL_PROC(alIsEffect),
+    NULL_PROC(alIsEnabled),
+    NULL_PROC(alIsExtensionPresent),
+    NULL_PROC(alIsFilter),
+    NULL_PROC(alIsSource),
+    NULL_PROC(alListener3f),
+    NULL_PROC(alListener3i),
+    NULL_PROC(alListenerf),
+    NULL_PROC(alListenerfv),
+    NULL_PROC(alListeneri),
+    NULL_PROC(alListeneriv),
+    NULL_PROC(alProcessUpdatesSOFT),
+    NULL_PROC(alSource3f),
+    NULL_PROC(alSource3i),
+    NULL_PROC(alSourcePause),
+    NULL_PROC(alSourcePausev),
+    NULL_PROC(alSourcePlay),
+    NULL_PROC(alSourcePlayv),
+    NULL_PROC(alSourceQueueBuffers),
+    NULL_PROC(alSourceRewind),
+    NULL_PROC(alSourceRewindv),
+    NULL_PROC(alSourceStop),
+    NULL_PROC(alSourceStopv),
+    NULL_PROC(alSourceUnqueueBuffers),
+    NULL_PROC(alSourcef),
+    NULL_PROC(alSourcefv),
+    NULL_PROC(alSourcei),
+    NULL_PROC(alSourceiv),
+    NULL_PROC(alcCaptureCloseDevice),
+    NULL_PROC(alcCaptureOpenDevice),
+    NULL_PROC(alcCaptureSamples),
+    NULL_PROC(alcCaptureStart),
+    NULL_PROC(alcCaptureStop),
+    NULL_PROC(alcCloseDevice),
+    NULL_PROC(alcCreateContext),
+    NULL_PROC(alcDestroyContext),
+    NULL_PROC(alcGetContextsDevice),
+    NULL_PROC(alcGetCurrentContext),
+    NULL_PROC(alcGetEnumValue),
+    NULL_PROC(alcGetError),
+    NULL_PROC(alcGetIntegerv),
+    NULL_PROC(alcGetProcAddress),
+    NULL_PROC(alcGetString),
+    NULL_PROC(alcGetThreadContext),
+    NULL_PROC(alcIsExtensionPresent),
+    NULL_PROC(alcIsRenderFormatSupportedSOFT),
+    NULL_PROC(alcLoopbackOpenDeviceSOFT),
+    NULL_PROC(alcMakeContextCurrent),
+    NULL_PROC(alcOpenDevice),
+    NULL_PROC(alcProcessContext),
+    NULL_PROC(alcRenderSamplesSOFT),
+    NULL_PROC(alcSetThreadContext),
+    NULL_PROC(alcSuspendContext),
+};
+
+static const struct null_name *find_name(const struct null_name *names, size_t count, const char *name)
+{
+    if(name == NULL)
+        return NULL;
+    return bsearch(name, names, count, sizeof(struct null_name), &compare_name);
+}
+
+NULL_EXPORT ALenum AL_APIENTRY NULL_API(alGetEnumValue)(const ALchar *ename)
+{
+    const struct null_name *found = find_name(null_enums, sizeof(null_enums) / sizeof(null_enums[0]), (const char *)ename);
+    return (found != NULL) ? found->value : 0;
+}
+
+NULL_EXPORT ALCenum ALC_APIENTRY NULL_API(alcGetEnumValue)(ALCdevice *device, const ALCchar *enumname)
+{
+    (void)device;
+    return (ALCenum)NULL_API(alGetEnumValue)((const ALchar *)enumname);
+}
+
+NULL_EXPORT void *AL_APIENTRY NULL_API(alGetProcAddress)(const ALchar *fname)
+{
+    const struct null_name *found = find_name(null_procs, sizeof(null_procs) / sizeof(null_procs[0]), (const char *)fname);
+    return (found != NULL) ? (void *)found->proc : NULL;
+}
+
+NULL_EXPORT ALCvoid *ALC_APIENTRY NULL_API(alcGetProcAddress)(ALCdevice *device, const ALCchar *funcname)
+{
+    (void)device;
+    return NULL_API(alGetProcAddress)((const ALchar *)funcname);
+}
+
+#if defined(SALAD_SOFTWARE)
+/**
+ * Resolves the built-in renderer's functions for
+ * salad's own loaders, the counterpart of looking
+ * them up in a dynamic library
+ * @param procname  Function name
+ * @param arg       Unused
+ * @returns         A function pointer on success, NULL on failure
+ */
+void *SALAD_APIENTRY salad_software_loadfunc(const char *procname, void *arg)
+{
+    (void)arg;
+    return NULL_API(alGetProcAddress)((const ALchar *)procname);
+}
+#endif
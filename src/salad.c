@@ -25,30 +25,151 @@
  */
 #include <AL/salad.h>
 #include <stddef.h>
+#include <stdlib.h>
 
 #include <AL/al.h>
 #include <AL/alc.h>
 #include <AL/efx.h>
+#include <AL/salad_table.h>
 
-#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
-#define SALAD_POSIX 1
-#define SALAD_WIN32 0
-#elif defined(_WIN32)
-#define SALAD_POSIX 0
-#define SALAD_WIN32 1
-#endif
+#include "salad_functions.h"
+#include "salad_platform.h"
 
-#if SALAD_POSIX
-#include <dlfcn.h>
-#define salad_load_library(library)     dlopen((library), RTLD_LAZY)
-#define salad_get_proc(handle, proc)    dlsym((handle), (proc))
-#elif SALAD_WIN32
-#define WIN32_LEAN_AND_MEAN 1
-#include <windows.h>
-#define salad_load_library(library)     ((void *)LoadLibraryA((library)))
-#define salad_get_proc(handle, proc)    ((void *)GetProcAddress((HMODULE)(handle), (proc)))
-#endif
+/* Groups the global loaders can't do without when
+ * SALAD_PARANOID is enabled, everything else is optional */
+#define REQUIRED_GROUPS     (SALAD_GROUP_CORE | SALAD_GROUP_ALC | SALAD_GROUP_CAPTURE)
+#define EXTENSION_GROUPS    (SALAD_GROUP_ALL & ~REQUIRED_GROUPS)
+
+/* Load function argument used to resolve
+ * functions through a driver for a single device */
+struct device_loader {
+    PFN_alGetProcAddress alGetProcAddress;
+    PFN_alcGetProcAddress alcGetProcAddress;
+    ALCdevice *device;
+};
+
+/**
+ * Resolves a function through the driver; AL functions
+ * go to alGetProcAddress first as the specification says,
+ * but drivers that need a current context for that still hand
+ * them out through alcGetProcAddress
+ * @param procname  Function name
+ * @param arg       A device_loader structure
+ * @returns         A resolved function pointer on success, NULL on failure
+ */
+static void* device_loadfunc(const char *procname, void *arg)
+{
+    const struct device_loader *loader = arg;
+    void *proc = NULL;
+
+    if(procname[2] != 'c' && loader->alGetProcAddress != NULL)
+        proc = loader->alGetProcAddress((const ALchar *)procname);
+    if(proc == NULL)
+        proc = loader->alcGetProcAddress(loader->device, (const ALCchar *)procname);
+    return proc;
+}
+
+/* Cached extension presence bits */
+unsigned int SALAD_extensions = 0;
+
+/**
+ * Checks every known extension once
+ * @param al_present    alIsExtensionPresent
+ * @param alc_present   alcIsExtensionPresent
+ * @param get_context   alcGetCurrentContext
+ * @param device        Device to check ALC extensions for
+ * @returns             SALAD_<extension name> bits of present extensions
+ */
+static unsigned int query_extensions(PFN_alIsExtensionPresent al_present, PFN_alcIsExtensionPresent alc_present, PFN_alcGetCurrentContext get_context, ALCdevice *device)
+{
+    const struct salad_extension *ext;
+    unsigned int result = 0;
+    int context;
+
+    if(alc_present == NULL)
+        return 0;
+
+    /* alIsExtensionPresent is a context
+     * function and fails without a current one */
+    context = al_present != NULL && get_context != NULL && get_context() != NULL;
+
+    for(ext = salad_extension_list; ext->name != NULL; ++ext) {
+        if(ext->name[2] == 'C') {
+            if(alc_present(device, (const ALCchar *)ext->name))
+                result |= ext->bit;
+            continue;
+        }
+
+        if(context && al_present((const ALchar *)ext->name))
+            result |= ext->bit;
+    }
+
+    return result;
+}
+
+#if defined(SALAD_DIRECT_LINK)
+/* OpenAL is linked directly and the al* macros
+ * refer to the real functions; there is nothing left
+ * for the global loaders to do */
+int saladLoadALdefault(void)
+{
+    return 1;
+}
+
+int saladLoadALdefaultLazy(void)
+{
+    return 1;
+}
+
+int saladLoadALfunc(SALAD_loadfunc_type loadfunc, void *arg)
+{
+    (void)loadfunc;
+    (void)arg;
+    return 1;
+}
+
+int saladLoadALlibrary(const char *libname)
+{
+    (void)libname;
+    return 1;
+}
+
+unsigned int saladLoadALgroups(SALAD_loadfunc_type loadfunc, void *arg, unsigned int groups)
+{
+    (void)loadfunc;
+    (void)arg;
+    return groups & SALAD_GROUP_ALL;
+}
+
+int saladLoadALlazy(SALAD_loadfunc_type loadfunc, void *arg)
+{
+    (void)loadfunc;
+    (void)arg;
+    return 1;
+}
+
+unsigned int saladLoadALdevice(struct ALCdevice *device)
+{
+    /* Calls go straight to the exported symbols */
+    saladUpdateALextensions(device);
+    return EXTENSION_GROUPS;
+}
+
+unsigned int saladUpdateALextensions(struct ALCdevice *device)
+{
+    SALAD_extensions = query_extensions(&alIsExtensionPresent, &alcIsExtensionPresent, &alcGetCurrentContext, device);
+    return SALAD_extensions;
+}
+
+int saladLoadALsoftware(void)
+{
+    return 0;
+}
 
+void saladUnloadAL(void)
+{
+}
+#else
 #if SALAD_POSIX && defined(__APPLE__)
 static const char *openal_libnames[] = { "libopenal.dylib", NULL };
 #elif SALAD_POSIX && defined(__linux__)
@@ -57,12 +178,6 @@ static const char *openal_libnames[] = { "libopenal.so.1", "libopenal.so", NULL
 static const char *openal_libnames[] = { "openal32.dll", "soft_oal.dll", NULL };
 #endif
 
-#if SALAD_PARANOID
-#define SALAD_RESOLVE(pointer, value) if(((pointer) = (value)) == NULL) return 0; else ((void)(0))
-#else
-#define SALAD_RESOLVE(pointer, value) if(((pointer) = (value)) == NULL) ((void)(0)); else((void)(0))
-#endif
-
 /**
  * The default function that uses platform-specific
  * library names and a platform-specific dynamic linking API
@@ -77,264 +192,428 @@ static void* default_loadfunc(const char *procname, void *arg)
     return NULL;
 }
 
-/* Core OpenAL functions <AL/al.h> */
-PFN_alBuffer3f              SALAD_alBuffer3f                = NULL;
-PFN_alBuffer3i              SALAD_alBuffer3i                = NULL;
-PFN_alBufferData            SALAD_alBufferData              = NULL;
-PFN_alBufferf               SALAD_alBufferf                 = NULL;
-PFN_alBufferfv              SALAD_alBufferfv                = NULL;
-PFN_alBufferi               SALAD_alBufferi                 = NULL;
-PFN_alBufferiv              SALAD_alBufferiv                = NULL;
-PFN_alDeleteBuffers         SALAD_alDeleteBuffers           = NULL;
-PFN_alDeleteSources         SALAD_alDeleteSources           = NULL;
-PFN_alDisable               SALAD_alDisable                 = NULL;
-PFN_alEnable                SALAD_alEnable                  = NULL;
-PFN_alGenBuffers            SALAD_alGenBuffers              = NULL;
-PFN_alGenSources            SALAD_alGenSources              = NULL;
-PFN_alGetBoolean            SALAD_alGetBoolean              = NULL;
-PFN_alGetBooleanv           SALAD_alGetBooleanv             = NULL;
-PFN_alGetBuffer3f           SALAD_alGetBuffer3f             = NULL;
-PFN_alGetBuffer3i           SALAD_alGetBuffer3i             = NULL;
-PFN_alGetBufferf            SALAD_alGetBufferf              = NULL;
-PFN_alGetBufferfv           SALAD_alGetBufferfv             = NULL;
-PFN_alGetBufferi            SALAD_alGetBufferi              = NULL;
-PFN_alGetBufferiv           SALAD_alGetBufferiv             = NULL;
-PFN_alGetDouble             SALAD_alGetDouble               = NULL;
-PFN_alGetDoublev            SALAD_alGetDoublev              = NULL;
-PFN_alGetEnumValue          SALAD_alGetEnumValue            = NULL;
-PFN_alGetError              SALAD_alGetError                = NULL;
-PFN_alGetFloat              SALAD_alGetFloat                = NULL;
-PFN_alGetFloatv             SALAD_alGetFloatv               = NULL;
-PFN_alGetInteger            SALAD_alGetInteger              = NULL;
-PFN_alGetIntegerv           SALAD_alGetIntegerv             = NULL;
-PFN_alGetListener3f         SALAD_alGetListener3f           = NULL;
-PFN_alGetListener3i         SALAD_alGetListener3i           = NULL;
-PFN_alGetListenerf          SALAD_alGetListenerf            = NULL;
-PFN_alGetListenerfv         SALAD_alGetListenerfv           = NULL;
-PFN_alGetListeneri          SALAD_alGetListeneri            = NULL;
-PFN_alGetListeneriv         SALAD_alGetListeneriv           = NULL;
-PFN_alGetProcAddress        SALAD_alGetProcAddress          = NULL;
-PFN_alGetSource3f           SALAD_alGetSource3f             = NULL;
-PFN_alGetSource3i           SALAD_alGetSource3i             = NULL;
-PFN_alGetSourcef            SALAD_alGetSourcef              = NULL;
-PFN_alGetSourcefv           SALAD_alGetSourcefv             = NULL;
-PFN_alGetSourcei            SALAD_alGetSourcei              = NULL;
-PFN_alGetSourceiv           SALAD_alGetSourceiv             = NULL;
-PFN_alGetString             SALAD_alGetString               = NULL;
-PFN_alIsBuffer              SALAD_alIsBuffer                = NULL;
-PFN_alIsEnabled             SALAD_alIsEnabled               = NULL;
-PFN_alIsExtensionPresent    SALAD_alIsExtensionPresent      = NULL;
-PFN_alIsSource              SALAD_alIsSource                = NULL;
-PFN_alListener3f            SALAD_alListener3f              = NULL;
-PFN_alListener3i            SALAD_alListener3i              = NULL;
-PFN_alListenerf             SALAD_alListenerf               = NULL;
-PFN_alListenerfv            SALAD_alListenerfv              = NULL;
-PFN_alListeneri             SALAD_alListeneri               = NULL;
-PFN_alListeneriv            SALAD_alListeneriv              = NULL;
-PFN_alSource3f              SALAD_alSource3f                = NULL;
-PFN_alSource3i              SALAD_alSource3i                = NULL;
-PFN_alSourcef               SALAD_alSourcef                 = NULL;
-PFN_alSourcefv              SALAD_alSourcefv                = NULL;
-PFN_alSourcei               SALAD_alSourcei                 = NULL;
-PFN_alSourceiv              SALAD_alSourceiv                = NULL;
-PFN_alSourcePause           SALAD_alSourcePause             = NULL;
-PFN_alSourcePausev          SALAD_alSourcePausev            = NULL;
-PFN_alSourcePlay            SALAD_alSourcePlay              = NULL;
-PFN_alSourcePlayv           SALAD_alSourcePlayv             = NULL;
-PFN_alSourceQueueBuffers    SALAD_alSourceQueueBuffers      = NULL;
-PFN_alSourceRewind          SALAD_alSourceRewind            = NULL;
-PFN_alSourceRewindv         SALAD_alSourceRewindv           = NULL;
-PFN_alSourceStop            SALAD_alSourceStop              = NULL;
-PFN_alSourceStopv           SALAD_alSourceStopv             = NULL;
-PFN_alSourceUnqueueBuffers  SALAD_alSourceUnqueueBuffers    = NULL;
-
-/* Context OpenAL functions <AL/alc.h> */
-PFN_alcCaptureCloseDevice   SALAD_alcCaptureCloseDevice = NULL;
-PFN_alcCaptureOpenDevice    SALAD_alcCaptureOpenDevice  = NULL;
-PFN_alcCaptureSamples       SALAD_alcCaptureSamples     = NULL;
-PFN_alcCaptureStart         SALAD_alcCaptureStart       = NULL;
-PFN_alcCaptureStop          SALAD_alcCaptureStop        = NULL;
-PFN_alcCloseDevice          SALAD_alcCloseDevice        = NULL;
-PFN_alcCreateContext        SALAD_alcCreateContext      = NULL;
-PFN_alcDestroyContext       SALAD_alcDestroyContext     = NULL;
-PFN_alcGetContextsDevice    SALAD_alcGetContextsDevice  = NULL;
-PFN_alcGetCurrentContext    SALAD_alcGetCurrentContext  = NULL;
-PFN_alcGetEnumValue         SALAD_alcGetEnumValue       = NULL;
-PFN_alcGetError             SALAD_alcGetError           = NULL;
-PFN_alcGetIntegerv          SALAD_alcGetIntegerv        = NULL;
-PFN_alcGetProcAddress       SALAD_alcGetProcAddress     = NULL;
-PFN_alcGetString            SALAD_alcGetString          = NULL;
-PFN_alcIsExtensionPresent   SALAD_alcIsExtensionPresent = NULL;
-PFN_alcMakeContextCurrent   SALAD_alcMakeContextCurrent = NULL;
-PFN_alcOpenDevice           SALAD_alcOpenDevice         = NULL;
-PFN_alcProcessContext       SALAD_alcProcessContext     = NULL;
-PFN_alcSuspendContext       SALAD_alcSuspendContext     = NULL;
-
-/* Extension: ALC_EXT_EFX <AL/efx.h> */
-PFN_alDeleteEffects SALAD_alDeleteEffects   = NULL;
-PFN_alDeleteFilters SALAD_alDeleteFilters   = NULL;
-PFN_alEffectf       SALAD_alEffectf         = NULL;
-PFN_alEffectfv      SALAD_alEffectfv        = NULL;
-PFN_alEffecti       SALAD_alEffecti         = NULL;
-PFN_alEffectiv      SALAD_alEffectiv        = NULL;
-PFN_alFilterf       SALAD_alFilterf         = NULL;
-PFN_alFilterfv      SALAD_alFilterfv        = NULL;
-PFN_alFilteri       SALAD_alFilteri         = NULL;
-PFN_alFilteriv      SALAD_alFilteriv        = NULL;
-PFN_alGenEffects    SALAD_alGenEffects      = NULL;
-PFN_alGenFilters    SALAD_alGenFilters      = NULL;
-PFN_alGetEffectf    SALAD_alGetEffectf      = NULL;
-PFN_alGetEffectfv   SALAD_alGetEffectfv     = NULL;
-PFN_alGetEffecti    SALAD_alGetEffecti      = NULL;
-PFN_alGetEffectiv   SALAD_alGetEffectiv     = NULL;
-PFN_alGetFilterf    SALAD_alGetFilterf      = NULL;
-PFN_alGetFilterfv   SALAD_alGetFilterfv     = NULL;
-PFN_alGetFilteri    SALAD_alGetFilteri      = NULL;
-PFN_alGetFilteriv   SALAD_alGetFilteriv     = NULL;
-PFN_alIsEffect      SALAD_alIsEffect        = NULL;
-PFN_alIsFilter      SALAD_alIsFilter        = NULL;
+#if defined(SALAD_SOFTWARE)
+/* The built-in renderer, null/null.c */
+extern void *SALAD_APIENTRY salad_software_loadfunc(const char *procname, void *arg);
+#endif
 
+static const SALAD_table_type null_table;
 
-int saladLoadALdefault(void)
+/* The load function behind the lazily resolving
+ * trampolines, see salad_install_trampolines; trampolines
+ * read it on any thread, so it's only ever stored and loaded
+ * atomically. The argument is published before the function
+ * and taken back after it, a reload with calls in flight is
+ * not allowed anyway */
+static SALAD_loadfunc_type lazy_loadfunc = NULL;
+static void *lazy_arg = NULL;
+
+/* Every global loader runs under load_mutex; the lock is
+ * re-entrant so a load function can call back into the loader
+ * from the same thread. The SALAD_* pointers themselves are
+ * published with atomic stores and read without any locking */
+static salad_mutex_type load_mutex = SALAD_MUTEX_INIT;
+#if defined(SALAD_THREAD_LOCAL)
+static SALAD_THREAD_LOCAL int load_depth = 0;
+#endif
+
+/* Set once the global pointers hold the default module,
+ * cleared whenever anything else gets published over them */
+static int default_loaded = 0;
+
+/* The module the global pointers were resolved from
+ * if it was opened by SALAD itself, NULL otherwise */
+static void *loaded_module = NULL;
+
+static void load_lock(void)
+{
+#if defined(SALAD_THREAD_LOCAL)
+    if(load_depth++ != 0)
+        return;
+#endif
+    salad_mutex_lock(&load_mutex);
+}
+
+static void load_unlock(void)
+{
+#if defined(SALAD_THREAD_LOCAL)
+    if(--load_depth != 0)
+        return;
+#endif
+    salad_mutex_unlock(&load_mutex);
+}
+
+/**
+ * Loads the first OpenAL library found using
+ * implementation-defined dynamic library paths
+ * @returns         A module handle on success, NULL on failure
+ */
+static void *load_default_module(void)
 {
     size_t i;
     void *module = NULL;
 
     for(i = 0; openal_libnames[i]; ++i) {
         if((module = salad_load_library(openal_libnames[i])))
-            return saladLoadALfunc(&default_loadfunc, module);
+            return module;
         continue;
     }
 
-    return 0;
+    return NULL;
+}
+
+/**
+ * Closes the module owned by the loader once
+ * nothing in the global pointers refers to it anymore
+ * @param module    Module that replaces it, may be NULL
+ */
+static void replace_module(void *module)
+{
+    if(loaded_module != NULL)
+        salad_close_library(loaded_module);
+    loaded_module = module;
+}
+
+/**
+ * Opens a library, loads the global pointers from
+ * it and takes ownership of it; the previously owned
+ * module is only closed after the new one is published
+ * @param libname   Library name, NULL for the default ones
+ * @param load      Global loader to use on the module
+ * @returns         Zero on failure, non-zero on success
+ */
+static int load_module(const char *libname, int (*load)(SALAD_loadfunc_type, void *))
+{
+    void *module;
+
+    if(libname != NULL)
+        module = salad_load_library(libname);
+    else module = load_default_module();
+
+    if(module == NULL) {
+#if defined(SALAD_SOFTWARE)
+        /* Nothing is installed, so the default
+         * loaders fall back to the built-in renderer */
+        if(libname == NULL && load(&salad_software_loadfunc, NULL)) {
+            replace_module(NULL);
+            return 1;
+        }
+#endif
+        return 0;
+    }
+
+    if(!load(&default_loadfunc, module)) {
+        salad_close_library(module);
+        return 0;
+    }
+
+    replace_module(module);
+    return 1;
+}
+
+/**
+ * Loads the default module exactly once; callers that
+ * come in while another thread is loading wait for it to
+ * finish and every later caller returns immediately
+ * @param load      Global loader to use on the module
+ * @returns         Zero on failure, non-zero on success
+ */
+static int load_default(int (*load)(SALAD_loadfunc_type, void *))
+{
+    int result = 1;
+
+    if(salad_atomic_load_int(&default_loaded))
+        return 1;
+
+    load_lock();
+
+    if(!default_loaded) {
+        if(load_module(NULL, load))
+            salad_atomic_store_int(&default_loaded, 1);
+        else result = 0;
+    }
+
+    load_unlock();
+
+    return result;
+}
+
+/**
+ * Resolves and publishes the global pointers
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @returns         Zero on failure, non-zero on success
+ */
+static int load_func(SALAD_loadfunc_type loadfunc, void *arg)
+{
+    SALAD_table_type table;
+
+    /* Resolve everything into a temporary table
+     * first so that a failed load doesn't leave the
+     * global pointers half-filled with the new driver */
+    if(!saladLoadALtable(&table, loadfunc, arg))
+        return 0;
+
+    salad_publish_table(&table, SALAD_GROUP_ALL);
+    salad_atomic_store_int(&default_loaded, 0);
+    salad_atomic_store_int(&SALAD_extensions, 0);
+    return 1;
+}
+
+/**
+ * Resolves and publishes the given groups of
+ * global pointers, every other one is reset to NULL
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @param groups    SALAD_GROUP_* mask of groups to load
+ * @returns         SALAD_GROUP_* mask of groups that were loaded
+ */
+static unsigned int load_groups(SALAD_loadfunc_type loadfunc, void *arg, unsigned int groups)
+{
+    SALAD_table_type table = null_table;
+    unsigned int loaded;
+
+    if(loadfunc == NULL)
+        return 0;
+
+    loaded = salad_resolve_groups(&table, loadfunc, arg, groups);
+
+    salad_publish_table(&table, SALAD_GROUP_ALL);
+    salad_atomic_store_int(&default_loaded, 0);
+    salad_atomic_store_int(&SALAD_extensions, 0);
+    return loaded;
+}
+
+void *salad_lazy_resolve(const char *procname)
+{
+    SALAD_loadfunc_type loadfunc = (SALAD_loadfunc_type)salad_atomic_load_ptr(&lazy_loadfunc);
+    void *arg = (void *)salad_atomic_load_ptr(&lazy_arg);
+    void *proc = (loadfunc != NULL) ? loadfunc(procname, arg) : NULL;
+
+#if SALAD_PARANOID
+    /* The eager loaders fail the whole load over a missing
+     * core function, the lazy one only finds out on the call
+     * and there's no way left to report it to the caller */
+    if(proc == NULL)
+        abort();
+#endif
+
+    return proc;
+}
+
+/**
+ * Publishes lazily resolving global pointers
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @returns         Zero on failure, non-zero on success
+ */
+static int load_lazy(SALAD_loadfunc_type loadfunc, void *arg)
+{
+    SALAD_table_type table = null_table;
+
+    if(loadfunc == NULL)
+        return 0;
+
+    /* Nothing is going to be resolved up front so make
+     * sure there's at least some OpenAL implementation behind
+     * the load function instead of failing on the first call */
+    if(loadfunc("alGetError", arg) == NULL)
+        return 0;
+
+    salad_atomic_store_ptr(&lazy_arg, arg);
+    salad_atomic_store_ptr(&lazy_loadfunc, loadfunc);
+
+    /* Extensions are still resolved eagerly since
+     * user code checks the pointers against NULL to
+     * figure out whether an extension is present */
+    salad_install_trampolines(&table, REQUIRED_GROUPS);
+    salad_resolve_groups(&table, loadfunc, arg, EXTENSION_GROUPS);
+
+    salad_publish_table(&table, SALAD_GROUP_ALL);
+    salad_atomic_store_int(&default_loaded, 0);
+    salad_atomic_store_int(&SALAD_extensions, 0);
+    return 1;
+}
+
+int saladLoadALdefault(void)
+{
+    return load_default(&load_func);
+}
+
+int saladLoadALdefaultLazy(void)
+{
+    return load_default(&load_lazy);
+}
+
+int saladLoadALlibrary(const char *libname)
+{
+    int result;
+
+    load_lock();
+    result = load_module(libname, &load_func);
+    load_unlock();
+
+    return result;
 }
 
 int saladLoadALfunc(SALAD_loadfunc_type loadfunc, void *arg)
 {
-    if(loadfunc == NULL) {
+    int result;
+
+    load_lock();
+
+    /* The global pointers no longer refer to
+     * the owned module once the load succeeds */
+    if((result = load_func(loadfunc, arg)) != 0)
+        replace_module(NULL);
+
+    load_unlock();
+
+    return result;
+}
+
+unsigned int saladLoadALgroups(SALAD_loadfunc_type loadfunc, void *arg, unsigned int groups)
+{
+    unsigned int result;
+
+    load_lock();
+
+    /* Whatever got loaded, the global pointers
+     * no longer refer to the owned module now */
+    result = load_groups(loadfunc, arg, groups);
+    if(loadfunc != NULL)
+        replace_module(NULL);
+
+    load_unlock();
+
+    return result;
+}
+
+int saladLoadALlazy(SALAD_loadfunc_type loadfunc, void *arg)
+{
+    int result;
+
+    load_lock();
+
+    if((result = load_lazy(loadfunc, arg)) != 0)
+        replace_module(NULL);
+
+    load_unlock();
+
+    return result;
+}
+
+int saladLoadALsoftware(void)
+{
+    int result = 0;
+
+#if defined(SALAD_SOFTWARE)
+    load_lock();
+    if((result = load_func(&salad_software_loadfunc, NULL)) != 0)
+        replace_module(NULL);
+    load_unlock();
+#endif
+
+    return result;
+}
+
+unsigned int saladLoadALdevice(struct ALCdevice *device)
+{
+    SALAD_table_type table = null_table;
+    struct device_loader loader;
+    unsigned int result = 0;
+
+    load_lock();
+
+    loader.alGetProcAddress = SALAD_alGetProcAddress;
+    loader.alcGetProcAddress = SALAD_alcGetProcAddress;
+    loader.device = device;
+
+    /* Only extensions are replaced; the driver is
+     * still the same module so nothing else changes */
+    if(loader.alcGetProcAddress != NULL) {
+        result = salad_resolve_groups(&table, &device_loadfunc, &loader, EXTENSION_GROUPS);
+        salad_publish_table(&table, EXTENSION_GROUPS);
+        saladUpdateALextensions(device);
+    }
+
+    load_unlock();
+
+    return result;
+}
+
+unsigned int saladUpdateALextensions(struct ALCdevice *device)
+{
+    unsigned int result;
+
+    load_lock();
+
+    result = query_extensions(SALAD_alIsExtensionPresent, SALAD_alcIsExtensionPresent, SALAD_alcGetCurrentContext, device);
+    salad_atomic_store_int(&SALAD_extensions, result);
+
+    load_unlock();
+
+    return result;
+}
+
+void saladUnloadAL(void)
+{
+    load_lock();
+
+    salad_publish_table(&null_table, SALAD_GROUP_ALL);
+    salad_atomic_store_int(&default_loaded, 0);
+    salad_atomic_store_int(&SALAD_extensions, 0);
+
+    salad_atomic_store_ptr(&lazy_loadfunc, (SALAD_loadfunc_type)NULL);
+    salad_atomic_store_ptr(&lazy_arg, (void *)NULL);
+
+    replace_module(NULL);
+
+    load_unlock();
+}
+
+#endif /* SALAD_DIRECT_LINK */
+
+int saladLoadALtable(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg)
+{
+    unsigned int loaded;
+
+    if(table == NULL || loadfunc == NULL) {
         /* Don't bother continuing
          * to try and load function pointers
          * from literally thin air */
         return 0;
     }
 
-    SALAD_RESOLVE(SALAD_alBuffer3f,             loadfunc("alBuffer3f",              arg));
-    SALAD_RESOLVE(SALAD_alBuffer3i,             loadfunc("alBuffer3i",              arg));
-    SALAD_RESOLVE(SALAD_alBufferData,           loadfunc("alBufferData",            arg));
-    SALAD_RESOLVE(SALAD_alBufferf,              loadfunc("alBufferf",               arg));
-    SALAD_RESOLVE(SALAD_alBufferfv,             loadfunc("alBufferfv",              arg));
-    SALAD_RESOLVE(SALAD_alBufferi,              loadfunc("alBufferi",               arg));
-    SALAD_RESOLVE(SALAD_alBufferiv,             loadfunc("alBufferiv",              arg));
-    SALAD_RESOLVE(SALAD_alDeleteBuffers,        loadfunc("alDeleteBuffers",         arg));
-    SALAD_RESOLVE(SALAD_alDeleteSources,        loadfunc("alDeleteSources",         arg));
-    SALAD_RESOLVE(SALAD_alDisable,              loadfunc("alDisable",               arg));
-    SALAD_RESOLVE(SALAD_alEnable,               loadfunc("alEnable",                arg));
-    SALAD_RESOLVE(SALAD_alGenBuffers,           loadfunc("alGenBuffers",            arg));
-    SALAD_RESOLVE(SALAD_alGenSources,           loadfunc("alGenSources",            arg));
-    SALAD_RESOLVE(SALAD_alGetBoolean,           loadfunc("alGetBoolean",            arg));
-    SALAD_RESOLVE(SALAD_alGetBooleanv,          loadfunc("alGetBooleanv",           arg));
-    SALAD_RESOLVE(SALAD_alGetBuffer3f,          loadfunc("alGetBuffer3f",           arg));
-    SALAD_RESOLVE(SALAD_alGetBuffer3i,          loadfunc("alGetBuffer3i",           arg));
-    SALAD_RESOLVE(SALAD_alGetBufferf,           loadfunc("alGetBufferf",            arg));
-    SALAD_RESOLVE(SALAD_alGetBufferfv,          loadfunc("alGetBufferfv",           arg));
-    SALAD_RESOLVE(SALAD_alGetBufferi,           loadfunc("alGetBufferi",            arg));
-    SALAD_RESOLVE(SALAD_alGetBufferiv,          loadfunc("alGetBufferiv",           arg));
-    SALAD_RESOLVE(SALAD_alGetDouble,            loadfunc("alGetDouble",             arg));
-    SALAD_RESOLVE(SALAD_alGetDoublev,           loadfunc("alGetDoublev",            arg));
-    SALAD_RESOLVE(SALAD_alGetEnumValue,         loadfunc("alGetEnumValue",          arg));
-    SALAD_RESOLVE(SALAD_alGetError,             loadfunc("alGetError",              arg));
-    SALAD_RESOLVE(SALAD_alGetFloat,             loadfunc("alGetFloat",              arg));
-    SALAD_RESOLVE(SALAD_alGetFloatv,            loadfunc("alGetFloatv",             arg));
-    SALAD_RESOLVE(SALAD_alGetInteger,           loadfunc("alGetInteger",            arg));
-    SALAD_RESOLVE(SALAD_alGetIntegerv,          loadfunc("alGetIntegerv",           arg));
-    SALAD_RESOLVE(SALAD_alGetListener3f,        loadfunc("alGetListener3f",         arg));
-    SALAD_RESOLVE(SALAD_alGetListener3i,        loadfunc("alGetListener3i",         arg));
-    SALAD_RESOLVE(SALAD_alGetListenerf,         loadfunc("alGetListenerf",          arg));
-    SALAD_RESOLVE(SALAD_alGetListenerfv,        loadfunc("alGetListenerfv",         arg));
-    SALAD_RESOLVE(SALAD_alGetListeneri,         loadfunc("alGetListeneri",          arg));
-    SALAD_RESOLVE(SALAD_alGetListeneriv,        loadfunc("alGetListeneriv",         arg));
-    SALAD_RESOLVE(SALAD_alGetProcAddress,       loadfunc("alGetProcAddress",        arg));
-    SALAD_RESOLVE(SALAD_alGetSource3f,          loadfunc("alGetSource3f",           arg));
-    SALAD_RESOLVE(SALAD_alGetSource3i,          loadfunc("alGetSource3i",           arg));
-    SALAD_RESOLVE(SALAD_alGetSourcef,           loadfunc("alGetSourcef",            arg));
-    SALAD_RESOLVE(SALAD_alGetSourcefv,          loadfunc("alGetSourcefv",           arg));
-    SALAD_RESOLVE(SALAD_alGetSourcei,           loadfunc("alGetSourcei",            arg));
-    SALAD_RESOLVE(SALAD_alGetSourceiv,          loadfunc("alGetSourceiv",           arg));
-    SALAD_RESOLVE(SALAD_alGetString,            loadfunc("alGetString",             arg));
-    SALAD_RESOLVE(SALAD_alIsBuffer,             loadfunc("alIsBuffer",              arg));
-    SALAD_RESOLVE(SALAD_alIsEnabled,            loadfunc("alIsEnabled",             arg));
-    SALAD_RESOLVE(SALAD_alIsExtensionPresent,   loadfunc("alIsExtensionPresent",    arg));
-    SALAD_RESOLVE(SALAD_alIsSource,             loadfunc("alIsSource",              arg));
-    SALAD_RESOLVE(SALAD_alListener3f,           loadfunc("alListener3f",            arg));
-    SALAD_RESOLVE(SALAD_alListener3i,           loadfunc("alListener3i",            arg));
-    SALAD_RESOLVE(SALAD_alListenerf,            loadfunc("alListenerf",             arg));
-    SALAD_RESOLVE(SALAD_alListenerfv,           loadfunc("alListenerfv",            arg));
-    SALAD_RESOLVE(SALAD_alListeneri,            loadfunc("alListeneri",             arg));
-    SALAD_RESOLVE(SALAD_alListeneriv,           loadfunc("alListeneriv",            arg));
-    SALAD_RESOLVE(SALAD_alSource3f,             loadfunc("alSource3f",              arg));
-    SALAD_RESOLVE(SALAD_alSource3i,             loadfunc("alSource3i",              arg));
-    SALAD_RESOLVE(SALAD_alSourcef,              loadfunc("alSourcef",               arg));
-    SALAD_RESOLVE(SALAD_alSourcefv,             loadfunc("alSourcefv",              arg));
-    SALAD_RESOLVE(SALAD_alSourcei,              loadfunc("alSourcei",               arg));
-    SALAD_RESOLVE(SALAD_alSourceiv,             loadfunc("alSourceiv",              arg));
-    SALAD_RESOLVE(SALAD_alSourcePause,          loadfunc("alSourcePause",           arg));
-    SALAD_RESOLVE(SALAD_alSourcePausev,         loadfunc("alSourcePausev",          arg));
-    SALAD_RESOLVE(SALAD_alSourcePlay,           loadfunc("alSourcePlay",            arg));
-    SALAD_RESOLVE(SALAD_alSourcePlayv,          loadfunc("alSourcePlayv",           arg));
-    SALAD_RESOLVE(SALAD_alSourceQueueBuffers,   loadfunc("alSourceQueueBuffers",    arg));
-    SALAD_RESOLVE(SALAD_alSourceRewind,         loadfunc("alSourceRewind",          arg));
-    SALAD_RESOLVE(SALAD_alSourceRewindv,        loadfunc("alSourceRewindv",         arg));
-    SALAD_RESOLVE(SALAD_alSourceStop,           loadfunc("alSourceStop",            arg));
-    SALAD_RESOLVE(SALAD_alSourceStopv,          loadfunc("alSourceStopv",           arg));
-    SALAD_RESOLVE(SALAD_alSourceUnqueueBuffers, loadfunc("alSourceUnqueueBuffers",  arg));
-
-    /* Context OpenAL functions */
-    SALAD_RESOLVE(SALAD_alcCaptureCloseDevice,  loadfunc("alcCaptureCloseDevice",   arg));
-    SALAD_RESOLVE(SALAD_alcCaptureOpenDevice,   loadfunc("alcCaptureOpenDevice",    arg));
-    SALAD_RESOLVE(SALAD_alcCaptureSamples,      loadfunc("alcCaptureSamples",       arg));
-    SALAD_RESOLVE(SALAD_alcCaptureStart,        loadfunc("alcCaptureStart",         arg));
-    SALAD_RESOLVE(SALAD_alcCaptureStop,         loadfunc("alcCaptureStop",          arg));
-    SALAD_RESOLVE(SALAD_alcCloseDevice,         loadfunc("alcCloseDevice",          arg));
-    SALAD_RESOLVE(SALAD_alcCreateContext,       loadfunc("alcCreateContext",        arg));
-    SALAD_RESOLVE(SALAD_alcDestroyContext,      loadfunc("alcDestroyContext",       arg));
-    SALAD_RESOLVE(SALAD_alcGetContextsDevice,   loadfunc("alcGetContextsDevice",    arg));
-    SALAD_RESOLVE(SALAD_alcGetCurrentContext,   loadfunc("alcGetCurrentContext",    arg));
-    SALAD_RESOLVE(SALAD_alcGetEnumValue,        loadfunc("alcGetEnumValue",         arg));
-    SALAD_RESOLVE(SALAD_alcGetError,            loadfunc("alcGetError",             arg));
-    SALAD_RESOLVE(SALAD_alcGetIntegerv,         loadfunc("alcGetIntegerv",          arg));
-    SALAD_RESOLVE(SALAD_alcGetProcAddress,      loadfunc("alcGetProcAddress",       arg));
-    SALAD_RESOLVE(SALAD_alcGetString,           loadfunc("alcGetString",            arg));
-    SALAD_RESOLVE(SALAD_alcIsExtensionPresent,  loadfunc("alcIsExtensionPresent",   arg));
-    SALAD_RESOLVE(SALAD_alcMakeContextCurrent,  loadfunc("alcMakeContextCurrent",   arg));
-    SALAD_RESOLVE(SALAD_alcOpenDevice,          loadfunc("alcOpenDevice",           arg));
-    SALAD_RESOLVE(SALAD_alcProcessContext,      loadfunc("alcProcessContext",       arg));
-    SALAD_RESOLVE(SALAD_alcSuspendContext,      loadfunc("alcSuspendContext",       arg));
-
-    /* Extension: ALC_EXT_EFX
-     * NOTE: these are not checked if SALAD_PARANOID
-     * is defined; checking if they're present is on user code */
-    SALAD_alDeleteEffects   = loadfunc("alDeleteEffects",   arg);
-    SALAD_alDeleteFilters   = loadfunc("alDeleteFilters",   arg);
-    SALAD_alEffectf         = loadfunc("alEffectf",         arg);
-    SALAD_alEffectfv        = loadfunc("alEffectfv",        arg);
-    SALAD_alEffecti         = loadfunc("alEffecti",         arg);
-    SALAD_alEffectiv        = loadfunc("alEffectiv",        arg);
-    SALAD_alFilterf         = loadfunc("alFilterf",         arg);
-    SALAD_alFilterfv        = loadfunc("alFilterfv",        arg);
-    SALAD_alFilteri         = loadfunc("alFilteri",         arg);
-    SALAD_alFilteriv        = loadfunc("alFilteriv",        arg);
-    SALAD_alGenEffects      = loadfunc("alGenEffects",      arg);
-    SALAD_alGenFilters      = loadfunc("alGenFilters",      arg);
-    SALAD_alGetEffectf      = loadfunc("alGetEffectf",      arg);
-    SALAD_alGetEffectfv     = loadfunc("alGetEffectfv",     arg);
-    SALAD_alGetEffecti      = loadfunc("alGetEffecti",      arg);
-    SALAD_alGetEffectiv     = loadfunc("alGetEffectiv",     arg);
-    SALAD_alGetFilterf      = loadfunc("alGetFilterf",      arg);
-    SALAD_alGetFilterfv     = loadfunc("alGetFilterfv",     arg);
-    SALAD_alGetFilteri      = loadfunc("alGetFilteri",      arg);
-    SALAD_alGetFilteriv     = loadfunc("alGetFilteriv",     arg);
-    SALAD_alIsEffect        = loadfunc("alIsEffect",        arg);
-    SALAD_alIsFilter        = loadfunc("alIsFilter",        arg);
+    loaded = salad_resolve_groups(table, loadfunc, arg, SALAD_GROUP_ALL);
+
+#if SALAD_PARANOID
+    if((loaded & REQUIRED_GROUPS) != REQUIRED_GROUPS)
+        return 0;
+#else
+    (void)loaded;
+#endif
 
     return 1;
 }
+
+unsigned int saladLoadALtableDevice(SALAD_table_type *table, struct ALCdevice *device)
+{
+    struct device_loader loader;
+
+    if(table == NULL || table->alcGetProcAddress == NULL)
+        return 0;
+
+    loader.alGetProcAddress = table->alGetProcAddress;
+    loader.alcGetProcAddress = table->alcGetProcAddress;
+    loader.device = device;
+
+    return salad_resolve_groups(table, &device_loadfunc, &loader, EXTENSION_GROUPS);
+}
+
+unsigned int saladQueryALtableExtensions(const SALAD_table_type *table, struct ALCdevice *device)
+{
+    if(table == NULL)
+        return 0;
+    return query_extensions(table->alIsExtensionPresent, table->alcIsExtensionPresent, table->alcGetCurrentContext, device);
+}
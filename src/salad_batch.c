@@ -0,0 +1,188 @@
+/*
+ * salad_batch.c - Batched source updates
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <AL/salad_batch.h>
+#include <stddef.h>
+
+#include <AL/alext.h>
+#include <AL/salad_table.h>
+
+#if !defined(AL_SOFT_deferred_updates)
+/* Compiled without the extension, the
+ * pointers are always NULL in that case */
+typedef void(AL_APIENTRY *PFN_alDeferUpdatesSOFT)(void);
+typedef void(AL_APIENTRY *PFN_alProcessUpdatesSOFT)(void);
+#endif
+
+/* The functions a batch calls, read once per
+ * batch instead of once per call and source */
+struct batch_procs {
+    PFN_alSourcef alSourcef;
+    PFN_alSourcefv alSourcefv;
+    PFN_alGetBoolean alGetBoolean;
+    PFN_alDeferUpdatesSOFT alDeferUpdatesSOFT;
+    PFN_alProcessUpdatesSOFT alProcessUpdatesSOFT;
+};
+
+/**
+ * Applies a range of a batch one source at a time; a pass per
+ * parameter walks the source names three times for no gain
+ * @param procs         Functions to call
+ * @param first         First source of the range
+ * @param last          One past the last source of the range
+ * @param sources       Source names
+ * @param positions     AL_POSITION of every source, may be NULL
+ * @param velocities    AL_VELOCITY of every source, may be NULL
+ * @param gains         AL_GAIN of every source, may be NULL
+ */
+static void apply_batch(const struct batch_procs *procs, ALsizei first, ALsizei last, const ALuint *sources, const ALfloat *positions, const ALfloat *velocities, const ALfloat *gains)
+{
+    ALsizei i;
+
+    for(i = first; i < last; ++i) {
+        if(positions != NULL)
+            procs->alSourcefv(sources[i], AL_POSITION, &positions[i * 3]);
+        if(velocities != NULL)
+            procs->alSourcefv(sources[i], AL_VELOCITY, &velocities[i * 3]);
+        if(gains != NULL)
+            procs->alSourcef(sources[i], AL_GAIN, gains[i]);
+    }
+}
+
+static int check_procs(const struct batch_procs *procs)
+{
+    return procs->alSourcef != NULL && procs->alSourcefv != NULL;
+}
+
+/**
+ * Defers updates for the batch unless the caller
+ * has already deferred them, in which case they are
+ * applied by the caller's own alProcessUpdatesSOFT
+ * @param procs     Functions to call
+ * @returns         Non-zero if end_batch has to process the updates
+ */
+static int begin_batch(const struct batch_procs *procs)
+{
+    if(procs->alDeferUpdatesSOFT == NULL || procs->alProcessUpdatesSOFT == NULL)
+        return 0;
+
+#if defined(AL_SOFT_deferred_updates)
+    if(procs->alGetBoolean != NULL && procs->alGetBoolean(AL_DEFERRED_UPDATES_SOFT))
+        return 0;
+#endif
+
+    procs->alDeferUpdatesSOFT();
+    return 1;
+}
+
+static void end_batch(const struct batch_procs *procs, int deferred)
+{
+    if(deferred)
+        procs->alProcessUpdatesSOFT();
+}
+
+static void get_global_procs(struct batch_procs *procs)
+{
+#if defined(SALAD_DIRECT_LINK)
+    procs->alSourcef = &alSourcef;
+    procs->alSourcefv = &alSourcefv;
+    procs->alGetBoolean = &alGetBoolean;
+#if defined(AL_SOFT_deferred_updates)
+    procs->alDeferUpdatesSOFT = &alDeferUpdatesSOFT;
+    procs->alProcessUpdatesSOFT = &alProcessUpdatesSOFT;
+#else
+    procs->alDeferUpdatesSOFT = NULL;
+    procs->alProcessUpdatesSOFT = NULL;
+#endif
+#else
+    procs->alSourcef = SALAD_alSourcef;
+    procs->alSourcefv = SALAD_alSourcefv;
+    procs->alGetBoolean = SALAD_alGetBoolean;
+#if defined(AL_SOFT_deferred_updates)
+    procs->alDeferUpdatesSOFT = SALAD_alDeferUpdatesSOFT;
+    procs->alProcessUpdatesSOFT = SALAD_alProcessUpdatesSOFT;
+#else
+    procs->alDeferUpdatesSOFT = NULL;
+    procs->alProcessUpdatesSOFT = NULL;
+#endif
+#endif
+}
+
+int saladUpdateALsources(ALsizei count, const ALuint *sources, const ALfloat *positions, const ALfloat *velocities, const ALfloat *gains)
+{
+    struct batch_procs procs;
+    int deferred;
+
+    get_global_procs(&procs);
+    if(!check_procs(&procs))
+        return 0;
+
+    if(count <= 0)
+        return 1;
+
+    deferred = begin_batch(&procs);
+
+    /* Lazily resolved pointers are only patched by
+     * their first call, which the first source makes */
+    apply_batch(&procs, 0, 1, sources, positions, velocities, gains);
+    get_global_procs(&procs);
+    apply_batch(&procs, 1, count, sources, positions, velocities, gains);
+
+    end_batch(&procs, deferred);
+
+    return 1;
+}
+
+int saladUpdateALtableSources(const SALAD_table_type *table, ALsizei count, const ALuint *sources, const ALfloat *positions, const ALfloat *velocities, const ALfloat *gains)
+{
+    struct batch_procs procs;
+    int deferred;
+
+    if(table == NULL)
+        return 0;
+
+    procs.alSourcef = table->alSourcef;
+    procs.alSourcefv = table->alSourcefv;
+    procs.alGetBoolean = table->alGetBoolean;
+#if defined(AL_SOFT_deferred_updates)
+    procs.alDeferUpdatesSOFT = table->alDeferUpdatesSOFT;
+    procs.alProcessUpdatesSOFT = table->alProcessUpdatesSOFT;
+#else
+    procs.alDeferUpdatesSOFT = NULL;
+    procs.alProcessUpdatesSOFT = NULL;
+#endif
+
+    if(!check_procs(&procs))
+        return 0;
+
+    if(count <= 0)
+        return 1;
+
+    deferred = begin_batch(&procs);
+    apply_batch(&procs, 0, count, sources, positions, velocities, gains);
+    end_batch(&procs, deferred);
+
+    return 1;
+}
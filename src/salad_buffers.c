@@ -0,0 +1,379 @@
+/*
+ * salad_buffers.c - Recycling pool of buffer names
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <AL/salad_buffers.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <AL/salad_table.h>
+
+/* Class N holds buffers of up to BUFFER_MIN_SIZE << N
+ * bytes, the last class holds everything bigger as well */
+#define BUFFER_CLASSES      16
+#define BUFFER_MIN_SIZE     4096
+
+#define BUFFER_BATCH        32
+
+/* The functions a buffer pool calls, read once per call so
+ * that the global pointers are picked up again after reloading */
+struct buffer_procs {
+    PFN_alGenBuffers alGenBuffers;
+    PFN_alDeleteBuffers alDeleteBuffers;
+    PFN_alGetError alGetError;
+};
+
+struct buffer_list {
+    ALuint *names;
+    ALsizei count;
+    ALsizei size;
+};
+
+/* Every buffer the pool owns has an entry in an open addressing
+ * table so that a release finds its size class without a driver call */
+struct buffer_entry {
+    ALuint name;                /* Zero for an empty entry */
+    int size_class;             /* -1 if it has never been handed out, -2 once deleted */
+    int acquired;
+};
+
+struct SALAD_buffer_pool {
+    const SALAD_table_type *table;
+    ALsizei batch;
+    struct buffer_list fresh;
+    struct buffer_list lists[BUFFER_CLASSES];
+    struct buffer_entry *entries;
+    ALsizei num_entries;
+    ALsizei max_entries;
+    unsigned long acquires;
+    unsigned long hits;
+    unsigned long gen_calls;
+    unsigned long delete_calls;
+};
+
+static int get_procs(const SALAD_buffer_pool_type *pool, struct buffer_procs *procs)
+{
+    if(pool->table != NULL) {
+        procs->alGenBuffers = pool->table->alGenBuffers;
+        procs->alDeleteBuffers = pool->table->alDeleteBuffers;
+        procs->alGetError = pool->table->alGetError;
+    }
+    else {
+#if defined(SALAD_DIRECT_LINK)
+        procs->alGenBuffers = &alGenBuffers;
+        procs->alDeleteBuffers = &alDeleteBuffers;
+        procs->alGetError = &alGetError;
+#else
+        procs->alGenBuffers = SALAD_alGenBuffers;
+        procs->alDeleteBuffers = SALAD_alDeleteBuffers;
+        procs->alGetError = SALAD_alGetError;
+#endif
+    }
+
+    return procs->alGenBuffers != NULL && procs->alDeleteBuffers != NULL && procs->alGetError != NULL;
+}
+
+static int size_class(ALsizei size)
+{
+    int size_class = 0;
+
+    while(size_class < BUFFER_CLASSES - 1 && size > (ALsizei)BUFFER_MIN_SIZE << size_class)
+        ++size_class;
+    return size_class;
+}
+
+static int reserve_list(struct buffer_list *list, ALsizei count)
+{
+    ALuint *names;
+    ALsizei size;
+
+    if(list->count + count <= list->size)
+        return 1;
+
+    size = (list->size != 0) ? list->size * 2 : 64;
+    while(size < list->count + count)
+        size *= 2;
+
+    if((names = (ALuint *)realloc(list->names, (size_t)size * sizeof(ALuint))) == NULL)
+        return 0;
+
+    list->names = names;
+    list->size = size;
+    return 1;
+}
+
+static struct buffer_entry *find_entry(const SALAD_buffer_pool_type *pool, ALuint name)
+{
+    unsigned long mask = (unsigned long)pool->max_entries - 1UL;
+    unsigned long index;
+
+    if(pool->max_entries == 0 || name == 0)
+        return NULL;
+
+    for(index = (name * 2654435761UL) & mask; pool->entries[index].name != 0; index = (index + 1UL) & mask) {
+        if(pool->entries[index].name == name)
+            return &pool->entries[index];
+    }
+
+    return NULL;
+}
+
+static void put_entry(struct buffer_entry *entries, ALsizei max_entries, const struct buffer_entry *entry)
+{
+    unsigned long mask = (unsigned long)max_entries - 1UL;
+    unsigned long index = (entry->name * 2654435761UL) & mask;
+
+    while(entries[index].name != 0)
+        index = (index + 1UL) & mask;
+    entries[index] = *entry;
+}
+
+/**
+ * Rebuilds the entry table with room for count entries
+ * at most half full, dropping the entries of deleted buffers
+ * @param pool      Pool to rebuild the table of
+ * @param count     Number of entries it has to fit
+ * @returns         Zero if out of memory
+ */
+static int rebuild_entries(SALAD_buffer_pool_type *pool, ALsizei count)
+{
+    struct buffer_entry *entries;
+    ALsizei max_entries = 64;
+    ALsizei i;
+
+    while(max_entries < count * 2)
+        max_entries *= 2;
+
+    if((entries = (struct buffer_entry *)calloc((size_t)max_entries, sizeof(struct buffer_entry))) == NULL)
+        return 0;
+
+    pool->num_entries = 0;
+    for(i = 0; i < pool->max_entries; ++i) {
+        if(pool->entries[i].name != 0 && pool->entries[i].size_class >= -1) {
+            put_entry(entries, max_entries, &pool->entries[i]);
+            pool->num_entries++;
+        }
+    }
+
+    free(pool->entries);
+    pool->entries = entries;
+    pool->max_entries = max_entries;
+    return 1;
+}
+
+/**
+ * Generates a batch of buffers onto the fresh list
+ * @param pool      Pool to fill
+ * @param procs     Functions to call
+ * @returns         Zero on failure
+ */
+static int gen_buffers(SALAD_buffer_pool_type *pool, const struct buffer_procs *procs)
+{
+    struct buffer_entry entry;
+    ALuint *names;
+    ALsizei i;
+
+    if(!reserve_list(&pool->fresh, pool->batch))
+        return 0;
+    if(pool->num_entries + pool->batch > pool->max_entries / 2 && !rebuild_entries(pool, pool->num_entries + pool->batch))
+        return 0;
+
+    names = &pool->fresh.names[pool->fresh.count];
+    for(i = 0; i < pool->batch; ++i)
+        names[i] = 0;
+
+    procs->alGetError();
+    procs->alGenBuffers(pool->batch, names);
+    pool->gen_calls++;
+    if(procs->alGetError() != AL_NO_ERROR)
+        return 0;
+
+    entry.size_class = -1;
+    entry.acquired = 0;
+    for(i = 0; i < pool->batch; ++i) {
+        entry.name = names[i];
+        put_entry(pool->entries, pool->max_entries, &entry);
+    }
+
+    pool->num_entries += pool->batch;
+    pool->fresh.count += pool->batch;
+    return 1;
+}
+
+static SALAD_buffer_pool_type *create_pool(const SALAD_table_type *table, ALsizei batch)
+{
+    SALAD_buffer_pool_type *pool;
+
+    if((pool = (SALAD_buffer_pool_type *)calloc(1, sizeof(SALAD_buffer_pool_type))) == NULL)
+        return NULL;
+
+    pool->table = table;
+    pool->batch = (batch > 0) ? batch : BUFFER_BATCH;
+    return pool;
+}
+
+SALAD_buffer_pool_type *saladCreateALbufferPool(ALsizei batch)
+{
+    return create_pool(NULL, batch);
+}
+
+SALAD_buffer_pool_type *saladCreateALtableBufferPool(const SALAD_table_type *table, ALsizei batch)
+{
+    if(table == NULL)
+        return NULL;
+    return create_pool(table, batch);
+}
+
+void saladDestroyALbufferPool(SALAD_buffer_pool_type *pool)
+{
+    int i;
+
+    if(pool == NULL)
+        return;
+
+    saladTrimALbufferPool(pool);
+
+    free(pool->fresh.names);
+    for(i = 0; i < BUFFER_CLASSES; ++i)
+        free(pool->lists[i].names);
+    free(pool->entries);
+    free(pool);
+}
+
+ALuint saladAcquireALbuffer(SALAD_buffer_pool_type *pool, ALsizei size)
+{
+    struct buffer_procs procs;
+    struct buffer_entry *entry;
+    struct buffer_list *list = NULL;
+    int wanted = size_class(size);
+    int i;
+    ALuint name;
+
+    if(pool == NULL)
+        return 0;
+
+    /* A buffer of the same class comes first, then one
+     * that never held anything and then a bigger one, which
+     * the driver can still refill without growing it */
+    if(pool->lists[wanted].count != 0)
+        list = &pool->lists[wanted];
+    else if(pool->fresh.count != 0)
+        list = &pool->fresh;
+
+    for(i = wanted + 1; list == NULL && i < BUFFER_CLASSES; ++i) {
+        if(pool->lists[i].count != 0)
+            list = &pool->lists[i];
+    }
+
+    if(list != NULL) {
+        pool->hits++;
+    }
+    else {
+        if(!get_procs(pool, &procs) || !gen_buffers(pool, &procs))
+            return 0;
+        list = &pool->fresh;
+    }
+
+    name = list->names[--list->count];
+    entry = find_entry(pool, name);
+    entry->size_class = wanted;
+    entry->acquired = 1;
+
+    pool->acquires++;
+    return name;
+}
+
+int saladReleaseALbuffer(SALAD_buffer_pool_type *pool, ALuint buffer)
+{
+    struct buffer_entry *entry = find_entry(pool, buffer);
+    struct buffer_list *list;
+
+    if(entry == NULL || !entry->acquired)
+        return 0;
+
+    list = &pool->lists[entry->size_class];
+    if(!reserve_list(list, 1))
+        return 0;
+
+    list->names[list->count++] = buffer;
+    entry->acquired = 0;
+    return 1;
+}
+
+void saladTrimALbufferPool(SALAD_buffer_pool_type *pool)
+{
+    struct buffer_procs procs;
+    struct buffer_entry *entry;
+    struct buffer_list *list;
+    ALsizei count;
+    ALsizei i;
+    int j;
+
+    if(pool == NULL || !get_procs(pool, &procs))
+        return;
+
+    count = pool->fresh.count;
+    for(j = 0; j < BUFFER_CLASSES; ++j)
+        count += pool->lists[j].count;
+    if(count == 0)
+        return;
+
+    /* Everything is gathered on the fresh list
+     * so a single call deletes all of it */
+    if(!reserve_list(&pool->fresh, count - pool->fresh.count))
+        return;
+
+    for(j = 0; j < BUFFER_CLASSES; ++j) {
+        list = &pool->lists[j];
+        for(i = 0; i < list->count; ++i)
+            pool->fresh.names[pool->fresh.count++] = list->names[i];
+        list->count = 0;
+    }
+
+    procs.alDeleteBuffers(pool->fresh.count, pool->fresh.names);
+    pool->delete_calls++;
+
+    for(i = 0; i < pool->fresh.count; ++i) {
+        if((entry = find_entry(pool, pool->fresh.names[i])) != NULL)
+            entry->size_class = -2;
+    }
+
+    pool->fresh.count = 0;
+    rebuild_entries(pool, pool->num_entries - count);
+}
+
+void saladGetALbufferPoolStats(const SALAD_buffer_pool_type *pool, SALAD_buffer_pool_stats_type *stats)
+{
+    int i;
+
+    stats->acquires = pool->acquires;
+    stats->hits = pool->hits;
+    stats->gen_calls = pool->gen_calls;
+    stats->delete_calls = pool->delete_calls;
+    stats->buffers = (unsigned long)pool->num_entries;
+    stats->free = (unsigned long)pool->fresh.count;
+
+    for(i = 0; i < BUFFER_CLASSES; ++i)
+        stats->free += (unsigned long)pool->lists[i].count;
+}
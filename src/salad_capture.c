@@ -0,0 +1,410 @@
+/*
+ * salad_capture.c - Threaded audio capture
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <AL/salad_capture.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <AL/alext.h>
+#include <AL/salad_table.h>
+
+#include "salad_platform.h"
+
+#if SALAD_POSIX
+#include <time.h>
+#endif
+
+/* The functions the worker calls, read once per wakeup so
+ * that the global pointers are picked up again after reloading */
+struct capture_procs {
+    PFN_alcCaptureOpenDevice alcCaptureOpenDevice;
+    PFN_alcCaptureCloseDevice alcCaptureCloseDevice;
+    PFN_alcCaptureStart alcCaptureStart;
+    PFN_alcCaptureStop alcCaptureStop;
+    PFN_alcCaptureSamples alcCaptureSamples;
+    PFN_alcGetIntegerv alcGetIntegerv;
+};
+
+struct SALAD_capture {
+    const SALAD_table_type *table;
+    ALCdevice *device;
+    ALCuint frequency;
+    ALsizei block;              /* Frames per block */
+    ALuint period;              /* Microseconds between wakeups */
+    int frame_size;
+
+    /* The worker is the only producer and the reader the
+     * only consumer; the positions are frame indices into the
+     * ring that are only ever touched atomically, with one block
+     * of the ring always empty to tell a full one from an empty one */
+    char *ring;
+    double *stamps;             /* When the first frame of each block was recorded */
+    int ring_frames;
+    int ring_read;
+    int ring_write;
+    int blocks;
+    int overruns;
+    int device_overruns;
+    void *scratch;              /* Where dropped blocks go */
+
+    /* Only touched by the reader */
+    unsigned long frames;
+    ALuint latency;
+    ALuint max_latency;
+
+    /* Guards the device and everything below */
+    salad_mutex_type mutex;
+    salad_cond_type wake;
+    salad_thread_type thread;
+    int capturing;
+    int quit;
+};
+
+static int get_procs(const SALAD_table_type *table, struct capture_procs *procs)
+{
+    if(table != NULL) {
+        procs->alcCaptureOpenDevice = table->alcCaptureOpenDevice;
+        procs->alcCaptureCloseDevice = table->alcCaptureCloseDevice;
+        procs->alcCaptureStart = table->alcCaptureStart;
+        procs->alcCaptureStop = table->alcCaptureStop;
+        procs->alcCaptureSamples = table->alcCaptureSamples;
+        procs->alcGetIntegerv = table->alcGetIntegerv;
+    }
+    else {
+#if defined(SALAD_DIRECT_LINK)
+        procs->alcCaptureOpenDevice = &alcCaptureOpenDevice;
+        procs->alcCaptureCloseDevice = &alcCaptureCloseDevice;
+        procs->alcCaptureStart = &alcCaptureStart;
+        procs->alcCaptureStop = &alcCaptureStop;
+        procs->alcCaptureSamples = &alcCaptureSamples;
+        procs->alcGetIntegerv = &alcGetIntegerv;
+#else
+        procs->alcCaptureOpenDevice = SALAD_alcCaptureOpenDevice;
+        procs->alcCaptureCloseDevice = SALAD_alcCaptureCloseDevice;
+        procs->alcCaptureStart = SALAD_alcCaptureStart;
+        procs->alcCaptureStop = SALAD_alcCaptureStop;
+        procs->alcCaptureSamples = SALAD_alcCaptureSamples;
+        procs->alcGetIntegerv = SALAD_alcGetIntegerv;
+#endif
+    }
+
+    return procs->alcCaptureOpenDevice != NULL && procs->alcCaptureCloseDevice != NULL && procs->alcCaptureStart != NULL
+        && procs->alcCaptureStop != NULL && procs->alcCaptureSamples != NULL && procs->alcGetIntegerv != NULL;
+}
+
+static int format_frame_size(ALCenum format)
+{
+    switch(format) {
+        case AL_FORMAT_MONO8:       return 1;
+        case AL_FORMAT_MONO16:      return 2;
+        case AL_FORMAT_STEREO8:     return 2;
+        case AL_FORMAT_STEREO16:    return 4;
+#if defined(AL_EXT_float32)
+        case AL_FORMAT_MONO_FLOAT32:    return 4;
+        case AL_FORMAT_STEREO_FLOAT32:  return 8;
+#endif
+    }
+
+    return 0;
+}
+
+/* Seconds on a monotonic clock */
+static double capture_now(void)
+{
+#if SALAD_WIN32
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1.0e-9;
+#endif
+}
+
+/**
+ * Moves every whole block the device has recorded into
+ * the ring, or into the scratch block if the ring is full;
+ * must be called with the capture locked
+ * @param capture   Capture to drain
+ * @param procs     Functions to call
+ */
+static void drain_device(SALAD_capture_type *capture, const struct capture_procs *procs)
+{
+    ALCint available = 0;
+    int read, write, space;
+    double now;
+
+    procs->alcGetIntegerv(capture->device, ALC_CAPTURE_SAMPLES, 1, &available);
+    if(available < capture->block)
+        return;
+
+    /* The device buffer is as long as the ring */
+    if(available >= capture->ring_frames - capture->block)
+        salad_atomic_store_int(&capture->device_overruns, capture->device_overruns + 1);
+
+    now = capture_now();
+
+    for(; available >= capture->block; available -= capture->block) {
+        write = capture->ring_write;
+        read = salad_atomic_load_int(&capture->ring_read);
+        space = ((read > write) ? read - write : capture->ring_frames - write + read) - 1;
+
+        if(space < capture->block) {
+            procs->alcCaptureSamples(capture->device, capture->scratch, capture->block);
+            salad_atomic_store_int(&capture->overruns, capture->overruns + 1);
+            continue;
+        }
+
+        /* Blocks never wrap around, the ring is a whole number of them */
+        procs->alcCaptureSamples(capture->device, &capture->ring[write * capture->frame_size], capture->block);
+        capture->stamps[write / capture->block] = now - (double)available / (double)capture->frequency;
+        salad_atomic_store_int(&capture->ring_write, (write + capture->block) % capture->ring_frames);
+        salad_atomic_store_int(&capture->blocks, capture->blocks + 1);
+    }
+}
+
+/* Waits for a period or a wakeup, whichever comes first */
+static void wait_period(SALAD_capture_type *capture)
+{
+#if SALAD_POSIX
+    struct timespec deadline;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += (time_t)(capture->period / 1000000);
+    deadline.tv_nsec += (long)(capture->period % 1000000) * 1000L;
+    if(deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_cond_timedwait(&capture->wake, &capture->mutex, &deadline);
+#elif SALAD_WIN32
+    SleepConditionVariableSRW(&capture->wake, &capture->mutex, (DWORD)((capture->period + 999) / 1000), 0);
+#endif
+}
+
+static salad_thread_result_type SALAD_THREAD_APIENTRY capture_worker(void *arg)
+{
+    SALAD_capture_type *capture = (SALAD_capture_type *)arg;
+    struct capture_procs procs;
+
+    salad_mutex_lock(&capture->mutex);
+
+    while(!capture->quit) {
+        if(capture->capturing && get_procs(capture->table, &procs))
+            drain_device(capture, &procs);
+        wait_period(capture);
+    }
+
+    salad_mutex_unlock(&capture->mutex);
+    return (salad_thread_result_type)0;
+}
+
+static SALAD_capture_type *open_capture(const SALAD_table_type *table, const ALCchar *devicename, ALCuint frequency, ALCenum format, ALsizei block, ALsizei count)
+{
+    SALAD_capture_type *capture;
+    struct capture_procs procs;
+    int frame_size = format_frame_size(format);
+    size_t frames;
+
+    if(frame_size == 0 || frequency == 0 || block <= 0 || count < 2 || !get_procs(table, &procs))
+        return NULL;
+
+    /* One block more than asked for stays empty */
+    frames = (size_t)block * ((size_t)count + 1);
+    if(frames > (size_t)INT_MAX / (size_t)frame_size)
+        return NULL;
+
+    if((capture = (SALAD_capture_type *)calloc(1, sizeof(SALAD_capture_type))) == NULL)
+        return NULL;
+
+    capture->ring = (char *)malloc(frames * (size_t)frame_size);
+    capture->stamps = (double *)calloc((size_t)count + 1, sizeof(double));
+    capture->scratch = malloc((size_t)block * (size_t)frame_size);
+    if(capture->ring == NULL || capture->stamps == NULL || capture->scratch == NULL) {
+        free(capture->ring);
+        free(capture->stamps);
+        free(capture->scratch);
+        free(capture);
+        return NULL;
+    }
+
+    capture->table = table;
+    capture->frequency = frequency;
+    capture->block = block;
+    capture->frame_size = frame_size;
+    capture->ring_frames = (int)frames;
+
+    /* Half a block, so a block waits at most
+     * that long in the device once it's whole */
+    capture->period = (ALuint)((double)block * 500000.0 / (double)frequency);
+    if(capture->period < 1000)
+        capture->period = 1000;
+
+    if((capture->device = procs.alcCaptureOpenDevice(devicename, frequency, format, block * count)) == NULL) {
+        free(capture->ring);
+        free(capture->stamps);
+        free(capture->scratch);
+        free(capture);
+        return NULL;
+    }
+
+    salad_mutex_init(&capture->mutex);
+    salad_cond_init(&capture->wake);
+
+    if(!salad_thread_create(&capture->thread, &capture_worker, capture)) {
+        salad_cond_destroy(&capture->wake);
+        salad_mutex_destroy(&capture->mutex);
+        procs.alcCaptureCloseDevice(capture->device);
+        free(capture->ring);
+        free(capture->stamps);
+        free(capture->scratch);
+        free(capture);
+        return NULL;
+    }
+
+    return capture;
+}
+
+SALAD_capture_type *saladOpenALcapture(const ALCchar *devicename, ALCuint frequency, ALCenum format, ALsizei block, ALsizei count)
+{
+    return open_capture(NULL, devicename, frequency, format, block, count);
+}
+
+SALAD_capture_type *saladOpenALtableCapture(const SALAD_table_type *table, const ALCchar *devicename, ALCuint frequency, ALCenum format, ALsizei block, ALsizei count)
+{
+    if(table == NULL)
+        return NULL;
+    return open_capture(table, devicename, frequency, format, block, count);
+}
+
+void saladCloseALcapture(SALAD_capture_type *capture)
+{
+    struct capture_procs procs;
+
+    if(capture == NULL)
+        return;
+
+    salad_mutex_lock(&capture->mutex);
+    capture->quit = 1;
+    salad_cond_signal(&capture->wake);
+    salad_mutex_unlock(&capture->mutex);
+
+    salad_thread_join(capture->thread);
+
+    if(get_procs(capture->table, &procs)) {
+        if(capture->capturing)
+            procs.alcCaptureStop(capture->device);
+        procs.alcCaptureCloseDevice(capture->device);
+    }
+
+    salad_cond_destroy(&capture->wake);
+    salad_mutex_destroy(&capture->mutex);
+    free(capture->ring);
+    free(capture->stamps);
+    free(capture->scratch);
+    free(capture);
+}
+
+void saladStartALcapture(SALAD_capture_type *capture)
+{
+    struct capture_procs procs;
+
+    salad_mutex_lock(&capture->mutex);
+    if(!capture->capturing && get_procs(capture->table, &procs)) {
+        procs.alcCaptureStart(capture->device);
+        capture->capturing = 1;
+        salad_cond_signal(&capture->wake);
+    }
+    salad_mutex_unlock(&capture->mutex);
+}
+
+void saladStopALcapture(SALAD_capture_type *capture)
+{
+    struct capture_procs procs;
+
+    salad_mutex_lock(&capture->mutex);
+    if(capture->capturing && get_procs(capture->table, &procs)) {
+        /* Whole blocks recorded up to now still make it */
+        drain_device(capture, &procs);
+        procs.alcCaptureStop(capture->device);
+        capture->capturing = 0;
+    }
+    salad_mutex_unlock(&capture->mutex);
+}
+
+ALsizei saladGetALcaptureFrames(SALAD_capture_type *capture)
+{
+    int read = capture->ring_read;
+    int write = salad_atomic_load_int(&capture->ring_write);
+
+    return (ALsizei)((write >= read) ? write - read : capture->ring_frames - read + write);
+}
+
+ALsizei saladReadALcapture(SALAD_capture_type *capture, ALvoid *data, ALsizei frames)
+{
+    int read = capture->ring_read;
+    int write = salad_atomic_load_int(&capture->ring_write);
+    int count = (write >= read) ? write - read : capture->ring_frames - read + write;
+    int first = capture->ring_frames - read;
+    double waited;
+
+    if(count > (int)frames)
+        count = (int)frames;
+    if(count <= 0)
+        return 0;
+    if(first > count)
+        first = count;
+
+    /* The oldest frame read is the one that waited longest */
+    waited = capture_now() - capture->stamps[read / capture->block] - (double)(read % capture->block) / (double)capture->frequency;
+    capture->latency = (waited > 0.0) ? (ALuint)(waited * 1.0e6) : 0;
+    if(capture->latency > capture->max_latency)
+        capture->max_latency = capture->latency;
+
+    memcpy(data, &capture->ring[read * capture->frame_size], (size_t)(first * capture->frame_size));
+    memcpy((char *)data + first * capture->frame_size, capture->ring, (size_t)((count - first) * capture->frame_size));
+    salad_atomic_store_int(&capture->ring_read, (read + count) % capture->ring_frames);
+
+    capture->frames += (unsigned long)count;
+    return (ALsizei)count;
+}
+
+void saladGetALcaptureStats(SALAD_capture_type *capture, SALAD_capture_stats_type *stats)
+{
+    stats->blocks = (unsigned long)salad_atomic_load_int(&capture->blocks);
+    stats->frames = capture->frames;
+    stats->overruns = (unsigned long)salad_atomic_load_int(&capture->overruns);
+    stats->device_overruns = (unsigned long)salad_atomic_load_int(&capture->device_overruns);
+    stats->latency = capture->latency;
+    stats->max_latency = capture->max_latency;
+}
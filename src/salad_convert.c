@@ -0,0 +1,734 @@
+/*
+ * salad_convert.c - Sample format conversion
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <AL/salad_convert.h>
+#include <stddef.h>
+
+#include "salad_platform.h"
+#include "salad_simd.h"
+
+/* Adding and subtracting 1.5 * 2^23 rounds a float of
+ * a magnitude below 2^22 to the nearest even integer, which
+ * is what every vector conversion instruction does as well */
+#define CONVERT_ROUND       12582912.0f
+
+struct convert_kernels {
+    unsigned int kernel;
+    void (*float_to_short)(ALshort *out, const ALfloat *in, ALsizei count);
+    void (*short_to_float)(ALfloat *out, const ALshort *in, ALsizei count);
+    void (*byte_to_short)(ALshort *out, const ALubyte *in, ALsizei count);
+    void (*short_to_byte)(ALubyte *out, const ALshort *in, ALsizei count);
+    void (*interleave)(ALshort *out, const ALshort *left, const ALshort *right, ALsizei frames);
+    void (*deinterleave)(ALshort *left, ALshort *right, const ALshort *in, ALsizei frames);
+    void (*mono_to_stereo)(ALshort *out, const ALshort *in, ALsizei frames);
+    void (*stereo_to_mono)(ALshort *out, const ALshort *in, ALsizei frames);
+};
+
+static void float_to_short_c(ALshort *out, const ALfloat *in, ALsizei count)
+{
+    ALfloat value;
+    ALsizei i;
+
+    for(i = 0; i < count; ++i) {
+        value = in[i] * 32767.0f;
+        if(!(value > -32768.0f))
+            value = -32768.0f;
+        if(value > 32767.0f)
+            value = 32767.0f;
+        out[i] = (ALshort)((ALfloat)(value + CONVERT_ROUND) - CONVERT_ROUND);
+    }
+}
+
+static void short_to_float_c(ALfloat *out, const ALshort *in, ALsizei count)
+{
+    ALsizei i;
+
+    for(i = 0; i < count; ++i)
+        out[i] = (ALfloat)in[i] * (1.0f / 32768.0f);
+}
+
+static void byte_to_short_c(ALshort *out, const ALubyte *in, ALsizei count)
+{
+    ALsizei i;
+
+    for(i = 0; i < count; ++i)
+        out[i] = (ALshort)((in[i] - 128) * 256);
+}
+
+static void short_to_byte_c(ALubyte *out, const ALshort *in, ALsizei count)
+{
+    ALsizei i;
+
+    /* Shifting the biased value keeps it non-negative */
+    for(i = 0; i < count; ++i)
+        out[i] = (ALubyte)((in[i] + 32768) >> 8);
+}
+
+static void interleave_c(ALshort *out, const ALshort *left, const ALshort *right, ALsizei frames)
+{
+    ALsizei i;
+
+    for(i = 0; i < frames; ++i) {
+        out[i * 2 + 0] = left[i];
+        out[i * 2 + 1] = right[i];
+    }
+}
+
+static void deinterleave_c(ALshort *left, ALshort *right, const ALshort *in, ALsizei frames)
+{
+    ALsizei i;
+
+    for(i = 0; i < frames; ++i) {
+        left[i] = in[i * 2 + 0];
+        right[i] = in[i * 2 + 1];
+    }
+}
+
+static void mono_to_stereo_c(ALshort *out, const ALshort *in, ALsizei frames)
+{
+    ALsizei i;
+
+    for(i = 0; i < frames; ++i) {
+        out[i * 2 + 0] = in[i];
+        out[i * 2 + 1] = in[i];
+    }
+}
+
+static void stereo_to_mono_c(ALshort *out, const ALshort *in, ALsizei frames)
+{
+    ALsizei i;
+
+    /* Rounds down like the vector halving adds do */
+    for(i = 0; i < frames; ++i)
+        out[i] = (ALshort)(((in[i * 2] + in[i * 2 + 1] + 65536) >> 1) - 32768);
+}
+
+static const struct convert_kernels scalar_kernels = {
+    SALAD_CONVERT_SCALAR,
+    &float_to_short_c,
+    &short_to_float_c,
+    &byte_to_short_c,
+    &short_to_byte_c,
+    &interleave_c,
+    &deinterleave_c,
+    &mono_to_stereo_c,
+    &stereo_to_mono_c
+};
+
+#if defined(SALAD_SIMD_SSE2)
+static void float_to_short_sse2(ALshort *out, const ALfloat *in, ALsizei count)
+{
+    const __m128 scale = _mm_set1_ps(32767.0f);
+    const __m128 low = _mm_set1_ps(-32768.0f);
+    const __m128 high = _mm_set1_ps(32767.0f);
+    ALsizei i;
+
+    for(i = 0; i + 8 <= count; i += 8) {
+        __m128 a = _mm_mul_ps(_mm_loadu_ps(&in[i]), scale);
+        __m128 b = _mm_mul_ps(_mm_loadu_ps(&in[i + 4]), scale);
+        a = _mm_min_ps(_mm_max_ps(a, low), high);
+        b = _mm_min_ps(_mm_max_ps(b, low), high);
+        _mm_storeu_si128((__m128i *)&out[i], _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)));
+    }
+
+    float_to_short_c(&out[i], &in[i], count - i);
+}
+
+static void short_to_float_sse2(ALfloat *out, const ALshort *in, ALsizei count)
+{
+    const __m128 scale = _mm_set1_ps(1.0f / 32768.0f);
+    ALsizei i;
+
+    /* Unpacking a register with itself puts every sample
+     * in the upper half of a 32-bit lane, ready to be shifted down */
+    for(i = 0; i + 8 <= count; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i *)&in[i]);
+        __m128 a = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+        __m128 b = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16));
+        _mm_storeu_ps(&out[i], _mm_mul_ps(a, scale));
+        _mm_storeu_ps(&out[i + 4], _mm_mul_ps(b, scale));
+    }
+
+    short_to_float_c(&out[i], &in[i], count - i);
+}
+
+static void byte_to_short_sse2(ALshort *out, const ALubyte *in, ALsizei count)
+{
+    const __m128i bias = _mm_set1_epi8((char)0x80);
+    const __m128i zero = _mm_setzero_si128();
+    ALsizei i;
+
+    for(i = 0; i + 16 <= count; i += 16) {
+        __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&in[i]), bias);
+        _mm_storeu_si128((__m128i *)&out[i], _mm_unpacklo_epi8(zero, x));
+        _mm_storeu_si128((__m128i *)&out[i + 8], _mm_unpackhi_epi8(zero, x));
+    }
+
+    byte_to_short_c(&out[i], &in[i], count - i);
+}
+
+static void short_to_byte_sse2(ALubyte *out, const ALshort *in, ALsizei count)
+{
+    const __m128i bias = _mm_set1_epi8((char)0x80);
+    ALsizei i;
+
+    for(i = 0; i + 16 <= count; i += 16) {
+        __m128i a = _mm_srai_epi16(_mm_loadu_si128((const __m128i *)&in[i]), 8);
+        __m128i b = _mm_srai_epi16(_mm_loadu_si128((const __m128i *)&in[i + 8]), 8);
+        _mm_storeu_si128((__m128i *)&out[i], _mm_xor_si128(_mm_packs_epi16(a, b), bias));
+    }
+
+    short_to_byte_c(&out[i], &in[i], count - i);
+}
+
+static void interleave_sse2(ALshort *out, const ALshort *left, const ALshort *right, ALsizei frames)
+{
+    ALsizei i;
+
+    for(i = 0; i + 8 <= frames; i += 8) {
+        __m128i l = _mm_loadu_si128((const __m128i *)&left[i]);
+        __m128i r = _mm_loadu_si128((const __m128i *)&right[i]);
+        _mm_storeu_si128((__m128i *)&out[i * 2], _mm_unpacklo_epi16(l, r));
+        _mm_storeu_si128((__m128i *)&out[i * 2 + 8], _mm_unpackhi_epi16(l, r));
+    }
+
+    interleave_c(&out[i * 2], &left[i], &right[i], frames - i);
+}
+
+/* Sign-extended left and right samples of four stereo frames */
+#define SSE2_LEFT(x)    _mm_srai_epi32(_mm_slli_epi32((x), 16), 16)
+#define SSE2_RIGHT(x)   _mm_srai_epi32((x), 16)
+
+static void deinterleave_sse2(ALshort *left, ALshort *right, const ALshort *in, ALsizei frames)
+{
+    ALsizei i;
+
+    for(i = 0; i + 8 <= frames; i += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i *)&in[i * 2]);
+        __m128i b = _mm_loadu_si128((const __m128i *)&in[i * 2 + 8]);
+        _mm_storeu_si128((__m128i *)&left[i], _mm_packs_epi32(SSE2_LEFT(a), SSE2_LEFT(b)));
+        _mm_storeu_si128((__m128i *)&right[i], _mm_packs_epi32(SSE2_RIGHT(a), SSE2_RIGHT(b)));
+    }
+
+    deinterleave_c(&left[i], &right[i], &in[i * 2], frames - i);
+}
+
+static void mono_to_stereo_sse2(ALshort *out, const ALshort *in, ALsizei frames)
+{
+    ALsizei i;
+
+    for(i = 0; i + 8 <= frames; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i *)&in[i]);
+        _mm_storeu_si128((__m128i *)&out[i * 2], _mm_unpacklo_epi16(x, x));
+        _mm_storeu_si128((__m128i *)&out[i * 2 + 8], _mm_unpackhi_epi16(x, x));
+    }
+
+    mono_to_stereo_c(&out[i * 2], &in[i], frames - i);
+}
+
+static void stereo_to_mono_sse2(ALshort *out, const ALshort *in, ALsizei frames)
+{
+    ALsizei i;
+
+    for(i = 0; i + 8 <= frames; i += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i *)&in[i * 2]);
+        __m128i b = _mm_loadu_si128((const __m128i *)&in[i * 2 + 8]);
+        a = _mm_srai_epi32(_mm_add_epi32(SSE2_LEFT(a), SSE2_RIGHT(a)), 1);
+        b = _mm_srai_epi32(_mm_add_epi32(SSE2_LEFT(b), SSE2_RIGHT(b)), 1);
+        _mm_storeu_si128((__m128i *)&out[i], _mm_packs_epi32(a, b));
+    }
+
+    stereo_to_mono_c(&out[i], &in[i * 2], frames - i);
+}
+
+static const struct convert_kernels sse2_kernels = {
+    SALAD_CONVERT_SSE2,
+    &float_to_short_sse2,
+    &short_to_float_sse2,
+    &byte_to_short_sse2,
+    &short_to_byte_sse2,
+    &interleave_sse2,
+    &deinterleave_sse2,
+    &mono_to_stereo_sse2,
+    &stereo_to_mono_sse2
+};
+#endif
+
+#if defined(SALAD_SIMD_AVX2)
+/* 256-bit packs work within 128-bit lanes,
+ * this puts the 64-bit quarters back in order */
+#define AVX2_ORDER(x)   _mm256_permute4x64_epi64((x), 0xD8)
+
+#define AVX2_LEFT(x)    _mm256_srai_epi32(_mm256_slli_epi32((x), 16), 16)
+#define AVX2_RIGHT(x)   _mm256_srai_epi32((x), 16)
+
+SALAD_AVX2_TARGET static void float_to_short_avx2(ALshort *out, const ALfloat *in, ALsizei count)
+{
+    const __m256 scale = _mm256_set1_ps(32767.0f);
+    const __m256 low = _mm256_set1_ps(-32768.0f);
+    const __m256 high = _mm256_set1_ps(32767.0f);
+    ALsizei i;
+
+    for(i = 0; i + 16 <= count; i += 16) {
+        __m256 a = _mm256_mul_ps(_mm256_loadu_ps(&in[i]), scale);
+        __m256 b = _mm256_mul_ps(_mm256_loadu_ps(&in[i + 8]), scale);
+        a = _mm256_min_ps(_mm256_max_ps(a, low), high);
+        b = _mm256_min_ps(_mm256_max_ps(b, low), high);
+        _mm256_storeu_si256((__m256i *)&out[i], AVX2_ORDER(_mm256_packs_epi32(_mm256_cvtps_epi32(a), _mm256_cvtps_epi32(b))));
+    }
+
+    float_to_short_c(&out[i], &in[i], count - i);
+}
+
+SALAD_AVX2_TARGET static void short_to_float_avx2(ALfloat *out, const ALshort *in, ALsizei count)
+{
+    const __m256 scale = _mm256_set1_ps(1.0f / 32768.0f);
+    ALsizei i;
+
+    for(i = 0; i + 16 <= count; i += 16) {
+        __m256 a = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)&in[i])));
+        __m256 b = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)&in[i + 8])));
+        _mm256_storeu_ps(&out[i], _mm256_mul_ps(a, scale));
+        _mm256_storeu_ps(&out[i + 8], _mm256_mul_ps(b, scale));
+    }
+
+    short_to_float_c(&out[i], &in[i], count - i);
+}
+
+SALAD_AVX2_TARGET static void byte_to_short_avx2(ALshort *out, const ALubyte *in, ALsizei count)
+{
+    const __m128i bias = _mm_set1_epi8((char)0x80);
+    ALsizei i;
+
+    for(i = 0; i + 32 <= count; i += 32) {
+        __m128i a = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&in[i]), bias);
+        __m128i b = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&in[i + 16]), bias);
+        _mm256_storeu_si256((__m256i *)&out[i], _mm256_slli_epi16(_mm256_cvtepi8_epi16(a), 8));
+        _mm256_storeu_si256((__m256i *)&out[i + 16], _mm256_slli_epi16(_mm256_cvtepi8_epi16(b), 8));
+    }
+
+    byte_to_short_c(&out[i], &in[i], count - i);
+}
+
+SALAD_AVX2_TARGET static void short_to_byte_avx2(ALubyte *out, const ALshort *in, ALsizei count)
+{
+    const __m256i bias = _mm256_set1_epi8((char)0x80);
+    ALsizei i;
+
+    for(i = 0; i + 32 <= count; i += 32) {
+        __m256i a = _mm256_srai_epi16(_mm256_loadu_si256((const __m256i *)&in[i]), 8);
+        __m256i b = _mm256_srai_epi16(_mm256_loadu_si256((const __m256i *)&in[i + 16]), 8);
+        _mm256_storeu_si256((__m256i *)&out[i], _mm256_xor_si256(AVX2_ORDER(_mm256_packs_epi16(a, b)), bias));
+    }
+
+    short_to_byte_c(&out[i], &in[i], count - i);
+}
+
+SALAD_AVX2_TARGET static void interleave_avx2(ALshort *out, const ALshort *left, const ALshort *right, ALsizei frames)
+{
+    ALsizei i;
+
+    /* Unpacking interleaves within lanes, frames 0-3 and 8-11
+     * end up in one register and 4-7 and 12-15 in the other */
+    for(i = 0; i + 16 <= frames; i += 16) {
+        __m256i l = _mm256_loadu_si256((const __m256i *)&left[i]);
+        __m256i r = _mm256_loadu_si256((const __m256i *)&right[i]);
+        __m256i low = _mm256_unpacklo_epi16(l, r);
+        __m256i high = _mm256_unpackhi_epi16(l, r);
+        _mm256_storeu_si256((__m256i *)&out[i * 2], _mm256_permute2x128_si256(low, high, 0x20));
+        _mm256_storeu_si256((__m256i *)&out[i * 2 + 16], _mm256_permute2x128_si256(low, high, 0x31));
+    }
+
+    interleave_c(&out[i * 2], &left[i], &right[i], frames - i);
+}
+
+SALAD_AVX2_TARGET static void deinterleave_avx2(ALshort *left, ALshort *right, const ALshort *in, ALsizei frames)
+{
+    ALsizei i;
+
+    for(i = 0; i + 16 <= frames; i += 16) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)&in[i * 2]);
+        __m256i b = _mm256_loadu_si256((const __m256i *)&in[i * 2 + 16]);
+        _mm256_storeu_si256((__m256i *)&left[i], AVX2_ORDER(_mm256_packs_epi32(AVX2_LEFT(a), AVX2_LEFT(b))));
+        _mm256_storeu_si256((__m256i *)&right[i], AVX2_ORDER(_mm256_packs_epi32(AVX2_RIGHT(a), AVX2_RIGHT(b))));
+    }
+
+    deinterleave_c(&left[i], &right[i], &in[i * 2], frames - i);
+}
+
+SALAD_AVX2_TARGET static void mono_to_stereo_avx2(ALshort *out, const ALshort *in, ALsizei frames)
+{
+    ALsizei i;
+
+    for(i = 0; i + 16 <= frames; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)&in[i]);
+        __m256i low = _mm256_unpacklo_epi16(x, x);
+        __m256i high = _mm256_unpackhi_epi16(x, x);
+        _mm256_storeu_si256((__m256i *)&out[i * 2], _mm256_permute2x128_si256(low, high, 0x20));
+        _mm256_storeu_si256((__m256i *)&out[i * 2 + 16], _mm256_permute2x128_si256(low, high, 0x31));
+    }
+
+    mono_to_stereo_c(&out[i * 2], &in[i], frames - i);
+}
+
+SALAD_AVX2_TARGET static void stereo_to_mono_avx2(ALshort *out, const ALshort *in, ALsizei frames)
+{
+    ALsizei i;
+
+    for(i = 0; i + 16 <= frames; i += 16) {
+        __m256i a = _mm256_loadu_si256((const __m256i *)&in[i * 2]);
+        __m256i b = _mm256_loadu_si256((const __m256i *)&in[i * 2 + 16]);
+        a = _mm256_srai_epi32(_mm256_add_epi32(AVX2_LEFT(a), AVX2_RIGHT(a)), 1);
+        b = _mm256_srai_epi32(_mm256_add_epi32(AVX2_LEFT(b), AVX2_RIGHT(b)), 1);
+        _mm256_storeu_si256((__m256i *)&out[i], AVX2_ORDER(_mm256_packs_epi32(a, b)));
+    }
+
+    stereo_to_mono_c(&out[i], &in[i * 2], frames - i);
+}
+
+static const struct convert_kernels avx2_kernels = {
+    SALAD_CONVERT_AVX2,
+    &float_to_short_avx2,
+    &short_to_float_avx2,
+    &byte_to_short_avx2,
+    &short_to_byte_avx2,
+    &interleave_avx2,
+    &deinterleave_avx2,
+    &mono_to_stereo_avx2,
+    &stereo_to_mono_avx2
+};
+
+/**
+ * Checks CPUID for AVX2 and XGETBV for the operating
+ * system saving the upper halves of the registers
+ * @returns         Non-zero if AVX2 kernels can run
+ */
+static int has_avx2(void)
+{
+#if defined(_MSC_VER)
+    int info[4];
+
+    __cpuid(info, 0);
+    if(info[0] < 7)
+        return 0;
+    __cpuid(info, 1);
+    if((info[2] & (1 << 27)) == 0 || (_xgetbv(0) & 0x6) != 0x6)
+        return 0;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    unsigned int eax, ebx, ecx, edx;
+
+    if(__get_cpuid_max(0, NULL) < 7)
+        return 0;
+    __cpuid(1, eax, ebx, ecx, edx);
+    if((ecx & (1U << 27)) == 0)
+        return 0;
+    __asm__ volatile(".byte 0x0f, 0x01, 0xd0" : "=a"(eax), "=d"(edx) : "c"(0));
+    if((eax & 0x6) != 0x6)
+        return 0;
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return (ebx & (1U << 5)) != 0;
+#endif
+}
+#endif
+
+#if defined(SALAD_SIMD_NEON)
+static void float_to_short_neon(ALshort *out, const ALfloat *in, ALsizei count)
+{
+    const float32x4_t low = vdupq_n_f32(-32768.0f);
+    const float32x4_t high = vdupq_n_f32(32767.0f);
+    ALsizei i;
+
+    for(i = 0; i + 8 <= count; i += 8) {
+        float32x4_t a = vmulq_n_f32(vld1q_f32(&in[i]), 32767.0f);
+        float32x4_t b = vmulq_n_f32(vld1q_f32(&in[i + 4]), 32767.0f);
+        a = vminq_f32(vmaxq_f32(a, low), high);
+        b = vminq_f32(vmaxq_f32(b, low), high);
+        vst1q_s16(&out[i], vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(a)), vqmovn_s32(vcvtnq_s32_f32(b))));
+    }
+
+    float_to_short_c(&out[i], &in[i], count - i);
+}
+
+static void short_to_float_neon(ALfloat *out, const ALshort *in, ALsizei count)
+{
+    ALsizei i;
+
+    for(i = 0; i + 8 <= count; i += 8) {
+        int16x8_t x = vld1q_s16(&in[i]);
+        vst1q_f32(&out[i], vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))), 1.0f / 32768.0f));
+        vst1q_f32(&out[i + 4], vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))), 1.0f / 32768.0f));
+    }
+
+    short_to_float_c(&out[i], &in[i], count - i);
+}
+
+static void byte_to_short_neon(ALshort *out, const ALubyte *in, ALsizei count)
+{
+    ALsizei i;
+
+    for(i = 0; i + 16 <= count; i += 16) {
+        int8x16_t x = vreinterpretq_s8_u8(veorq_u8(vld1q_u8(&in[i]), vdupq_n_u8(0x80)));
+        vst1q_s16(&out[i], vshll_n_s8(vget_low_s8(x), 8));
+        vst1q_s16(&out[i + 8], vshll_n_s8(vget_high_s8(x), 8));
+    }
+
+    byte_to_short_c(&out[i], &in[i], count - i);
+}
+
+static void short_to_byte_neon(ALubyte *out, const ALshort *in, ALsizei count)
+{
+    ALsizei i;
+
+    for(i = 0; i + 16 <= count; i += 16) {
+        int8x16_t x = vcombine_s8(vshrn_n_s16(vld1q_s16(&in[i]), 8), vshrn_n_s16(vld1q_s16(&in[i + 8]), 8));
+        vst1q_u8(&out[i], veorq_u8(vreinterpretq_u8_s8(x), vdupq_n_u8(0x80)));
+    }
+
+    short_to_byte_c(&out[i], &in[i], count - i);
+}
+
+static void interleave_neon(ALshort *out, const ALshort *left, const ALshort *right, ALsizei frames)
+{
+    int16x8x2_t x;
+    ALsizei i;
+
+    for(i = 0; i + 8 <= frames; i += 8) {
+        x.val[0] = vld1q_s16(&left[i]);
+        x.val[1] = vld1q_s16(&right[i]);
+        vst2q_s16(&out[i * 2], x);
+    }
+
+    interleave_c(&out[i * 2], &left[i], &right[i], frames - i);
+}
+
+static void deinterleave_neon(ALshort *left, ALshort *right, const ALshort *in, ALsizei frames)
+{
+    int16x8x2_t x;
+    ALsizei i;
+
+    for(i = 0; i + 8 <= frames; i += 8) {
+        x = vld2q_s16(&in[i * 2]);
+        vst1q_s16(&left[i], x.val[0]);
+        vst1q_s16(&right[i], x.val[1]);
+    }
+
+    deinterleave_c(&left[i], &right[i], &in[i * 2], frames - i);
+}
+
+static void mono_to_stereo_neon(ALshort *out, const ALshort *in, ALsizei frames)
+{
+    int16x8x2_t x;
+    ALsizei i;
+
+    for(i = 0; i + 8 <= frames; i += 8) {
+        x.val[0] = vld1q_s16(&in[i]);
+        x.val[1] = x.val[0];
+        vst2q_s16(&out[i * 2], x);
+    }
+
+    mono_to_stereo_c(&out[i * 2], &in[i], frames - i);
+}
+
+static void stereo_to_mono_neon(ALshort *out, const ALshort *in, ALsizei frames)
+{
+    int16x8x2_t x;
+    ALsizei i;
+
+    for(i = 0; i + 8 <= frames; i += 8) {
+        x = vld2q_s16(&in[i * 2]);
+        vst1q_s16(&out[i], vhaddq_s16(x.val[0], x.val[1]));
+    }
+
+    stereo_to_mono_c(&out[i], &in[i * 2], frames - i);
+}
+
+static const struct convert_kernels neon_kernels = {
+    SALAD_CONVERT_NEON,
+    &float_to_short_neon,
+    &short_to_float_neon,
+    &byte_to_short_neon,
+    &short_to_byte_neon,
+    &interleave_neon,
+    &deinterleave_neon,
+    &mono_to_stereo_neon,
+    &stereo_to_mono_neon
+};
+#endif
+
+/* Picked on the first conversion; threads racing
+ * to pick it all store the same pointer */
+static const struct convert_kernels *kernels = NULL;
+
+static const struct convert_kernels *find_kernels(unsigned int kernel)
+{
+    unsigned int available = saladGetALconvertKernels();
+
+    if(kernel == 0) {
+        /* The best one comes first */
+        if(available & SALAD_CONVERT_AVX2)
+            kernel = SALAD_CONVERT_AVX2;
+        else if(available & SALAD_CONVERT_NEON)
+            kernel = SALAD_CONVERT_NEON;
+        else if(available & SALAD_CONVERT_SSE2)
+            kernel = SALAD_CONVERT_SSE2;
+        else kernel = SALAD_CONVERT_SCALAR;
+    }
+
+    if((available & kernel) == 0)
+        return NULL;
+
+    switch(kernel) {
+#if defined(SALAD_SIMD_AVX2)
+        case SALAD_CONVERT_AVX2:    return &avx2_kernels;
+#endif
+#if defined(SALAD_SIMD_SSE2)
+        case SALAD_CONVERT_SSE2:    return &sse2_kernels;
+#endif
+#if defined(SALAD_SIMD_NEON)
+        case SALAD_CONVERT_NEON:    return &neon_kernels;
+#endif
+        case SALAD_CONVERT_SCALAR:  return &scalar_kernels;
+    }
+
+    return NULL;
+}
+
+static const struct convert_kernels *get_kernels(void)
+{
+    const struct convert_kernels *current = kernels;
+
+    if(current == NULL) {
+        current = find_kernels(0);
+        salad_atomic_store_ptr(&kernels, current);
+    }
+
+    return current;
+}
+
+unsigned int salad_simd_kernel(void)
+{
+    return get_kernels()->kernel;
+}
+
+unsigned int saladGetALconvertKernels(void)
+{
+    unsigned int available = SALAD_CONVERT_SCALAR;
+
+#if defined(SALAD_SIMD_SSE2)
+    available |= SALAD_CONVERT_SSE2;
+#endif
+#if defined(SALAD_SIMD_AVX2)
+    if(has_avx2())
+        available |= SALAD_CONVERT_AVX2;
+#endif
+#if defined(SALAD_SIMD_NEON)
+    available |= SALAD_CONVERT_NEON;
+#endif
+
+    return available;
+}
+
+unsigned int saladSetALconvertKernel(unsigned int kernel)
+{
+    const struct convert_kernels *selected = find_kernels(kernel);
+
+    if(selected != NULL)
+        salad_atomic_store_ptr(&kernels, selected);
+    return salad_simd_kernel();
+}
+
+void saladConvertALfloatToShort(ALshort *out, const ALfloat *in, ALsizei count)
+{
+    if(count > 0)
+        get_kernels()->float_to_short(out, in, count);
+}
+
+void saladConvertALshortToFloat(ALfloat *out, const ALshort *in, ALsizei count)
+{
+    if(count > 0)
+        get_kernels()->short_to_float(out, in, count);
+}
+
+void saladConvertALbyteToShort(ALshort *out, const ALubyte *in, ALsizei count)
+{
+    if(count > 0)
+        get_kernels()->byte_to_short(out, in, count);
+}
+
+void saladConvertALshortToByte(ALubyte *out, const ALshort *in, ALsizei count)
+{
+    if(count > 0)
+        get_kernels()->short_to_byte(out, in, count);
+}
+
+void saladInterleaveALshort(ALshort *out, const ALshort *left, const ALshort *right, ALsizei frames)
+{
+    if(frames > 0)
+        get_kernels()->interleave(out, left, right, frames);
+}
+
+void saladDeinterleaveALshort(ALshort *left, ALshort *right, const ALshort *in, ALsizei frames)
+{
+    if(frames > 0)
+        get_kernels()->deinterleave(left, right, in, frames);
+}
+
+void saladRemixALshort(ALshort *out, ALsizei out_channels, const ALshort *in, ALsizei in_channels, ALsizei frames)
+{
+    ALsizei i, j;
+    long sum;
+
+    if(frames <= 0 || out_channels <= 0 || in_channels <= 0)
+        return;
+
+    if(in_channels == 1 && out_channels == 2) {
+        get_kernels()->mono_to_stereo(out, in, frames);
+    }
+    else if(in_channels == 2 && out_channels == 1) {
+        get_kernels()->stereo_to_mono(out, in, frames);
+    }
+    else if(in_channels == 1) {
+        for(i = 0; i < frames; ++i) {
+            for(j = 0; j < out_channels; ++j)
+                out[i * out_channels + j] = in[i];
+        }
+    }
+    else if(out_channels == 1) {
+        /* Biased like stereo_to_mono_c so it rounds down */
+        for(i = 0; i < frames; ++i) {
+            for(sum = 0, j = 0; j < in_channels; ++j)
+                sum += in[i * in_channels + j] + 32768L;
+            out[i] = (ALshort)(sum / in_channels - 32768L);
+        }
+    }
+    else {
+        for(i = 0; i < frames; ++i) {
+            for(j = 0; j < out_channels; ++j)
+                out[i * out_channels + j] = (j < in_channels) ? in[i * in_channels + j] : 0;
+        }
+    }
+}
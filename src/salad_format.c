@@ -0,0 +1,315 @@
+/*
+ * salad_format.c - Upload format negotiation
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <AL/salad_format.h>
+#include <limits.h>
+#include <stdlib.h>
+
+#include <AL/alext.h>
+#include <AL/salad_convert.h>
+#include <AL/salad_table.h>
+
+/* Frames downmixed at a time */
+#define FORMAT_BLOCK        256
+
+/* Extensions a layout needs */
+#define FORMAT_FLOAT32      0x1
+#define FORMAT_MCFORMATS    0x2
+
+#if defined(AL_EXT_float32)
+#define FORMAT_MONO_FLOAT32     AL_FORMAT_MONO_FLOAT32
+#define FORMAT_STEREO_FLOAT32   AL_FORMAT_STEREO_FLOAT32
+#else
+#define FORMAT_MONO_FLOAT32     AL_NONE
+#define FORMAT_STEREO_FLOAT32   AL_NONE
+#endif
+
+#if defined(AL_EXT_MCFORMATS)
+#define FORMAT_QUAD(bits)       AL_FORMAT_QUAD##bits
+#define FORMAT_51CHN(bits)      AL_FORMAT_51CHN##bits
+#define FORMAT_61CHN(bits)      AL_FORMAT_61CHN##bits
+#define FORMAT_71CHN(bits)      AL_FORMAT_71CHN##bits
+#else
+#define FORMAT_QUAD(bits)       AL_NONE
+#define FORMAT_51CHN(bits)      AL_NONE
+#define FORMAT_61CHN(bits)      AL_NONE
+#define FORMAT_71CHN(bits)      AL_NONE
+#endif
+
+/* Left and right gains of every channel in the
+ * AL_EXT_MCFORMATS order, ITU-style with the centre
+ * and the surrounds at -3 dB and the LFE left out */
+#define H 0.70710678f
+static const ALfloat downmix_quad[4][2] = { { 1.0f, 0.0f }, { 0.0f, 1.0f }, { H, 0.0f }, { 0.0f, H } };
+static const ALfloat downmix_51[6][2] = { { 1.0f, 0.0f }, { 0.0f, 1.0f }, { H, H }, { 0.0f, 0.0f }, { H, 0.0f }, { 0.0f, H } };
+static const ALfloat downmix_61[7][2] = { { 1.0f, 0.0f }, { 0.0f, 1.0f }, { H, H }, { 0.0f, 0.0f }, { 0.5f, 0.5f }, { H, 0.0f }, { 0.0f, H } };
+static const ALfloat downmix_71[8][2] = { { 1.0f, 0.0f }, { 0.0f, 1.0f }, { H, H }, { 0.0f, 0.0f }, { H, 0.0f }, { 0.0f, H }, { H, 0.0f }, { 0.0f, H } };
+#undef H
+
+struct format_layout {
+    ALsizei channels;
+    unsigned int needs;         /* FORMAT_* extensions of 8 and 16-bit samples */
+    unsigned int float_needs;   /* FORMAT_* extensions of float samples */
+    ALenum formats[3];          /* AL_FORMAT_* per SALAD_SAMPLE_* */
+    const ALfloat (*downmix)[2];
+};
+
+static const struct format_layout layouts[] = {
+    { 1, 0, FORMAT_FLOAT32, { AL_FORMAT_MONO8, AL_FORMAT_MONO16, FORMAT_MONO_FLOAT32 }, NULL },
+    { 2, 0, FORMAT_FLOAT32, { AL_FORMAT_STEREO8, AL_FORMAT_STEREO16, FORMAT_STEREO_FLOAT32 }, NULL },
+    { 4, FORMAT_MCFORMATS, FORMAT_MCFORMATS, { FORMAT_QUAD(8), FORMAT_QUAD(16), FORMAT_QUAD(32) }, downmix_quad },
+    { 6, FORMAT_MCFORMATS, FORMAT_MCFORMATS, { FORMAT_51CHN(8), FORMAT_51CHN(16), FORMAT_51CHN(32) }, downmix_51 },
+    { 7, FORMAT_MCFORMATS, FORMAT_MCFORMATS, { FORMAT_61CHN(8), FORMAT_61CHN(16), FORMAT_61CHN(32) }, downmix_61 },
+    { 8, FORMAT_MCFORMATS, FORMAT_MCFORMATS, { FORMAT_71CHN(8), FORMAT_71CHN(16), FORMAT_71CHN(32) }, downmix_71 }
+};
+
+struct format_procs {
+    PFN_alBufferData alBufferData;
+    PFN_alGetError alGetError;
+    PFN_alIsExtensionPresent alIsExtensionPresent;
+};
+
+static int get_procs(const SALAD_table_type *table, struct format_procs *procs)
+{
+    if(table != NULL) {
+        procs->alBufferData = table->alBufferData;
+        procs->alGetError = table->alGetError;
+        procs->alIsExtensionPresent = table->alIsExtensionPresent;
+    }
+    else {
+#if defined(SALAD_DIRECT_LINK)
+        procs->alBufferData = &alBufferData;
+        procs->alGetError = &alGetError;
+        procs->alIsExtensionPresent = &alIsExtensionPresent;
+#else
+        procs->alBufferData = SALAD_alBufferData;
+        procs->alGetError = SALAD_alGetError;
+        procs->alIsExtensionPresent = SALAD_alIsExtensionPresent;
+#endif
+    }
+
+    return procs->alBufferData != NULL && procs->alGetError != NULL && procs->alIsExtensionPresent != NULL;
+}
+
+static const struct format_layout *find_layout(ALsizei channels)
+{
+    size_t i;
+
+    for(i = 0; i < sizeof(layouts) / sizeof(layouts[0]); ++i) {
+        if(layouts[i].channels == channels)
+            return &layouts[i];
+    }
+
+    return NULL;
+}
+
+static size_t sample_size(ALenum type)
+{
+    switch(type) {
+        case SALAD_SAMPLE_UBYTE:    return sizeof(ALubyte);
+        case SALAD_SAMPLE_SHORT:    return sizeof(ALshort);
+        case SALAD_SAMPLE_FLOAT:    return sizeof(ALfloat);
+    }
+
+    return 0;
+}
+
+/**
+ * Gets the format of a layout if the driver takes it
+ * @param layout    Channel layout
+ * @param type      SALAD_SAMPLE_* of the samples
+ * @param exts      FORMAT_* extensions the driver has
+ * @returns         AL_FORMAT_* of the layout, AL_NONE if it's unsupported
+ */
+static ALenum get_format(const struct format_layout *layout, ALenum type, unsigned int exts)
+{
+    unsigned int needs = (type == SALAD_SAMPLE_FLOAT) ? layout->float_needs : layout->needs;
+
+    if((exts & needs) != needs)
+        return AL_NONE;
+    return layout->formats[type - SALAD_SAMPLE_UBYTE];
+}
+
+static int choose_format(const SALAD_table_type *table, ALsizei channels, ALenum type, SALAD_format_type *format)
+{
+    struct format_procs procs;
+    const struct format_layout *layout = find_layout(channels);
+    unsigned int exts = 0;
+    ALenum native;
+
+    if(format == NULL || layout == NULL || sample_size(type) == 0 || !get_procs(table, &procs))
+        return 0;
+
+#if defined(AL_EXT_float32)
+    if(procs.alIsExtensionPresent((const ALchar *)"AL_EXT_float32"))
+        exts |= FORMAT_FLOAT32;
+#endif
+#if defined(AL_EXT_MCFORMATS)
+    if(procs.alIsExtensionPresent((const ALchar *)"AL_EXT_MCFORMATS"))
+        exts |= FORMAT_MCFORMATS;
+#endif
+
+    format->channels = channels;
+    format->type = type;
+    format->passes = 0;
+
+    /* Downmixing is the most expensive pass, so float
+     * samples of a supported layout get quantized first */
+    if(get_format(layout, type, exts) == AL_NONE) {
+        if(type != SALAD_SAMPLE_FLOAT || get_format(layout, SALAD_SAMPLE_SHORT, exts) == AL_NONE) {
+            format->passes |= SALAD_FORMAT_DOWNMIX;
+            layout = find_layout(2);
+        }
+    }
+
+    /* Downmixing happens in float, which 8-bit samples
+     * would lose again; those are widened to 16-bit ones */
+    if((native = get_format(layout, type, exts)) != AL_NONE && !(type == SALAD_SAMPLE_UBYTE && format->passes != 0)) {
+        format->format_type = type;
+    }
+    else {
+        native = get_format(layout, SALAD_SAMPLE_SHORT, exts);
+        format->format_type = SALAD_SAMPLE_SHORT;
+        format->passes |= SALAD_FORMAT_CONVERT;
+    }
+
+    format->format = native;
+    format->format_channels = layout->channels;
+    return 1;
+}
+
+int saladChooseALformat(ALsizei channels, ALenum type, SALAD_format_type *format)
+{
+    return choose_format(NULL, channels, type, format);
+}
+
+int saladChooseALtableFormat(const SALAD_table_type *table, ALsizei channels, ALenum type, SALAD_format_type *format)
+{
+    if(table == NULL)
+        return 0;
+    return choose_format(table, channels, type, format);
+}
+
+/**
+ * Mixes samples down to stereo ones, in blocks
+ * so that the float copies stay on the stack
+ * @param format    Format the samples were chosen for
+ * @param out       Output samples of the format type
+ * @param data      Input samples of the source layout
+ * @param frames    Number of frames
+ */
+static void downmix(const SALAD_format_type *format, void *out, const void *data, ALsizei frames)
+{
+    const ALfloat (*gains)[2] = find_layout(format->channels)->downmix;
+    const ALsizei channels = format->channels;
+    ALfloat in_block[FORMAT_BLOCK * 8];
+    ALfloat out_block[FORMAT_BLOCK * 2];
+    const ALfloat *in;
+    ALsizei pos, size, i, j;
+    ALfloat left, right;
+
+    for(pos = 0; pos < frames; pos += size) {
+        size = (frames - pos < FORMAT_BLOCK) ? frames - pos : FORMAT_BLOCK;
+
+        switch(format->type) {
+            case SALAD_SAMPLE_UBYTE:
+                for(i = 0; i < size * channels; ++i)
+                    in_block[i] = (ALfloat)((int)((const ALubyte *)data)[pos * channels + i] - 128) * (1.0f / 128.0f);
+                in = in_block;
+                break;
+            case SALAD_SAMPLE_SHORT:
+                saladConvertALshortToFloat(in_block, &((const ALshort *)data)[pos * channels], size * channels);
+                in = in_block;
+                break;
+            default:
+                in = &((const ALfloat *)data)[pos * channels];
+                break;
+        }
+
+        for(i = 0; i < size; ++i) {
+            left = 0.0f;
+            right = 0.0f;
+            for(j = 0; j < channels; ++j) {
+                left += in[i * channels + j] * gains[j][0];
+                right += in[i * channels + j] * gains[j][1];
+            }
+
+            out_block[i * 2] = left;
+            out_block[i * 2 + 1] = right;
+        }
+
+        if(format->format_type == SALAD_SAMPLE_FLOAT) {
+            for(i = 0; i < size * 2; ++i)
+                ((ALfloat *)out)[pos * 2 + i] = out_block[i];
+        }
+        else saladConvertALfloatToShort(&((ALshort *)out)[pos * 2], out_block, size * 2);
+    }
+}
+
+static int upload_samples(const SALAD_table_type *table, const SALAD_format_type *format, ALuint buffer, const ALvoid *data, ALsizei frames, ALsizei frequency)
+{
+    struct format_procs procs;
+    size_t frame_size;
+    void *copy = NULL;
+    int result;
+
+    if(format == NULL || data == NULL || frames < 0 || !get_procs(table, &procs))
+        return 0;
+
+    frame_size = sample_size(format->format_type) * (size_t)format->format_channels;
+    if(frame_size == 0 || (size_t)frames > (size_t)INT_MAX / frame_size)
+        return 0;
+
+    if(format->passes != 0) {
+        /* One extra byte keeps malloc away from zero */
+        if((copy = malloc(frame_size * (size_t)frames + 1)) == NULL)
+            return 0;
+
+        if(format->passes & SALAD_FORMAT_DOWNMIX)
+            downmix(format, copy, data, frames);
+        else saladConvertALfloatToShort((ALshort *)copy, (const ALfloat *)data, frames * format->channels);
+
+        data = copy;
+    }
+
+    procs.alGetError();
+    procs.alBufferData(buffer, format->format, data, (ALsizei)(frame_size * (size_t)frames), frequency);
+    result = (procs.alGetError() == AL_NO_ERROR);
+
+    free(copy);
+    return result;
+}
+
+int saladUploadALsamples(const SALAD_format_type *format, ALuint buffer, const ALvoid *data, ALsizei frames, ALsizei frequency)
+{
+    return upload_samples(NULL, format, buffer, data, frames, frequency);
+}
+
+int saladUploadALtableSamples(const SALAD_table_type *table, const SALAD_format_type *format, ALuint buffer, const ALvoid *data, ALsizei frames, ALsizei frequency)
+{
+    if(table == NULL)
+        return 0;
+    return upload_samples(table, format, buffer, data, frames, frequency);
+}
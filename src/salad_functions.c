@@ -0,0 +1,1497 @@
+/*
+ * salad_functions.c - Generated OpenAL function lists
+ * Copyright (C) 2021-2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* Generated by salad_gen from gen/salad.reg, do not edit */
+#include <AL/salad.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <AL/salad_table.h>
+
+#include "salad_functions.h"
+#include "salad_platform.h"
+
+#define SALAD_RESOLVE(pointer, value) if(((pointer) = (value)) == NULL) ++missing; else ((void)(0))
+
+#if SALAD_PARANOID
+/* Functions of a block that didn't resolve completely
+ * are all reset to NULL so that no feature or extension is
+ * ever left half-loaded; table members of a block are adjacent */
+#define SALAD_DISCARD(table, first, last) discard_range((table), offsetof(SALAD_table_type, first), offsetof(SALAD_table_type, last) + sizeof((table)->last))
+
+static void discard_range(SALAD_table_type *table, size_t begin, size_t end)
+{
+    static const SALAD_table_type null_table;
+    memcpy((char *)table + begin, (const char *)&null_table + begin, end - begin);
+}
+#else
+#define SALAD_DISCARD(table, first, last) ((void)(0))
+#endif
+
+/* The global pointer is only patched while it still points at
+ * the trampoline, so a wrapper installed over it after the lazy
+ * load or a pointer another thread published stays in place */
+#define SALAD_LAZY_RESOLVE(proc, name) if(((proc) = (PFN_##name)salad_lazy_resolve(#name)) != NULL) (void)salad_atomic_cas_ptr(&SALAD_##name, &lazy_##name, (proc)); else ((void)(0))
+
+/**
+ * Resolves core OpenAL functions <AL/al.h>
+ * @param table     Function table to fill
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @returns         Non-zero if every function was resolved
+ */
+static int resolve_al_version_1_1(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg)
+{
+    int missing = 0;
+
+    SALAD_RESOLVE(table->alBuffer3f,             loadfunc("alBuffer3f",             arg));
+    SALAD_RESOLVE(table->alBuffer3i,             loadfunc("alBuffer3i",             arg));
+    SALAD_RESOLVE(table->alBufferData,           loadfunc("alBufferData",           arg));
+    SALAD_RESOLVE(table->alBufferf,              loadfunc("alBufferf",              arg));
+    SALAD_RESOLVE(table->alBufferfv,             loadfunc("alBufferfv",             arg));
+    SALAD_RESOLVE(table->alBufferi,              loadfunc("alBufferi",              arg));
+    SALAD_RESOLVE(table->alBufferiv,             loadfunc("alBufferiv",             arg));
+    SALAD_RESOLVE(table->alDeleteBuffers,        loadfunc("alDeleteBuffers",        arg));
+    SALAD_RESOLVE(table->alDeleteSources,        loadfunc("alDeleteSources",        arg));
+    SALAD_RESOLVE(table->alDisable,              loadfunc("alDisable",              arg));
+    SALAD_RESOLVE(table->alEnable,               loadfunc("alEnable",               arg));
+    SALAD_RESOLVE(table->alGenBuffers,           loadfunc("alGenBuffers",           arg));
+    SALAD_RESOLVE(table->alGenSources,           loadfunc("alGenSources",           arg));
+    SALAD_RESOLVE(table->alGetBoolean,           loadfunc("alGetBoolean",           arg));
+    SALAD_RESOLVE(table->alGetBooleanv,          loadfunc("alGetBooleanv",          arg));
+    SALAD_RESOLVE(table->alGetBuffer3f,          loadfunc("alGetBuffer3f",          arg));
+    SALAD_RESOLVE(table->alGetBuffer3i,          loadfunc("alGetBuffer3i",          arg));
+    SALAD_RESOLVE(table->alGetBufferf,           loadfunc("alGetBufferf",           arg));
+    SALAD_RESOLVE(table->alGetBufferfv,          loadfunc("alGetBufferfv",          arg));
+    SALAD_RESOLVE(table->alGetBufferi,           loadfunc("alGetBufferi",           arg));
+    SALAD_RESOLVE(table->alGetBufferiv,          loadfunc("alGetBufferiv",          arg));
+    SALAD_RESOLVE(table->alGetDouble,            loadfunc("alGetDouble",            arg));
+    SALAD_RESOLVE(table->alGetDoublev,           loadfunc("alGetDoublev",           arg));
+    SALAD_RESOLVE(table->alGetEnumValue,         loadfunc("alGetEnumValue",         arg));
+    SALAD_RESOLVE(table->alGetError,             loadfunc("alGetError",             arg));
+    SALAD_RESOLVE(table->alGetFloat,             loadfunc("alGetFloat",             arg));
+    SALAD_RESOLVE(table->alGetFloatv,            loadfunc("alGetFloatv",            arg));
+    SALAD_RESOLVE(table->alGetInteger,           loadfunc("alGetInteger",           arg));
+    SALAD_RESOLVE(table->alGetIntegerv,          loadfunc("alGetIntegerv",          arg));
+    SALAD_RESOLVE(table->alGetListener3f,        loadfunc("alGetListener3f",        arg));
+    SALAD_RESOLVE(table->alGetListener3i,        loadfunc("alGetListener3i",        arg));
+    SALAD_RESOLVE(table->alGetListenerf,         loadfunc("alGetListenerf",         arg));
+    SALAD_RESOLVE(table->alGetListenerfv,        loadfunc("alGetListenerfv",        arg));
+    SALAD_RESOLVE(table->alGetListeneri,         loadfunc("alGetListeneri",         arg));
+    SALAD_RESOLVE(table->alGetListeneriv,        loadfunc("alGetListeneriv",        arg));
+    SALAD_RESOLVE(table->alGetProcAddress,       loadfunc("alGetProcAddress",       arg));
+    SALAD_RESOLVE(table->alGetSource3f,          loadfunc("alGetSource3f",          arg));
+    SALAD_RESOLVE(table->alGetSource3i,          loadfunc("alGetSource3i",          arg));
+    SALAD_RESOLVE(table->alGetSourcef,           loadfunc("alGetSourcef",           arg));
+    SALAD_RESOLVE(table->alGetSourcefv,          loadfunc("alGetSourcefv",          arg));
+    SALAD_RESOLVE(table->alGetSourcei,           loadfunc("alGetSourcei",           arg));
+    SALAD_RESOLVE(table->alGetSourceiv,          loadfunc("alGetSourceiv",          arg));
+    SALAD_RESOLVE(table->alGetString,            loadfunc("alGetString",            arg));
+    SALAD_RESOLVE(table->alIsBuffer,             loadfunc("alIsBuffer",             arg));
+    SALAD_RESOLVE(table->alIsEnabled,            loadfunc("alIsEnabled",            arg));
+    SALAD_RESOLVE(table->alIsExtensionPresent,   loadfunc("alIsExtensionPresent",   arg));
+    SALAD_RESOLVE(table->alIsSource,             loadfunc("alIsSource",             arg));
+    SALAD_RESOLVE(table->alListener3f,           loadfunc("alListener3f",           arg));
+    SALAD_RESOLVE(table->alListener3i,           loadfunc("alListener3i",           arg));
+    SALAD_RESOLVE(table->alListenerf,            loadfunc("alListenerf",            arg));
+    SALAD_RESOLVE(table->alListenerfv,           loadfunc("alListenerfv",           arg));
+    SALAD_RESOLVE(table->alListeneri,            loadfunc("alListeneri",            arg));
+    SALAD_RESOLVE(table->alListeneriv,           loadfunc("alListeneriv",           arg));
+    SALAD_RESOLVE(table->alSource3f,             loadfunc("alSource3f",             arg));
+    SALAD_RESOLVE(table->alSource3i,             loadfunc("alSource3i",             arg));
+    SALAD_RESOLVE(table->alSourcef,              loadfunc("alSourcef",              arg));
+    SALAD_RESOLVE(table->alSourcefv,             loadfunc("alSourcefv",             arg));
+    SALAD_RESOLVE(table->alSourcei,              loadfunc("alSourcei",              arg));
+    SALAD_RESOLVE(table->alSourceiv,             loadfunc("alSourceiv",             arg));
+    SALAD_RESOLVE(table->alSourcePause,          loadfunc("alSourcePause",          arg));
+    SALAD_RESOLVE(table->alSourcePausev,         loadfunc("alSourcePausev",         arg));
+    SALAD_RESOLVE(table->alSourcePlay,           loadfunc("alSourcePlay",           arg));
+    SALAD_RESOLVE(table->alSourcePlayv,          loadfunc("alSourcePlayv",          arg));
+    SALAD_RESOLVE(table->alSourceQueueBuffers,   loadfunc("alSourceQueueBuffers",   arg));
+    SALAD_RESOLVE(table->alSourceRewind,         loadfunc("alSourceRewind",         arg));
+    SALAD_RESOLVE(table->alSourceRewindv,        loadfunc("alSourceRewindv",        arg));
+    SALAD_RESOLVE(table->alSourceStop,           loadfunc("alSourceStop",           arg));
+    SALAD_RESOLVE(table->alSourceStopv,          loadfunc("alSourceStopv",          arg));
+    SALAD_RESOLVE(table->alSourceUnqueueBuffers, loadfunc("alSourceUnqueueBuffers", arg));
+
+    if(missing != 0)
+        SALAD_DISCARD(table, alBuffer3f, alSourceUnqueueBuffers);
+    return missing == 0;
+}
+
+/**
+ * Resolves context OpenAL functions <AL/alc.h>
+ * @param table     Function table to fill
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @returns         Non-zero if every function was resolved
+ */
+static int resolve_alc_version_1_1(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg)
+{
+    int missing = 0;
+
+    SALAD_RESOLVE(table->alcCloseDevice,        loadfunc("alcCloseDevice",        arg));
+    SALAD_RESOLVE(table->alcCreateContext,      loadfunc("alcCreateContext",      arg));
+    SALAD_RESOLVE(table->alcDestroyContext,     loadfunc("alcDestroyContext",     arg));
+    SALAD_RESOLVE(table->alcGetContextsDevice,  loadfunc("alcGetContextsDevice",  arg));
+    SALAD_RESOLVE(table->alcGetCurrentContext,  loadfunc("alcGetCurrentContext",  arg));
+    SALAD_RESOLVE(table->alcGetEnumValue,       loadfunc("alcGetEnumValue",       arg));
+    SALAD_RESOLVE(table->alcGetError,           loadfunc("alcGetError",           arg));
+    SALAD_RESOLVE(table->alcGetIntegerv,        loadfunc("alcGetIntegerv",        arg));
+    SALAD_RESOLVE(table->alcGetProcAddress,     loadfunc("alcGetProcAddress",     arg));
+    SALAD_RESOLVE(table->alcGetString,          loadfunc("alcGetString",          arg));
+    SALAD_RESOLVE(table->alcIsExtensionPresent, loadfunc("alcIsExtensionPresent", arg));
+    SALAD_RESOLVE(table->alcMakeContextCurrent, loadfunc("alcMakeContextCurrent", arg));
+    SALAD_RESOLVE(table->alcOpenDevice,         loadfunc("alcOpenDevice",         arg));
+    SALAD_RESOLVE(table->alcProcessContext,     loadfunc("alcProcessContext",     arg));
+    SALAD_RESOLVE(table->alcSuspendContext,     loadfunc("alcSuspendContext",     arg));
+
+    if(missing != 0)
+        SALAD_DISCARD(table, alcCloseDevice, alcSuspendContext);
+    return missing == 0;
+}
+
+/**
+ * Resolves capture OpenAL functions <AL/alc.h>
+ * @param table     Function table to fill
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @returns         Non-zero if every function was resolved
+ */
+static int resolve_alc_ext_capture(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg)
+{
+    int missing = 0;
+
+    SALAD_RESOLVE(table->alcCaptureCloseDevice, loadfunc("alcCaptureCloseDevice", arg));
+    SALAD_RESOLVE(table->alcCaptureOpenDevice,  loadfunc("alcCaptureOpenDevice",  arg));
+    SALAD_RESOLVE(table->alcCaptureSamples,     loadfunc("alcCaptureSamples",     arg));
+    SALAD_RESOLVE(table->alcCaptureStart,       loadfunc("alcCaptureStart",       arg));
+    SALAD_RESOLVE(table->alcCaptureStop,        loadfunc("alcCaptureStop",        arg));
+
+    if(missing != 0)
+        SALAD_DISCARD(table, alcCaptureCloseDevice, alcCaptureStop);
+    return missing == 0;
+}
+
+/**
+ * Resolves ALC_EXT_EFX extension functions <AL/efx.h>
+ * @param table     Function table to fill
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @returns         Non-zero if every function was resolved
+ */
+static int resolve_alc_ext_efx(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg)
+{
+    int missing = 0;
+
+    SALAD_RESOLVE(table->alDeleteEffects, loadfunc("alDeleteEffects", arg));
+    SALAD_RESOLVE(table->alDeleteFilters, loadfunc("alDeleteFilters", arg));
+    SALAD_RESOLVE(table->alEffectf,       loadfunc("alEffectf",       arg));
+    SALAD_RESOLVE(table->alEffectfv,      loadfunc("alEffectfv",      arg));
+    SALAD_RESOLVE(table->alEffecti,       loadfunc("alEffecti",       arg));
+    SALAD_RESOLVE(table->alEffectiv,      loadfunc("alEffectiv",      arg));
+    SALAD_RESOLVE(table->alFilterf,       loadfunc("alFilterf",       arg));
+    SALAD_RESOLVE(table->alFilterfv,      loadfunc("alFilterfv",      arg));
+    SALAD_RESOLVE(table->alFilteri,       loadfunc("alFilteri",       arg));
+    SALAD_RESOLVE(table->alFilteriv,      loadfunc("alFilteriv",      arg));
+    SALAD_RESOLVE(table->alGenEffects,    loadfunc("alGenEffects",    arg));
+    SALAD_RESOLVE(table->alGenFilters,    loadfunc("alGenFilters",    arg));
+    SALAD_RESOLVE(table->alGetEffectf,    loadfunc("alGetEffectf",    arg));
+    SALAD_RESOLVE(table->alGetEffectfv,   loadfunc("alGetEffectfv",   arg));
+    SALAD_RESOLVE(table->alGetEffecti,    loadfunc("alGetEffecti",    arg));
+    SALAD_RESOLVE(table->alGetEffectiv,   loadfunc("alGetEffectiv",   arg));
+    SALAD_RESOLVE(table->alGetFilterf,    loadfunc("alGetFilterf",    arg));
+    SALAD_RESOLVE(table->alGetFilterfv,   loadfunc("alGetFilterfv",   arg));
+    SALAD_RESOLVE(table->alGetFilteri,    loadfunc("alGetFilteri",    arg));
+    SALAD_RESOLVE(table->alGetFilteriv,   loadfunc("alGetFilteriv",   arg));
+    SALAD_RESOLVE(table->alIsEffect,      loadfunc("alIsEffect",      arg));
+    SALAD_RESOLVE(table->alIsFilter,      loadfunc("alIsFilter",      arg));
+
+    if(missing != 0)
+        SALAD_DISCARD(table, alDeleteEffects, alIsFilter);
+    return missing == 0;
+}
+
+/**
+ * Resolves AL_SOFT_deferred_updates extension functions <AL/alext.h>
+ * @param table     Function table to fill
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @returns         Non-zero if every function was resolved
+ */
+static int resolve_al_soft_deferred_updates(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg)
+{
+    int missing = 0;
+
+    SALAD_RESOLVE(table->alDeferUpdatesSOFT,   loadfunc("alDeferUpdatesSOFT",   arg));
+    SALAD_RESOLVE(table->alProcessUpdatesSOFT, loadfunc("alProcessUpdatesSOFT", arg));
+
+    if(missing != 0)
+        SALAD_DISCARD(table, alDeferUpdatesSOFT, alProcessUpdatesSOFT);
+    return missing == 0;
+}
+
+/**
+ * Resolves ALC_SOFT_loopback extension functions <AL/alext.h>
+ * @param table     Function table to fill
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @returns         Non-zero if every function was resolved
+ */
+static int resolve_alc_soft_loopback(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg)
+{
+    int missing = 0;
+
+    SALAD_RESOLVE(table->alcIsRenderFormatSupportedSOFT, loadfunc("alcIsRenderFormatSupportedSOFT", arg));
+    SALAD_RESOLVE(table->alcLoopbackOpenDeviceSOFT,      loadfunc("alcLoopbackOpenDeviceSOFT",      arg));
+    SALAD_RESOLVE(table->alcRenderSamplesSOFT,           loadfunc("alcRenderSamplesSOFT",           arg));
+
+    if(missing != 0)
+        SALAD_DISCARD(table, alcIsRenderFormatSupportedSOFT, alcRenderSamplesSOFT);
+    return missing == 0;
+}
+
+/**
+ * Resolves AL_SOFT_callback_buffer extension functions <AL/alext.h>
+ * @param table     Function table to fill
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @returns         Non-zero if every function was resolved
+ */
+static int resolve_al_soft_callback_buffer(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg)
+{
+    int missing = 0;
+
+    SALAD_RESOLVE(table->alBufferCallbackSOFT, loadfunc("alBufferCallbackSOFT", arg));
+    SALAD_RESOLVE(table->alGetBuffer3PtrSOFT,  loadfunc("alGetBuffer3PtrSOFT",  arg));
+    SALAD_RESOLVE(table->alGetBufferPtrSOFT,   loadfunc("alGetBufferPtrSOFT",   arg));
+    SALAD_RESOLVE(table->alGetBufferPtrvSOFT,  loadfunc("alGetBufferPtrvSOFT",  arg));
+
+    if(missing != 0)
+        SALAD_DISCARD(table, alBufferCallbackSOFT, alGetBufferPtrvSOFT);
+    return missing == 0;
+}
+
+/**
+ * Resolves ALC_EXT_thread_local_context extension functions <AL/alext.h>
+ * @param table     Function table to fill
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @returns         Non-zero if every function was resolved
+ */
+static int resolve_alc_ext_thread_local_context(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg)
+{
+    int missing = 0;
+
+    SALAD_RESOLVE(table->alcGetThreadContext, loadfunc("alcGetThreadContext", arg));
+    SALAD_RESOLVE(table->alcSetThreadContext, loadfunc("alcSetThreadContext", arg));
+
+    if(missing != 0)
+        SALAD_DISCARD(table, alcGetThreadContext, alcSetThreadContext);
+    return missing == 0;
+}
+
+/**
+ * Resolves AL_EXT_STATIC_BUFFER extension functions <AL/alext.h>
+ * @param table     Function table to fill
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @returns         Non-zero if every function was resolved
+ */
+static int resolve_al_ext_static_buffer(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg)
+{
+    int missing = 0;
+
+    SALAD_RESOLVE(table->alBufferDataStatic, loadfunc("alBufferDataStatic", arg));
+
+    if(missing != 0)
+        SALAD_DISCARD(table, alBufferDataStatic, alBufferDataStatic);
+    return missing == 0;
+}
+
+unsigned int salad_resolve_groups(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg, unsigned int groups)
+{
+    unsigned int loaded = 0;
+    unsigned int failed = 0;
+
+    if((groups & SALAD_GROUP_CORE) != 0) {
+        loaded |= SALAD_GROUP_CORE;
+        if(!resolve_al_version_1_1(table, loadfunc, arg))
+            failed |= SALAD_GROUP_CORE;
+    }
+
+    if((groups & SALAD_GROUP_ALC) != 0) {
+        loaded |= SALAD_GROUP_ALC;
+        if(!resolve_alc_version_1_1(table, loadfunc, arg))
+            failed |= SALAD_GROUP_ALC;
+    }
+
+    if((groups & SALAD_GROUP_CAPTURE) != 0) {
+        loaded |= SALAD_GROUP_CAPTURE;
+        if(!resolve_alc_ext_capture(table, loadfunc, arg))
+            failed |= SALAD_GROUP_CAPTURE;
+    }
+
+    if((groups & SALAD_GROUP_EFX) != 0) {
+        loaded |= SALAD_GROUP_EFX;
+        if(!resolve_alc_ext_efx(table, loadfunc, arg))
+            failed |= SALAD_GROUP_EFX;
+    }
+
+    if((groups & SALAD_GROUP_SOFT) != 0) {
+        loaded |= SALAD_GROUP_SOFT;
+        if(!resolve_al_soft_deferred_updates(table, loadfunc, arg))
+            failed |= SALAD_GROUP_SOFT;
+    }
+
+    if((groups & SALAD_GROUP_SOFT) != 0) {
+        loaded |= SALAD_GROUP_SOFT;
+        if(!resolve_alc_soft_loopback(table, loadfunc, arg))
+            failed |= SALAD_GROUP_SOFT;
+    }
+
+    if((groups & SALAD_GROUP_SOFT) != 0) {
+        loaded |= SALAD_GROUP_SOFT;
+        if(!resolve_al_soft_callback_buffer(table, loadfunc, arg))
+            failed |= SALAD_GROUP_SOFT;
+    }
+
+    if((groups & SALAD_GROUP_THREAD) != 0) {
+        loaded |= SALAD_GROUP_THREAD;
+        if(!resolve_alc_ext_thread_local_context(table, loadfunc, arg))
+            failed |= SALAD_GROUP_THREAD;
+    }
+
+    if((groups & SALAD_GROUP_STATIC) != 0) {
+        loaded |= SALAD_GROUP_STATIC;
+        if(!resolve_al_ext_static_buffer(table, loadfunc, arg))
+            failed |= SALAD_GROUP_STATIC;
+    }
+
+    return loaded & ~failed;
+}
+
+/* Every extension a presence bit is kept for */
+const struct salad_extension salad_extension_list[] = {
+    { "ALC_EXT_EFX",                  SALAD_ALC_EXT_EFX                  },
+    { "AL_SOFT_deferred_updates",     SALAD_AL_SOFT_deferred_updates     },
+    { "AL_EXT_float32",               SALAD_AL_EXT_float32               },
+    { "AL_EXT_MCFORMATS",             SALAD_AL_EXT_MCFORMATS             },
+    { "ALC_SOFT_loopback",            SALAD_ALC_SOFT_loopback            },
+    { "AL_SOFT_callback_buffer",      SALAD_AL_SOFT_callback_buffer      },
+    { "ALC_EXT_thread_local_context", SALAD_ALC_EXT_thread_local_context },
+    { "AL_EXT_STATIC_BUFFER",         SALAD_AL_EXT_STATIC_BUFFER         },
+    { "AL_EXT_IMA4",                  SALAD_AL_EXT_IMA4                  },
+    { NULL, 0 }
+};
+
+#if !defined(SALAD_DIRECT_LINK)
+
+/* Core OpenAL functions <AL/al.h> */
+PFN_alBuffer3f             SALAD_alBuffer3f             = NULL;
+PFN_alBuffer3i             SALAD_alBuffer3i             = NULL;
+PFN_alBufferData           SALAD_alBufferData           = NULL;
+PFN_alBufferf              SALAD_alBufferf              = NULL;
+PFN_alBufferfv             SALAD_alBufferfv             = NULL;
+PFN_alBufferi              SALAD_alBufferi              = NULL;
+PFN_alBufferiv             SALAD_alBufferiv             = NULL;
+PFN_alDeleteBuffers        SALAD_alDeleteBuffers        = NULL;
+PFN_alDeleteSources        SALAD_alDeleteSources        = NULL;
+PFN_alDisable              SALAD_alDisable              = NULL;
+PFN_alEnable               SALAD_alEnable               = NULL;
+PFN_alGenBuffers           SALAD_alGenBuffers           = NULL;
+PFN_alGenSources           SALAD_alGenSources           = NULL;
+PFN_alGetBoolean           SALAD_alGetBoolean           = NULL;
+PFN_alGetBooleanv          SALAD_alGetBooleanv          = NULL;
+PFN_alGetBuffer3f          SALAD_alGetBuffer3f          = NULL;
+PFN_alGetBuffer3i          SALAD_alGetBuffer3i          = NULL;
+PFN_alGetBufferf           SALAD_alGetBufferf           = NULL;
+PFN_alGetBufferfv          SALAD_alGetBufferfv          = NULL;
+PFN_alGetBufferi           SALAD_alGetBufferi           = NULL;
+PFN_alGetBufferiv          SALAD_alGetBufferiv          = NULL;
+PFN_alGetDouble            SALAD_alGetDouble            = NULL;
+PFN_alGetDoublev           SALAD_alGetDoublev           = NULL;
+PFN_alGetEnumValue         SALAD_alGetEnumValue         = NULL;
+PFN_alGetError             SALAD_alGetError             = NULL;
+PFN_alGetFloat             SALAD_alGetFloat             = NULL;
+PFN_alGetFloatv            SALAD_alGetFloatv            = NULL;
+PFN_alGetInteger           SALAD_alGetInteger           = NULL;
+PFN_alGetIntegerv          SALAD_alGetIntegerv          = NULL;
+PFN_alGetListener3f        SALAD_alGetListener3f        = NULL;
+PFN_alGetListener3i        SALAD_alGetListener3i        = NULL;
+PFN_alGetListenerf         SALAD_alGetListenerf         = NULL;
+PFN_alGetListenerfv        SALAD_alGetListenerfv        = NULL;
+PFN_alGetListeneri         SALAD_alGetListeneri         = NULL;
+PFN_alGetListeneriv        SALAD_alGetListeneriv        = NULL;
+PFN_alGetProcAddress       SALAD_alGetProcAddress       = NULL;
+PFN_alGetSource3f          SALAD_alGetSource3f          = NULL;
+PFN_alGetSource3i          SALAD_alGetSource3i          = NULL;
+PFN_alGetSourcef           SALAD_alGetSourcef           = NULL;
+PFN_alGetSourcefv          SALAD_alGetSourcefv          = NULL;
+PFN_alGetSourcei           SALAD_alGetSourcei           = NULL;
+PFN_alGetSourceiv          SALAD_alGetSourceiv          = NULL;
+PFN_alGetString            SALAD_alGetString            = NULL;
+PFN_alIsBuffer             SALAD_alIsBuffer             = NULL;
+PFN_alIsEnabled            SALAD_alIsEnabled            = NULL;
+PFN_alIsExtensionPresent   SALAD_alIsExtensionPresent   = NULL;
+PFN_alIsSource             SALAD_alIsSource             = NULL;
+PFN_alListener3f           SALAD_alListener3f           = NULL;
+PFN_alListener3i           SALAD_alListener3i           = NULL;
+PFN_alListenerf            SALAD_alListenerf            = NULL;
+PFN_alListenerfv           SALAD_alListenerfv           = NULL;
+PFN_alListeneri            SALAD_alListeneri            = NULL;
+PFN_alListeneriv           SALAD_alListeneriv           = NULL;
+PFN_alSource3f             SALAD_alSource3f             = NULL;
+PFN_alSource3i             SALAD_alSource3i             = NULL;
+PFN_alSourcef              SALAD_alSourcef              = NULL;
+PFN_alSourcefv             SALAD_alSourcefv             = NULL;
+PFN_alSourcei              SALAD_alSourcei              = NULL;
+PFN_alSourceiv             SALAD_alSourceiv             = NULL;
+PFN_alSourcePause          SALAD_alSourcePause          = NULL;
+PFN_alSourcePausev         SALAD_alSourcePausev         = NULL;
+PFN_alSourcePlay           SALAD_alSourcePlay           = NULL;
+PFN_alSourcePlayv          SALAD_alSourcePlayv          = NULL;
+PFN_alSourceQueueBuffers   SALAD_alSourceQueueBuffers   = NULL;
+PFN_alSourceRewind         SALAD_alSourceRewind         = NULL;
+PFN_alSourceRewindv        SALAD_alSourceRewindv        = NULL;
+PFN_alSourceStop           SALAD_alSourceStop           = NULL;
+PFN_alSourceStopv          SALAD_alSourceStopv          = NULL;
+PFN_alSourceUnqueueBuffers SALAD_alSourceUnqueueBuffers = NULL;
+
+/* Context OpenAL functions <AL/alc.h> */
+PFN_alcCloseDevice        SALAD_alcCloseDevice        = NULL;
+PFN_alcCreateContext      SALAD_alcCreateContext      = NULL;
+PFN_alcDestroyContext     SALAD_alcDestroyContext     = NULL;
+PFN_alcGetContextsDevice  SALAD_alcGetContextsDevice  = NULL;
+PFN_alcGetCurrentContext  SALAD_alcGetCurrentContext  = NULL;
+PFN_alcGetEnumValue       SALAD_alcGetEnumValue       = NULL;
+PFN_alcGetError           SALAD_alcGetError           = NULL;
+PFN_alcGetIntegerv        SALAD_alcGetIntegerv        = NULL;
+PFN_alcGetProcAddress     SALAD_alcGetProcAddress     = NULL;
+PFN_alcGetString          SALAD_alcGetString          = NULL;
+PFN_alcIsExtensionPresent SALAD_alcIsExtensionPresent = NULL;
+PFN_alcMakeContextCurrent SALAD_alcMakeContextCurrent = NULL;
+PFN_alcOpenDevice         SALAD_alcOpenDevice         = NULL;
+PFN_alcProcessContext     SALAD_alcProcessContext     = NULL;
+PFN_alcSuspendContext     SALAD_alcSuspendContext     = NULL;
+
+/* Capture OpenAL functions <AL/alc.h> */
+PFN_alcCaptureCloseDevice SALAD_alcCaptureCloseDevice = NULL;
+PFN_alcCaptureOpenDevice  SALAD_alcCaptureOpenDevice  = NULL;
+PFN_alcCaptureSamples     SALAD_alcCaptureSamples     = NULL;
+PFN_alcCaptureStart       SALAD_alcCaptureStart       = NULL;
+PFN_alcCaptureStop        SALAD_alcCaptureStop        = NULL;
+
+/* Extension: ALC_EXT_EFX <AL/efx.h> */
+PFN_alDeleteEffects SALAD_alDeleteEffects = NULL;
+PFN_alDeleteFilters SALAD_alDeleteFilters = NULL;
+PFN_alEffectf       SALAD_alEffectf       = NULL;
+PFN_alEffectfv      SALAD_alEffectfv      = NULL;
+PFN_alEffecti       SALAD_alEffecti       = NULL;
+PFN_alEffectiv      SALAD_alEffectiv      = NULL;
+PFN_alFilterf       SALAD_alFilterf       = NULL;
+PFN_alFilterfv      SALAD_alFilterfv      = NULL;
+PFN_alFilteri       SALAD_alFilteri       = NULL;
+PFN_alFilteriv      SALAD_alFilteriv      = NULL;
+PFN_alGenEffects    SALAD_alGenEffects    = NULL;
+PFN_alGenFilters    SALAD_alGenFilters    = NULL;
+PFN_alGetEffectf    SALAD_alGetEffectf    = NULL;
+PFN_alGetEffectfv   SALAD_alGetEffectfv   = NULL;
+PFN_alGetEffecti    SALAD_alGetEffecti    = NULL;
+PFN_alGetEffectiv   SALAD_alGetEffectiv   = NULL;
+PFN_alGetFilterf    SALAD_alGetFilterf    = NULL;
+PFN_alGetFilterfv   SALAD_alGetFilterfv   = NULL;
+PFN_alGetFilteri    SALAD_alGetFilteri    = NULL;
+PFN_alGetFilteriv   SALAD_alGetFilteriv   = NULL;
+PFN_alIsEffect      SALAD_alIsEffect      = NULL;
+PFN_alIsFilter      SALAD_alIsFilter      = NULL;
+
+/* Extension: AL_SOFT_deferred_updates <AL/alext.h> */
+PFN_alDeferUpdatesSOFT   SALAD_alDeferUpdatesSOFT   = NULL;
+PFN_alProcessUpdatesSOFT SALAD_alProcessUpdatesSOFT = NULL;
+
+/* Extension: ALC_SOFT_loopback <AL/alext.h> */
+PFN_alcIsRenderFormatSupportedSOFT SALAD_alcIsRenderFormatSupportedSOFT = NULL;
+PFN_alcLoopbackOpenDeviceSOFT      SALAD_alcLoopbackOpenDeviceSOFT      = NULL;
+PFN_alcRenderSamplesSOFT           SALAD_alcRenderSamplesSOFT           = NULL;
+
+/* Extension: AL_SOFT_callback_buffer <AL/alext.h> */
+PFN_alBufferCallbackSOFT SALAD_alBufferCallbackSOFT = NULL;
+PFN_alGetBuffer3PtrSOFT  SALAD_alGetBuffer3PtrSOFT  = NULL;
+PFN_alGetBufferPtrSOFT   SALAD_alGetBufferPtrSOFT   = NULL;
+PFN_alGetBufferPtrvSOFT  SALAD_alGetBufferPtrvSOFT  = NULL;
+
+/* Extension: ALC_EXT_thread_local_context <AL/alext.h> */
+PFN_alcGetThreadContext SALAD_alcGetThreadContext = NULL;
+PFN_alcSetThreadContext SALAD_alcSetThreadContext = NULL;
+
+/* Extension: AL_EXT_STATIC_BUFFER <AL/alext.h> */
+PFN_alBufferDataStatic SALAD_alBufferDataStatic = NULL;
+
+void salad_publish_table(const SALAD_table_type *table, unsigned int groups)
+{
+    if((groups & SALAD_GROUP_CORE) != 0) {
+        salad_atomic_store_ptr(&SALAD_alBuffer3f,             table->alBuffer3f);
+        salad_atomic_store_ptr(&SALAD_alBuffer3i,             table->alBuffer3i);
+        salad_atomic_store_ptr(&SALAD_alBufferData,           table->alBufferData);
+        salad_atomic_store_ptr(&SALAD_alBufferf,              table->alBufferf);
+        salad_atomic_store_ptr(&SALAD_alBufferfv,             table->alBufferfv);
+        salad_atomic_store_ptr(&SALAD_alBufferi,              table->alBufferi);
+        salad_atomic_store_ptr(&SALAD_alBufferiv,             table->alBufferiv);
+        salad_atomic_store_ptr(&SALAD_alDeleteBuffers,        table->alDeleteBuffers);
+        salad_atomic_store_ptr(&SALAD_alDeleteSources,        table->alDeleteSources);
+        salad_atomic_store_ptr(&SALAD_alDisable,              table->alDisable);
+        salad_atomic_store_ptr(&SALAD_alEnable,               table->alEnable);
+        salad_atomic_store_ptr(&SALAD_alGenBuffers,           table->alGenBuffers);
+        salad_atomic_store_ptr(&SALAD_alGenSources,           table->alGenSources);
+        salad_atomic_store_ptr(&SALAD_alGetBoolean,           table->alGetBoolean);
+        salad_atomic_store_ptr(&SALAD_alGetBooleanv,          table->alGetBooleanv);
+        salad_atomic_store_ptr(&SALAD_alGetBuffer3f,          table->alGetBuffer3f);
+        salad_atomic_store_ptr(&SALAD_alGetBuffer3i,          table->alGetBuffer3i);
+        salad_atomic_store_ptr(&SALAD_alGetBufferf,           table->alGetBufferf);
+        salad_atomic_store_ptr(&SALAD_alGetBufferfv,          table->alGetBufferfv);
+        salad_atomic_store_ptr(&SALAD_alGetBufferi,           table->alGetBufferi);
+        salad_atomic_store_ptr(&SALAD_alGetBufferiv,          table->alGetBufferiv);
+        salad_atomic_store_ptr(&SALAD_alGetDouble,            table->alGetDouble);
+        salad_atomic_store_ptr(&SALAD_alGetDoublev,           table->alGetDoublev);
+        salad_atomic_store_ptr(&SALAD_alGetEnumValue,         table->alGetEnumValue);
+        salad_atomic_store_ptr(&SALAD_alGetError,             table->alGetError);
+        salad_atomic_store_ptr(&SALAD_alGetFloat,             table->alGetFloat);
+        salad_atomic_store_ptr(&SALAD_alGetFloatv,            table->alGetFloatv);
+        salad_atomic_store_ptr(&SALAD_alGetInteger,           table->alGetInteger);
+        salad_atomic_store_ptr(&SALAD_alGetIntegerv,          table->alGetIntegerv);
+        salad_atomic_store_ptr(&SALAD_alGetListener3f,        table->alGetListener3f);
+        salad_atomic_store_ptr(&SALAD_alGetListener3i,        table->alGetListener3i);
+        salad_atomic_store_ptr(&SALAD_alGetListenerf,         table->alGetListenerf);
+        salad_atomic_store_ptr(&SALAD_alGetListenerfv,        table->alGetListenerfv);
+        salad_atomic_store_ptr(&SALAD_alGetListeneri,         table->alGetListeneri);
+        salad_atomic_store_ptr(&SALAD_alGetListeneriv,        table->alGetListeneriv);
+        salad_atomic_store_ptr(&SALAD_alGetProcAddress,       table->alGetProcAddress);
+        salad_atomic_store_ptr(&SALAD_alGetSource3f,          table->alGetSource3f);
+        salad_atomic_store_ptr(&SALAD_alGetSource3i,          table->alGetSource3i);
+        salad_atomic_store_ptr(&SALAD_alGetSourcef,           table->alGetSourcef);
+        salad_atomic_store_ptr(&SALAD_alGetSourcefv,          table->alGetSourcefv);
+        salad_atomic_store_ptr(&SALAD_alGetSourcei,           table->alGetSourcei);
+        salad_atomic_store_ptr(&SALAD_alGetSourceiv,          table->alGetSourceiv);
+        salad_atomic_store_ptr(&SALAD_alGetString,            table->alGetString);
+        salad_atomic_store_ptr(&SALAD_alIsBuffer,             table->alIsBuffer);
+        salad_atomic_store_ptr(&SALAD_alIsEnabled,            table->alIsEnabled);
+        salad_atomic_store_ptr(&SALAD_alIsExtensionPresent,   table->alIsExtensionPresent);
+        salad_atomic_store_ptr(&SALAD_alIsSource,             table->alIsSource);
+        salad_atomic_store_ptr(&SALAD_alListener3f,           table->alListener3f);
+        salad_atomic_store_ptr(&SALAD_alListener3i,           table->alListener3i);
+        salad_atomic_store_ptr(&SALAD_alListenerf,            table->alListenerf);
+        salad_atomic_store_ptr(&SALAD_alListenerfv,           table->alListenerfv);
+        salad_atomic_store_ptr(&SALAD_alListeneri,            table->alListeneri);
+        salad_atomic_store_ptr(&SALAD_alListeneriv,           table->alListeneriv);
+        salad_atomic_store_ptr(&SALAD_alSource3f,             table->alSource3f);
+        salad_atomic_store_ptr(&SALAD_alSource3i,             table->alSource3i);
+        salad_atomic_store_ptr(&SALAD_alSourcef,              table->alSourcef);
+        salad_atomic_store_ptr(&SALAD_alSourcefv,             table->alSourcefv);
+        salad_atomic_store_ptr(&SALAD_alSourcei,              table->alSourcei);
+        salad_atomic_store_ptr(&SALAD_alSourceiv,             table->alSourceiv);
+        salad_atomic_store_ptr(&SALAD_alSourcePause,          table->alSourcePause);
+        salad_atomic_store_ptr(&SALAD_alSourcePausev,         table->alSourcePausev);
+        salad_atomic_store_ptr(&SALAD_alSourcePlay,           table->alSourcePlay);
+        salad_atomic_store_ptr(&SALAD_alSourcePlayv,          table->alSourcePlayv);
+        salad_atomic_store_ptr(&SALAD_alSourceQueueBuffers,   table->alSourceQueueBuffers);
+        salad_atomic_store_ptr(&SALAD_alSourceRewind,         table->alSourceRewind);
+        salad_atomic_store_ptr(&SALAD_alSourceRewindv,        table->alSourceRewindv);
+        salad_atomic_store_ptr(&SALAD_alSourceStop,           table->alSourceStop);
+        salad_atomic_store_ptr(&SALAD_alSourceStopv,          table->alSourceStopv);
+        salad_atomic_store_ptr(&SALAD_alSourceUnqueueBuffers, table->alSourceUnqueueBuffers);
+    }
+
+    if((groups & SALAD_GROUP_ALC) != 0) {
+        salad_atomic_store_ptr(&SALAD_alcCloseDevice,        table->alcCloseDevice);
+        salad_atomic_store_ptr(&SALAD_alcCreateContext,      table->alcCreateContext);
+        salad_atomic_store_ptr(&SALAD_alcDestroyContext,     table->alcDestroyContext);
+        salad_atomic_store_ptr(&SALAD_alcGetContextsDevice,  table->alcGetContextsDevice);
+        salad_atomic_store_ptr(&SALAD_alcGetCurrentContext,  table->alcGetCurrentContext);
+        salad_atomic_store_ptr(&SALAD_alcGetEnumValue,       table->alcGetEnumValue);
+        salad_atomic_store_ptr(&SALAD_alcGetError,           table->alcGetError);
+        salad_atomic_store_ptr(&SALAD_alcGetIntegerv,        table->alcGetIntegerv);
+        salad_atomic_store_ptr(&SALAD_alcGetProcAddress,     table->alcGetProcAddress);
+        salad_atomic_store_ptr(&SALAD_alcGetString,          table->alcGetString);
+        salad_atomic_store_ptr(&SALAD_alcIsExtensionPresent, table->alcIsExtensionPresent);
+        salad_atomic_store_ptr(&SALAD_alcMakeContextCurrent, table->alcMakeContextCurrent);
+        salad_atomic_store_ptr(&SALAD_alcOpenDevice,         table->alcOpenDevice);
+        salad_atomic_store_ptr(&SALAD_alcProcessContext,     table->alcProcessContext);
+        salad_atomic_store_ptr(&SALAD_alcSuspendContext,     table->alcSuspendContext);
+    }
+
+    if((groups & SALAD_GROUP_CAPTURE) != 0) {
+        salad_atomic_store_ptr(&SALAD_alcCaptureCloseDevice, table->alcCaptureCloseDevice);
+        salad_atomic_store_ptr(&SALAD_alcCaptureOpenDevice,  table->alcCaptureOpenDevice);
+        salad_atomic_store_ptr(&SALAD_alcCaptureSamples,     table->alcCaptureSamples);
+        salad_atomic_store_ptr(&SALAD_alcCaptureStart,       table->alcCaptureStart);
+        salad_atomic_store_ptr(&SALAD_alcCaptureStop,        table->alcCaptureStop);
+    }
+
+    if((groups & SALAD_GROUP_EFX) != 0) {
+        salad_atomic_store_ptr(&SALAD_alDeleteEffects, table->alDeleteEffects);
+        salad_atomic_store_ptr(&SALAD_alDeleteFilters, table->alDeleteFilters);
+        salad_atomic_store_ptr(&SALAD_alEffectf,       table->alEffectf);
+        salad_atomic_store_ptr(&SALAD_alEffectfv,      table->alEffectfv);
+        salad_atomic_store_ptr(&SALAD_alEffecti,       table->alEffecti);
+        salad_atomic_store_ptr(&SALAD_alEffectiv,      table->alEffectiv);
+        salad_atomic_store_ptr(&SALAD_alFilterf,       table->alFilterf);
+        salad_atomic_store_ptr(&SALAD_alFilterfv,      table->alFilterfv);
+        salad_atomic_store_ptr(&SALAD_alFilteri,       table->alFilteri);
+        salad_atomic_store_ptr(&SALAD_alFilteriv,      table->alFilteriv);
+        salad_atomic_store_ptr(&SALAD_alGenEffects,    table->alGenEffects);
+        salad_atomic_store_ptr(&SALAD_alGenFilters,    table->alGenFilters);
+        salad_atomic_store_ptr(&SALAD_alGetEffectf,    table->alGetEffectf);
+        salad_atomic_store_ptr(&SALAD_alGetEffectfv,   table->alGetEffectfv);
+        salad_atomic_store_ptr(&SALAD_alGetEffecti,    table->alGetEffecti);
+        salad_atomic_store_ptr(&SALAD_alGetEffectiv,   table->alGetEffectiv);
+        salad_atomic_store_ptr(&SALAD_alGetFilterf,    table->alGetFilterf);
+        salad_atomic_store_ptr(&SALAD_alGetFilterfv,   table->alGetFilterfv);
+        salad_atomic_store_ptr(&SALAD_alGetFilteri,    table->alGetFilteri);
+        salad_atomic_store_ptr(&SALAD_alGetFilteriv,   table->alGetFilteriv);
+        salad_atomic_store_ptr(&SALAD_alIsEffect,      table->alIsEffect);
+        salad_atomic_store_ptr(&SALAD_alIsFilter,      table->alIsFilter);
+    }
+
+    if((groups & SALAD_GROUP_SOFT) != 0) {
+        salad_atomic_store_ptr(&SALAD_alDeferUpdatesSOFT,   table->alDeferUpdatesSOFT);
+        salad_atomic_store_ptr(&SALAD_alProcessUpdatesSOFT, table->alProcessUpdatesSOFT);
+    }
+
+    if((groups & SALAD_GROUP_SOFT) != 0) {
+        salad_atomic_store_ptr(&SALAD_alcIsRenderFormatSupportedSOFT, table->alcIsRenderFormatSupportedSOFT);
+        salad_atomic_store_ptr(&SALAD_alcLoopbackOpenDeviceSOFT,      table->alcLoopbackOpenDeviceSOFT);
+        salad_atomic_store_ptr(&SALAD_alcRenderSamplesSOFT,           table->alcRenderSamplesSOFT);
+    }
+
+    if((groups & SALAD_GROUP_SOFT) != 0) {
+        salad_atomic_store_ptr(&SALAD_alBufferCallbackSOFT, table->alBufferCallbackSOFT);
+        salad_atomic_store_ptr(&SALAD_alGetBuffer3PtrSOFT,  table->alGetBuffer3PtrSOFT);
+        salad_atomic_store_ptr(&SALAD_alGetBufferPtrSOFT,   table->alGetBufferPtrSOFT);
+        salad_atomic_store_ptr(&SALAD_alGetBufferPtrvSOFT,  table->alGetBufferPtrvSOFT);
+    }
+
+    if((groups & SALAD_GROUP_THREAD) != 0) {
+        salad_atomic_store_ptr(&SALAD_alcGetThreadContext, table->alcGetThreadContext);
+        salad_atomic_store_ptr(&SALAD_alcSetThreadContext, table->alcSetThreadContext);
+    }
+
+    if((groups & SALAD_GROUP_STATIC) != 0) {
+        salad_atomic_store_ptr(&SALAD_alBufferDataStatic, table->alBufferDataStatic);
+    }
+}
+
+/* Lazily resolving trampolines for every feature
+ * function; each one resolves its function on the first call,
+ * patches the global SALAD_* pointer and forwards the call */
+static void AL_APIENTRY lazy_alBuffer3f(ALuint buffer, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
+{
+    PFN_alBuffer3f proc;
+    SALAD_LAZY_RESOLVE(proc, alBuffer3f);
+    if(proc != NULL)
+        proc(buffer, param, value1, value2, value3);
+}
+
+static void AL_APIENTRY lazy_alBuffer3i(ALuint buffer, ALenum param, ALint value1, ALint value2, ALint value3)
+{
+    PFN_alBuffer3i proc;
+    SALAD_LAZY_RESOLVE(proc, alBuffer3i);
+    if(proc != NULL)
+        proc(buffer, param, value1, value2, value3);
+}
+
+static void AL_APIENTRY lazy_alBufferData(ALuint buffer, ALenum format, const ALvoid *data, ALsizei size, ALsizei freq)
+{
+    PFN_alBufferData proc;
+    SALAD_LAZY_RESOLVE(proc, alBufferData);
+    if(proc != NULL)
+        proc(buffer, format, data, size, freq);
+}
+
+static void AL_APIENTRY lazy_alBufferf(ALuint buffer, ALenum param, ALfloat value)
+{
+    PFN_alBufferf proc;
+    SALAD_LAZY_RESOLVE(proc, alBufferf);
+    if(proc != NULL)
+        proc(buffer, param, value);
+}
+
+static void AL_APIENTRY lazy_alBufferfv(ALuint buffer, ALenum param, const ALfloat *values)
+{
+    PFN_alBufferfv proc;
+    SALAD_LAZY_RESOLVE(proc, alBufferfv);
+    if(proc != NULL)
+        proc(buffer, param, values);
+}
+
+static void AL_APIENTRY lazy_alBufferi(ALuint buffer, ALenum param, ALint value)
+{
+    PFN_alBufferi proc;
+    SALAD_LAZY_RESOLVE(proc, alBufferi);
+    if(proc != NULL)
+        proc(buffer, param, value);
+}
+
+static void AL_APIENTRY lazy_alBufferiv(ALuint buffer, ALenum param, const ALint *values)
+{
+    PFN_alBufferiv proc;
+    SALAD_LAZY_RESOLVE(proc, alBufferiv);
+    if(proc != NULL)
+        proc(buffer, param, values);
+}
+
+static void AL_APIENTRY lazy_alDeleteBuffers(ALsizei n, const ALuint *buffers)
+{
+    PFN_alDeleteBuffers proc;
+    SALAD_LAZY_RESOLVE(proc, alDeleteBuffers);
+    if(proc != NULL)
+        proc(n, buffers);
+}
+
+static void AL_APIENTRY lazy_alDeleteSources(ALsizei n, const ALuint *sources)
+{
+    PFN_alDeleteSources proc;
+    SALAD_LAZY_RESOLVE(proc, alDeleteSources);
+    if(proc != NULL)
+        proc(n, sources);
+}
+
+static void AL_APIENTRY lazy_alDisable(ALenum capability)
+{
+    PFN_alDisable proc;
+    SALAD_LAZY_RESOLVE(proc, alDisable);
+    if(proc != NULL)
+        proc(capability);
+}
+
+static void AL_APIENTRY lazy_alEnable(ALenum capability)
+{
+    PFN_alEnable proc;
+    SALAD_LAZY_RESOLVE(proc, alEnable);
+    if(proc != NULL)
+        proc(capability);
+}
+
+static void AL_APIENTRY lazy_alGenBuffers(ALsizei n, ALuint *buffers)
+{
+    PFN_alGenBuffers proc;
+    SALAD_LAZY_RESOLVE(proc, alGenBuffers);
+    if(proc != NULL)
+        proc(n, buffers);
+}
+
+static void AL_APIENTRY lazy_alGenSources(ALsizei n, ALuint *sources)
+{
+    PFN_alGenSources proc;
+    SALAD_LAZY_RESOLVE(proc, alGenSources);
+    if(proc != NULL)
+        proc(n, sources);
+}
+
+static ALboolean AL_APIENTRY lazy_alGetBoolean(ALenum param)
+{
+    PFN_alGetBoolean proc;
+    SALAD_LAZY_RESOLVE(proc, alGetBoolean);
+    return (proc != NULL) ? proc(param) : 0;
+}
+
+static void AL_APIENTRY lazy_alGetBooleanv(ALenum param, ALboolean *values)
+{
+    PFN_alGetBooleanv proc;
+    SALAD_LAZY_RESOLVE(proc, alGetBooleanv);
+    if(proc != NULL)
+        proc(param, values);
+}
+
+static void AL_APIENTRY lazy_alGetBuffer3f(ALuint buffer, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
+{
+    PFN_alGetBuffer3f proc;
+    SALAD_LAZY_RESOLVE(proc, alGetBuffer3f);
+    if(proc != NULL)
+        proc(buffer, param, value1, value2, value3);
+}
+
+static void AL_APIENTRY lazy_alGetBuffer3i(ALuint buffer, ALenum param, ALint *value1, ALint *value2, ALint *value3)
+{
+    PFN_alGetBuffer3i proc;
+    SALAD_LAZY_RESOLVE(proc, alGetBuffer3i);
+    if(proc != NULL)
+        proc(buffer, param, value1, value2, value3);
+}
+
+static void AL_APIENTRY lazy_alGetBufferf(ALuint buffer, ALenum param, ALfloat *value)
+{
+    PFN_alGetBufferf proc;
+    SALAD_LAZY_RESOLVE(proc, alGetBufferf);
+    if(proc != NULL)
+        proc(buffer, param, value);
+}
+
+static void AL_APIENTRY lazy_alGetBufferfv(ALuint buffer, ALenum param, ALfloat *values)
+{
+    PFN_alGetBufferfv proc;
+    SALAD_LAZY_RESOLVE(proc, alGetBufferfv);
+    if(proc != NULL)
+        proc(buffer, param, values);
+}
+
+static void AL_APIENTRY lazy_alGetBufferi(ALuint buffer, ALenum param, ALint *value)
+{
+    PFN_alGetBufferi proc;
+    SALAD_LAZY_RESOLVE(proc, alGetBufferi);
+    if(proc != NULL)
+        proc(buffer, param, value);
+}
+
+static void AL_APIENTRY lazy_alGetBufferiv(ALuint buffer, ALenum param, ALint *values)
+{
+    PFN_alGetBufferiv proc;
+    SALAD_LAZY_RESOLVE(proc, alGetBufferiv);
+    if(proc != NULL)
+        proc(buffer, param, values);
+}
+
+static ALdouble AL_APIENTRY lazy_alGetDouble(ALenum param)
+{
+    PFN_alGetDouble proc;
+    SALAD_LAZY_RESOLVE(proc, alGetDouble);
+    return (proc != NULL) ? proc(param) : 0;
+}
+
+static void AL_APIENTRY lazy_alGetDoublev(ALenum param, ALdouble *values)
+{
+    PFN_alGetDoublev proc;
+    SALAD_LAZY_RESOLVE(proc, alGetDoublev);
+    if(proc != NULL)
+        proc(param, values);
+}
+
+static ALenum AL_APIENTRY lazy_alGetEnumValue(const ALchar *ename)
+{
+    PFN_alGetEnumValue proc;
+    SALAD_LAZY_RESOLVE(proc, alGetEnumValue);
+    return (proc != NULL) ? proc(ename) : 0;
+}
+
+static ALenum AL_APIENTRY lazy_alGetError(void)
+{
+    PFN_alGetError proc;
+    SALAD_LAZY_RESOLVE(proc, alGetError);
+    return (proc != NULL) ? proc() : 0;
+}
+
+static ALfloat AL_APIENTRY lazy_alGetFloat(ALenum param)
+{
+    PFN_alGetFloat proc;
+    SALAD_LAZY_RESOLVE(proc, alGetFloat);
+    return (proc != NULL) ? proc(param) : 0;
+}
+
+static void AL_APIENTRY lazy_alGetFloatv(ALenum param, ALfloat *values)
+{
+    PFN_alGetFloatv proc;
+    SALAD_LAZY_RESOLVE(proc, alGetFloatv);
+    if(proc != NULL)
+        proc(param, values);
+}
+
+static ALint AL_APIENTRY lazy_alGetInteger(ALenum param)
+{
+    PFN_alGetInteger proc;
+    SALAD_LAZY_RESOLVE(proc, alGetInteger);
+    return (proc != NULL) ? proc(param) : 0;
+}
+
+static void AL_APIENTRY lazy_alGetIntegerv(ALenum param, ALint *values)
+{
+    PFN_alGetIntegerv proc;
+    SALAD_LAZY_RESOLVE(proc, alGetIntegerv);
+    if(proc != NULL)
+        proc(param, values);
+}
+
+static void AL_APIENTRY lazy_alGetListener3f(ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
+{
+    PFN_alGetListener3f proc;
+    SALAD_LAZY_RESOLVE(proc, alGetListener3f);
+    if(proc != NULL)
+        proc(param, value1, value2, value3);
+}
+
+static void AL_APIENTRY lazy_alGetListener3i(ALenum param, ALint *value1, ALint *value2, ALint *value3)
+{
+    PFN_alGetListener3i proc;
+    SALAD_LAZY_RESOLVE(proc, alGetListener3i);
+    if(proc != NULL)
+        proc(param, value1, value2, value3);
+}
+
+static void AL_APIENTRY lazy_alGetListenerf(ALenum param, ALfloat *value)
+{
+    PFN_alGetListenerf proc;
+    SALAD_LAZY_RESOLVE(proc, alGetListenerf);
+    if(proc != NULL)
+        proc(param, value);
+}
+
+static void AL_APIENTRY lazy_alGetListenerfv(ALenum param, ALfloat *values)
+{
+    PFN_alGetListenerfv proc;
+    SALAD_LAZY_RESOLVE(proc, alGetListenerfv);
+    if(proc != NULL)
+        proc(param, values);
+}
+
+static void AL_APIENTRY lazy_alGetListeneri(ALenum param, ALint *value)
+{
+    PFN_alGetListeneri proc;
+    SALAD_LAZY_RESOLVE(proc, alGetListeneri);
+    if(proc != NULL)
+        proc(param, value);
+}
+
+static void AL_APIENTRY lazy_alGetListeneriv(ALenum param, ALint *values)
+{
+    PFN_alGetListeneriv proc;
+    SALAD_LAZY_RESOLVE(proc, alGetListeneriv);
+    if(proc != NULL)
+        proc(param, values);
+}
+
+static void *AL_APIENTRY lazy_alGetProcAddress(const ALchar *fname)
+{
+    PFN_alGetProcAddress proc;
+    SALAD_LAZY_RESOLVE(proc, alGetProcAddress);
+    return (proc != NULL) ? proc(fname) : 0;
+}
+
+static void AL_APIENTRY lazy_alGetSource3f(ALuint source, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
+{
+    PFN_alGetSource3f proc;
+    SALAD_LAZY_RESOLVE(proc, alGetSource3f);
+    if(proc != NULL)
+        proc(source, param, value1, value2, value3);
+}
+
+static void AL_APIENTRY lazy_alGetSource3i(ALuint source, ALenum param, ALint *value1, ALint *value2, ALint *value3)
+{
+    PFN_alGetSource3i proc;
+    SALAD_LAZY_RESOLVE(proc, alGetSource3i);
+    if(proc != NULL)
+        proc(source, param, value1, value2, value3);
+}
+
+static void AL_APIENTRY lazy_alGetSourcef(ALuint source, ALenum param, ALfloat *value)
+{
+    PFN_alGetSourcef proc;
+    SALAD_LAZY_RESOLVE(proc, alGetSourcef);
+    if(proc != NULL)
+        proc(source, param, value);
+}
+
+static void AL_APIENTRY lazy_alGetSourcefv(ALuint source, ALenum param, ALfloat *values)
+{
+    PFN_alGetSourcefv proc;
+    SALAD_LAZY_RESOLVE(proc, alGetSourcefv);
+    if(proc != NULL)
+        proc(source, param, values);
+}
+
+static void AL_APIENTRY lazy_alGetSourcei(ALuint source, ALenum param, ALint *value)
+{
+    PFN_alGetSourcei proc;
+    SALAD_LAZY_RESOLVE(proc, alGetSourcei);
+    if(proc != NULL)
+        proc(source, param, value);
+}
+
+static void AL_APIENTRY lazy_alGetSourceiv(ALuint source, ALenum param, ALint *values)
+{
+    PFN_alGetSourceiv proc;
+    SALAD_LAZY_RESOLVE(proc, alGetSourceiv);
+    if(proc != NULL)
+        proc(source, param, values);
+}
+
+static const ALchar *AL_APIENTRY lazy_alGetString(ALenum param)
+{
+    PFN_alGetString proc;
+    SALAD_LAZY_RESOLVE(proc, alGetString);
+    return (proc != NULL) ? proc(param) : 0;
+}
+
+static ALboolean AL_APIENTRY lazy_alIsBuffer(ALuint buffer)
+{
+    PFN_alIsBuffer proc;
+    SALAD_LAZY_RESOLVE(proc, alIsBuffer);
+    return (proc != NULL) ? proc(buffer) : 0;
+}
+
+static ALboolean AL_APIENTRY lazy_alIsEnabled(ALenum capability)
+{
+    PFN_alIsEnabled proc;
+    SALAD_LAZY_RESOLVE(proc, alIsEnabled);
+    return (proc != NULL) ? proc(capability) : 0;
+}
+
+static ALboolean AL_APIENTRY lazy_alIsExtensionPresent(const ALchar *extname)
+{
+    PFN_alIsExtensionPresent proc;
+    SALAD_LAZY_RESOLVE(proc, alIsExtensionPresent);
+    return (proc != NULL) ? proc(extname) : 0;
+}
+
+static ALboolean AL_APIENTRY lazy_alIsSource(ALuint source)
+{
+    PFN_alIsSource proc;
+    SALAD_LAZY_RESOLVE(proc, alIsSource);
+    return (proc != NULL) ? proc(source) : 0;
+}
+
+static void AL_APIENTRY lazy_alListener3f(ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
+{
+    PFN_alListener3f proc;
+    SALAD_LAZY_RESOLVE(proc, alListener3f);
+    if(proc != NULL)
+        proc(param, value1, value2, value3);
+}
+
+static void AL_APIENTRY lazy_alListener3i(ALenum param, ALint value1, ALint value2, ALint value3)
+{
+    PFN_alListener3i proc;
+    SALAD_LAZY_RESOLVE(proc, alListener3i);
+    if(proc != NULL)
+        proc(param, value1, value2, value3);
+}
+
+static void AL_APIENTRY lazy_alListenerf(ALenum param, ALfloat value)
+{
+    PFN_alListenerf proc;
+    SALAD_LAZY_RESOLVE(proc, alListenerf);
+    if(proc != NULL)
+        proc(param, value);
+}
+
+static void AL_APIENTRY lazy_alListenerfv(ALenum param, const ALfloat *values)
+{
+    PFN_alListenerfv proc;
+    SALAD_LAZY_RESOLVE(proc, alListenerfv);
+    if(proc != NULL)
+        proc(param, values);
+}
+
+static void AL_APIENTRY lazy_alListeneri(ALenum param, ALint value)
+{
+    PFN_alListeneri proc;
+    SALAD_LAZY_RESOLVE(proc, alListeneri);
+    if(proc != NULL)
+        proc(param, value);
+}
+
+static void AL_APIENTRY lazy_alListeneriv(ALenum param, const ALint *values)
+{
+    PFN_alListeneriv proc;
+    SALAD_LAZY_RESOLVE(proc, alListeneriv);
+    if(proc != NULL)
+        proc(param, values);
+}
+
+static void AL_APIENTRY lazy_alSource3f(ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
+{
+    PFN_alSource3f proc;
+    SALAD_LAZY_RESOLVE(proc, alSource3f);
+    if(proc != NULL)
+        proc(source, param, value1, value2, value3);
+}
+
+static void AL_APIENTRY lazy_alSource3i(ALuint source, ALenum param, ALint value1, ALint value2, ALint value3)
+{
+    PFN_alSource3i proc;
+    SALAD_LAZY_RESOLVE(proc, alSource3i);
+    if(proc != NULL)
+        proc(source, param, value1, value2, value3);
+}
+
+static void AL_APIENTRY lazy_alSourcef(ALuint source, ALenum param, ALfloat value)
+{
+    PFN_alSourcef proc;
+    SALAD_LAZY_RESOLVE(proc, alSourcef);
+    if(proc != NULL)
+        proc(source, param, value);
+}
+
+static void AL_APIENTRY lazy_alSourcefv(ALuint source, ALenum param, const ALfloat *values)
+{
+    PFN_alSourcefv proc;
+    SALAD_LAZY_RESOLVE(proc, alSourcefv);
+    if(proc != NULL)
+        proc(source, param, values);
+}
+
+static void AL_APIENTRY lazy_alSourcei(ALuint source, ALenum param, ALint value)
+{
+    PFN_alSourcei proc;
+    SALAD_LAZY_RESOLVE(proc, alSourcei);
+    if(proc != NULL)
+        proc(source, param, value);
+}
+
+static void AL_APIENTRY lazy_alSourceiv(ALuint source, ALenum param, const ALint *values)
+{
+    PFN_alSourceiv proc;
+    SALAD_LAZY_RESOLVE(proc, alSourceiv);
+    if(proc != NULL)
+        proc(source, param, values);
+}
+
+static void AL_APIENTRY lazy_alSourcePause(ALuint source)
+{
+    PFN_alSourcePause proc;
+    SALAD_LAZY_RESOLVE(proc, alSourcePause);
+    if(proc != NULL)
+        proc(source);
+}
+
+static void AL_APIENTRY lazy_alSourcePausev(ALsizei n, const ALuint *sources)
+{
+    PFN_alSourcePausev proc;
+    SALAD_LAZY_RESOLVE(proc, alSourcePausev);
+    if(proc != NULL)
+        proc(n, sources);
+}
+
+static void AL_APIENTRY lazy_alSourcePlay(ALuint source)
+{
+    PFN_alSourcePlay proc;
+    SALAD_LAZY_RESOLVE(proc, alSourcePlay);
+    if(proc != NULL)
+        proc(source);
+}
+
+static void AL_APIENTRY lazy_alSourcePlayv(ALsizei n, const ALuint *sources)
+{
+    PFN_alSourcePlayv proc;
+    SALAD_LAZY_RESOLVE(proc, alSourcePlayv);
+    if(proc != NULL)
+        proc(n, sources);
+}
+
+static void AL_APIENTRY lazy_alSourceQueueBuffers(ALuint source, ALsizei nb, const ALuint *buffers)
+{
+    PFN_alSourceQueueBuffers proc;
+    SALAD_LAZY_RESOLVE(proc, alSourceQueueBuffers);
+    if(proc != NULL)
+        proc(source, nb, buffers);
+}
+
+static void AL_APIENTRY lazy_alSourceRewind(ALuint source)
+{
+    PFN_alSourceRewind proc;
+    SALAD_LAZY_RESOLVE(proc, alSourceRewind);
+    if(proc != NULL)
+        proc(source);
+}
+
+static void AL_APIENTRY lazy_alSourceRewindv(ALsizei n, const ALuint *sources)
+{
+    PFN_alSourceRewindv proc;
+    SALAD_LAZY_RESOLVE(proc, alSourceRewindv);
+    if(proc != NULL)
+        proc(n, sources);
+}
+
+static void AL_APIENTRY lazy_alSourceStop(ALuint source)
+{
+    PFN_alSourceStop proc;
+    SALAD_LAZY_RESOLVE(proc, alSourceStop);
+    if(proc != NULL)
+        proc(source);
+}
+
+static void AL_APIENTRY lazy_alSourceStopv(ALsizei n, const ALuint *sources)
+{
+    PFN_alSourceStopv proc;
+    SALAD_LAZY_RESOLVE(proc, alSourceStopv);
+    if(proc != NULL)
+        proc(n, sources);
+}
+
+static void AL_APIENTRY lazy_alSourceUnqueueBuffers(ALuint source, ALsizei nb, ALuint *buffers)
+{
+    PFN_alSourceUnqueueBuffers proc;
+    SALAD_LAZY_RESOLVE(proc, alSourceUnqueueBuffers);
+    if(proc != NULL)
+        proc(source, nb, buffers);
+}
+
+static ALCboolean ALC_APIENTRY lazy_alcCloseDevice(ALCdevice *device)
+{
+    PFN_alcCloseDevice proc;
+    SALAD_LAZY_RESOLVE(proc, alcCloseDevice);
+    return (proc != NULL) ? proc(device) : 0;
+}
+
+static ALCcontext *ALC_APIENTRY lazy_alcCreateContext(ALCdevice *device, const ALCint *attrlist)
+{
+    PFN_alcCreateContext proc;
+    SALAD_LAZY_RESOLVE(proc, alcCreateContext);
+    return (proc != NULL) ? proc(device, attrlist) : 0;
+}
+
+static void ALC_APIENTRY lazy_alcDestroyContext(ALCcontext *context)
+{
+    PFN_alcDestroyContext proc;
+    SALAD_LAZY_RESOLVE(proc, alcDestroyContext);
+    if(proc != NULL)
+        proc(context);
+}
+
+static ALCdevice *ALC_APIENTRY lazy_alcGetContextsDevice(ALCcontext *context)
+{
+    PFN_alcGetContextsDevice proc;
+    SALAD_LAZY_RESOLVE(proc, alcGetContextsDevice);
+    return (proc != NULL) ? proc(context) : 0;
+}
+
+static ALCcontext *ALC_APIENTRY lazy_alcGetCurrentContext(void)
+{
+    PFN_alcGetCurrentContext proc;
+    SALAD_LAZY_RESOLVE(proc, alcGetCurrentContext);
+    return (proc != NULL) ? proc() : 0;
+}
+
+static ALCenum ALC_APIENTRY lazy_alcGetEnumValue(ALCdevice *device, const ALCchar *enumname)
+{
+    PFN_alcGetEnumValue proc;
+    SALAD_LAZY_RESOLVE(proc, alcGetEnumValue);
+    return (proc != NULL) ? proc(device, enumname) : 0;
+}
+
+static ALCenum ALC_APIENTRY lazy_alcGetError(ALCdevice *device)
+{
+    PFN_alcGetError proc;
+    SALAD_LAZY_RESOLVE(proc, alcGetError);
+    return (proc != NULL) ? proc(device) : 0;
+}
+
+static void ALC_APIENTRY lazy_alcGetIntegerv(ALCdevice *device, ALCenum param, ALCsizei size, ALCint *values)
+{
+    PFN_alcGetIntegerv proc;
+    SALAD_LAZY_RESOLVE(proc, alcGetIntegerv);
+    if(proc != NULL)
+        proc(device, param, size, values);
+}
+
+static ALCvoid *ALC_APIENTRY lazy_alcGetProcAddress(ALCdevice *device, const ALCchar *funcname)
+{
+    PFN_alcGetProcAddress proc;
+    SALAD_LAZY_RESOLVE(proc, alcGetProcAddress);
+    return (proc != NULL) ? proc(device, funcname) : 0;
+}
+
+static const ALCchar *ALC_APIENTRY lazy_alcGetString(ALCdevice *device, ALCenum param)
+{
+    PFN_alcGetString proc;
+    SALAD_LAZY_RESOLVE(proc, alcGetString);
+    return (proc != NULL) ? proc(device, param) : 0;
+}
+
+static ALCboolean ALC_APIENTRY lazy_alcIsExtensionPresent(ALCdevice *device, const ALCchar *extname)
+{
+    PFN_alcIsExtensionPresent proc;
+    SALAD_LAZY_RESOLVE(proc, alcIsExtensionPresent);
+    return (proc != NULL) ? proc(device, extname) : 0;
+}
+
+static ALCboolean ALC_APIENTRY lazy_alcMakeContextCurrent(ALCcontext *context)
+{
+    PFN_alcMakeContextCurrent proc;
+    SALAD_LAZY_RESOLVE(proc, alcMakeContextCurrent);
+    return (proc != NULL) ? proc(context) : 0;
+}
+
+static ALCdevice *ALC_APIENTRY lazy_alcOpenDevice(const ALCchar *devicename)
+{
+    PFN_alcOpenDevice proc;
+    SALAD_LAZY_RESOLVE(proc, alcOpenDevice);
+    return (proc != NULL) ? proc(devicename) : 0;
+}
+
+static void ALC_APIENTRY lazy_alcProcessContext(ALCcontext *context)
+{
+    PFN_alcProcessContext proc;
+    SALAD_LAZY_RESOLVE(proc, alcProcessContext);
+    if(proc != NULL)
+        proc(context);
+}
+
+static void ALC_APIENTRY lazy_alcSuspendContext(ALCcontext *context)
+{
+    PFN_alcSuspendContext proc;
+    SALAD_LAZY_RESOLVE(proc, alcSuspendContext);
+    if(proc != NULL)
+        proc(context);
+}
+
+static ALCboolean ALC_APIENTRY lazy_alcCaptureCloseDevice(ALCdevice *device)
+{
+    PFN_alcCaptureCloseDevice proc;
+    SALAD_LAZY_RESOLVE(proc, alcCaptureCloseDevice);
+    return (proc != NULL) ? proc(device) : 0;
+}
+
+static ALCdevice *ALC_APIENTRY lazy_alcCaptureOpenDevice(const ALCchar *devicename, ALCuint frequency, ALCenum format, ALCsizei buffersize)
+{
+    PFN_alcCaptureOpenDevice proc;
+    SALAD_LAZY_RESOLVE(proc, alcCaptureOpenDevice);
+    return (proc != NULL) ? proc(devicename, frequency, format, buffersize) : 0;
+}
+
+static void ALC_APIENTRY lazy_alcCaptureSamples(ALCdevice *device, ALCvoid *buffer, ALCsizei samples)
+{
+    PFN_alcCaptureSamples proc;
+    SALAD_LAZY_RESOLVE(proc, alcCaptureSamples);
+    if(proc != NULL)
+        proc(device, buffer, samples);
+}
+
+static void ALC_APIENTRY lazy_alcCaptureStart(ALCdevice *device)
+{
+    PFN_alcCaptureStart proc;
+    SALAD_LAZY_RESOLVE(proc, alcCaptureStart);
+    if(proc != NULL)
+        proc(device);
+}
+
+static void ALC_APIENTRY lazy_alcCaptureStop(ALCdevice *device)
+{
+    PFN_alcCaptureStop proc;
+    SALAD_LAZY_RESOLVE(proc, alcCaptureStop);
+    if(proc != NULL)
+        proc(device);
+}
+
+void salad_install_trampolines(SALAD_table_type *table, unsigned int groups)
+{
+    if((groups & SALAD_GROUP_CORE) != 0) {
+        table->alBuffer3f             = &lazy_alBuffer3f;
+        table->alBuffer3i             = &lazy_alBuffer3i;
+        table->alBufferData           = &lazy_alBufferData;
+        table->alBufferf              = &lazy_alBufferf;
+        table->alBufferfv             = &lazy_alBufferfv;
+        table->alBufferi              = &lazy_alBufferi;
+        table->alBufferiv             = &lazy_alBufferiv;
+        table->alDeleteBuffers        = &lazy_alDeleteBuffers;
+        table->alDeleteSources        = &lazy_alDeleteSources;
+        table->alDisable              = &lazy_alDisable;
+        table->alEnable               = &lazy_alEnable;
+        table->alGenBuffers           = &lazy_alGenBuffers;
+        table->alGenSources           = &lazy_alGenSources;
+        table->alGetBoolean           = &lazy_alGetBoolean;
+        table->alGetBooleanv          = &lazy_alGetBooleanv;
+        table->alGetBuffer3f          = &lazy_alGetBuffer3f;
+        table->alGetBuffer3i          = &lazy_alGetBuffer3i;
+        table->alGetBufferf           = &lazy_alGetBufferf;
+        table->alGetBufferfv          = &lazy_alGetBufferfv;
+        table->alGetBufferi           = &lazy_alGetBufferi;
+        table->alGetBufferiv          = &lazy_alGetBufferiv;
+        table->alGetDouble            = &lazy_alGetDouble;
+        table->alGetDoublev           = &lazy_alGetDoublev;
+        table->alGetEnumValue         = &lazy_alGetEnumValue;
+        table->alGetError             = &lazy_alGetError;
+        table->alGetFloat             = &lazy_alGetFloat;
+        table->alGetFloatv            = &lazy_alGetFloatv;
+        table->alGetInteger           = &lazy_alGetInteger;
+        table->alGetIntegerv          = &lazy_alGetIntegerv;
+        table->alGetListener3f        = &lazy_alGetListener3f;
+        table->alGetListener3i        = &lazy_alGetListener3i;
+        table->alGetListenerf         = &lazy_alGetListenerf;
+        table->alGetListenerfv        = &lazy_alGetListenerfv;
+        table->alGetListeneri         = &lazy_alGetListeneri;
+        table->alGetListeneriv        = &lazy_alGetListeneriv;
+        table->alGetProcAddress       = &lazy_alGetProcAddress;
+        table->alGetSource3f          = &lazy_alGetSource3f;
+        table->alGetSource3i          = &lazy_alGetSource3i;
+        table->alGetSourcef           = &lazy_alGetSourcef;
+        table->alGetSourcefv          = &lazy_alGetSourcefv;
+        table->alGetSourcei           = &lazy_alGetSourcei;
+        table->alGetSourceiv          = &lazy_alGetSourceiv;
+        table->alGetString            = &lazy_alGetString;
+        table->alIsBuffer             = &lazy_alIsBuffer;
+        table->alIsEnabled            = &lazy_alIsEnabled;
+        table->alIsExtensionPresent   = &lazy_alIsExtensionPresent;
+        table->alIsSource             = &lazy_alIsSource;
+        table->alListener3f           = &lazy_alListener3f;
+        table->alListener3i           = &lazy_alListener3i;
+        table->alListenerf            = &lazy_alListenerf;
+        table->alListenerfv           = &lazy_alListenerfv;
+        table->alListeneri            = &lazy_alListeneri;
+        table->alListeneriv           = &lazy_alListeneriv;
+        table->alSource3f             = &lazy_alSource3f;
+        table->alSource3i             = &lazy_alSource3i;
+        table->alSourcef              = &lazy_alSourcef;
+        table->alSourcefv             = &lazy_alSourcefv;
+        table->alSourcei              = &lazy_alSourcei;
+        table->alSourceiv             = &lazy_alSourceiv;
+        table->alSourcePause          = &lazy_alSourcePause;
+        table->alSourcePausev         = &lazy_alSourcePausev;
+        table->alSourcePlay           = &lazy_alSourcePlay;
+        table->alSourcePlayv          = &lazy_alSourcePlayv;
+        table->alSourceQueueBuffers   = &lazy_alSourceQueueBuffers;
+        table->alSourceRewind         = &lazy_alSourceRewind;
+        table->alSourceRewindv        = &lazy_alSourceRewindv;
+        table->alSourceStop           = &lazy_alSourceStop;
+        table->alSourceStopv          = &lazy_alSourceStopv;
+        table->alSourceUnqueueBuffers = &lazy_alSourceUnqueueBuffers;
+    }
+
+    if((groups & SALAD_GROUP_ALC) != 0) {
+        table->alcCloseDevice        = &lazy_alcCloseDevice;
+        table->alcCreateContext      = &lazy_alcCreateContext;
+        table->alcDestroyContext     = &lazy_alcDestroyContext;
+        table->alcGetContextsDevice  = &lazy_alcGetContextsDevice;
+        table->alcGetCurrentContext  = &lazy_alcGetCurrentContext;
+        table->alcGetEnumValue       = &lazy_alcGetEnumValue;
+        table->alcGetError           = &lazy_alcGetError;
+        table->alcGetIntegerv        = &lazy_alcGetIntegerv;
+        table->alcGetProcAddress     = &lazy_alcGetProcAddress;
+        table->alcGetString          = &lazy_alcGetString;
+        table->alcIsExtensionPresent = &lazy_alcIsExtensionPresent;
+        table->alcMakeContextCurrent = &lazy_alcMakeContextCurrent;
+        table->alcOpenDevice         = &lazy_alcOpenDevice;
+        table->alcProcessContext     = &lazy_alcProcessContext;
+        table->alcSuspendContext     = &lazy_alcSuspendContext;
+    }
+
+    if((groups & SALAD_GROUP_CAPTURE) != 0) {
+        table->alcCaptureCloseDevice = &lazy_alcCaptureCloseDevice;
+        table->alcCaptureOpenDevice  = &lazy_alcCaptureOpenDevice;
+        table->alcCaptureSamples     = &lazy_alcCaptureSamples;
+        table->alcCaptureStart       = &lazy_alcCaptureStart;
+        table->alcCaptureStop        = &lazy_alcCaptureStop;
+    }
+}
+
+#endif /* SALAD_DIRECT_LINK */
@@ -0,0 +1,88 @@
+/*
+ * salad_functions.h - Generated function lists interface
+ * Copyright (C) 2021-2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef SALAD_FUNCTIONS_H
+#define SALAD_FUNCTIONS_H 1
+#include <AL/salad.h>
+
+#include "salad_platform.h"
+
+/* Everything below is implemented in salad_functions.c
+ * which salad_gen writes from gen/salad.reg; the rest of the
+ * loader only ever goes through these few entry points */
+
+/**
+ * Resolves a function for the lazily resolving trampolines
+ * through the load function of the last lazy load; implemented
+ * in salad.c, which publishes the load function before the
+ * trampolines and takes it back when unloading
+ * @param procname  Function name
+ * @returns         The function, NULL if it can't be resolved
+ */
+SALAD_HIDDEN void *salad_lazy_resolve(const char *procname);
+
+/* An extension salad keeps a presence bit for */
+struct salad_extension {
+    const char *name;
+    unsigned int bit;
+};
+
+/**
+ * Every extension compiled in with its
+ * SALAD_<name> bit, terminated by a NULL name
+ */
+SALAD_HIDDEN extern const struct salad_extension salad_extension_list[];
+
+/**
+ * Resolves functions of the given groups; functions
+ * of the other groups are left untouched. A group counts
+ * as loaded once every function in it has been resolved and
+ * with SALAD_PARANOID a block that only resolved partially is
+ * reset to NULL pointers as a whole
+ * @param table     Function table to fill
+ * @param loadfunc  Load function
+ * @param arg       Optional argument for the function
+ * @param groups    SALAD_GROUP_* mask of groups to resolve
+ * @returns         SALAD_GROUP_* mask of groups that were loaded
+ */
+SALAD_HIDDEN unsigned int salad_resolve_groups(SALAD_table_type *table, SALAD_loadfunc_type loadfunc, void *arg, unsigned int groups);
+
+/**
+ * Copies the given groups of a function table
+ * into the global SALAD_* pointers
+ * @param table     Function table to publish
+ * @param groups    SALAD_GROUP_* mask of groups to publish
+ */
+SALAD_HIDDEN void salad_publish_table(const SALAD_table_type *table, unsigned int groups);
+
+/**
+ * Fills feature functions of the given groups with the
+ * lazily resolving trampolines, extensions are left untouched
+ * @param table     Function table to fill
+ * @param groups    SALAD_GROUP_* mask of groups to fill
+ */
+SALAD_HIDDEN void salad_install_trampolines(SALAD_table_type *table, unsigned int groups);
+
+#endif /* SALAD_FUNCTIONS_H */
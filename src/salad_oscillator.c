@@ -0,0 +1,459 @@
+/*
+ * salad_oscillator.c - Table-based oscillators
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <AL/salad_convert.h>
+#include <AL/salad_oscillator.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "salad_simd.h"
+
+/* One period of the wavetable, the phase is 32 bits
+ * of which the top OSC_BITS pick a sample and the rest
+ * interpolate linearly towards the next one */
+#define OSC_BITS    11
+#define OSC_TABLE   (1 << OSC_BITS)
+#define OSC_SHIFT   (32 - OSC_BITS)
+#define OSC_MASK    ((1UL << OSC_SHIFT) - 1UL)
+#define OSC_FRAC    (1.0f / (ALfloat)(1UL << OSC_SHIFT))
+
+/* Samples rendered as floats before they're converted */
+#define OSC_BLOCK   256
+
+/* Numerical Recipes LCG, and the same LCG stepped eight and
+ * sixteen times at once; the vector kernels keep two registers
+ * of lanes, each producing every eighth or sixteenth number, so
+ * together they produce exactly the serial sequence without one
+ * long multiply chain holding up every iteration */
+#define NOISE_MUL   1664525UL
+#define NOISE_ADD   1013904223UL
+#define NOISE_MUL8  3934847009UL
+#define NOISE_ADD8  2748932008UL
+#define NOISE_MUL16 2001863745UL
+#define NOISE_ADD16 2210837584UL
+#define NOISE_SCALE (1.0f / 2147483648.0f)
+
+struct SALAD_oscillator {
+    ALsizei frequency;
+    ALfloat pitch;
+    salad_uint32_type phase;
+    salad_uint32_type step;
+    ALfloat noise;
+    salad_uint32_type seed;
+    ALsizei count;
+    ALsizei audible;
+    ALfloat gains[SALAD_OSCILLATOR_HARMONICS];
+    ALfloat sine[OSC_TABLE];
+    ALfloat table[OSC_TABLE + 1]; /* The last sample repeats the first one */
+};
+
+/**
+ * Renders the wavetable, every kernel below does the same
+ * @param out       Output samples
+ * @param table     Wavetable with the first sample repeated at its end
+ * @param phase     Phase of the first sample
+ * @param step      Phase increment per sample
+ * @param count     Number of samples
+ * @returns         Phase of the sample after the last one
+ */
+static salad_uint32_type render_table_c(ALfloat *out, const ALfloat *table, salad_uint32_type phase, salad_uint32_type step, ALsizei count)
+{
+    ALfloat a, b, frac;
+    ALsizei i;
+
+    for(i = 0; i < count; ++i) {
+        a = table[phase >> OSC_SHIFT];
+        b = table[(phase >> OSC_SHIFT) + 1];
+        frac = (ALfloat)(phase & OSC_MASK) * OSC_FRAC;
+        out[i] = a + (b - a) * frac;
+        phase = (salad_uint32_type)(phase + step);
+    }
+
+    return phase;
+}
+
+/**
+ * Adds white noise to the output, every kernel below
+ * produces exactly the same numbers
+ * @param out       Samples to add to
+ * @param count     Number of samples
+ * @param gain      Peak level of the noise
+ * @param seed      State of the generator
+ * @returns         State of the generator after count samples
+ */
+static salad_uint32_type add_noise_c(ALfloat *out, ALsizei count, ALfloat gain, salad_uint32_type seed)
+{
+    ALsizei i;
+
+    for(i = 0; i < count; ++i) {
+        out[i] += (ALfloat)(salad_int32_type)seed * (gain * NOISE_SCALE);
+        seed = (salad_uint32_type)(seed * NOISE_MUL + NOISE_ADD);
+    }
+
+    return seed;
+}
+
+/**
+ * Fills lanes with the next states of the generator
+ * @param lanes     States to fill
+ * @param count     Number of states
+ * @param seed      State of the generator
+ */
+static void seed_lanes(salad_uint32_type *lanes, ALsizei count, salad_uint32_type seed)
+{
+    ALsizei i;
+
+    for(i = 0; i < count; ++i) {
+        lanes[i] = seed;
+        seed = (salad_uint32_type)(seed * NOISE_MUL + NOISE_ADD);
+    }
+}
+
+struct osc_kernels {
+    salad_uint32_type (*render_table)(ALfloat *out, const ALfloat *table, salad_uint32_type phase, salad_uint32_type step, ALsizei count);
+    salad_uint32_type (*add_noise)(ALfloat *out, ALsizei count, ALfloat gain, salad_uint32_type seed);
+};
+
+static const struct osc_kernels scalar_kernels = {
+    &render_table_c,
+    &add_noise_c
+};
+
+#if defined(SALAD_SIMD_SSE2)
+static salad_uint32_type render_table_sse2(ALfloat *out, const ALfloat *table, salad_uint32_type phase, salad_uint32_type step, ALsizei count)
+{
+    const __m128i mask = _mm_set1_epi32((int)OSC_MASK);
+    const __m128i step4 = _mm_set1_epi32((int)(salad_uint32_type)(step * 4U));
+    const __m128 scale = _mm_set1_ps(OSC_FRAC);
+    __m128i phases = _mm_setr_epi32((int)phase, (int)(salad_uint32_type)(phase + step),
+        (int)(salad_uint32_type)(phase + step * 2U), (int)(salad_uint32_type)(phase + step * 3U));
+    salad_int32_type index[4];
+    __m128 a, b, frac;
+    ALsizei i;
+
+    /* SSE2 has no gathers, the lookups stay scalar */
+    for(i = 0; i + 4 <= count; i += 4) {
+        _mm_storeu_si128((__m128i *)index, _mm_srli_epi32(phases, OSC_SHIFT));
+        a = _mm_setr_ps(table[index[0]], table[index[1]], table[index[2]], table[index[3]]);
+        b = _mm_setr_ps(table[index[0] + 1], table[index[1] + 1], table[index[2] + 1], table[index[3] + 1]);
+        frac = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(phases, mask)), scale);
+        _mm_storeu_ps(&out[i], _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), frac)));
+        phases = _mm_add_epi32(phases, step4);
+    }
+
+    return render_table_c(&out[i], table, (salad_uint32_type)(phase + step * (salad_uint32_type)i), step, count - i);
+}
+
+/* SSE2 only multiplies the even 32-bit lanes, the odd
+ * ones are shifted down, multiplied and woven back in */
+#define SSE2_STEP(x) _mm_add_epi32(_mm_unpacklo_epi32(_mm_shuffle_epi32(_mm_mul_epu32((x), mul), 0x08), \
+    _mm_shuffle_epi32(_mm_mul_epu32(_mm_srli_epi64((x), 32), mul), 0x08)), add)
+
+static salad_uint32_type add_noise_sse2(ALfloat *out, ALsizei count, ALfloat gain, salad_uint32_type seed)
+{
+    const __m128i mul = _mm_set1_epi32((int)NOISE_MUL8);
+    const __m128i add = _mm_set1_epi32((int)NOISE_ADD8);
+    const __m128 scale = _mm_set1_ps(gain * NOISE_SCALE);
+    salad_uint32_type lanes[8];
+    __m128i low, high;
+    ALsizei i;
+
+    seed_lanes(lanes, 8, seed);
+    low = _mm_loadu_si128((const __m128i *)&lanes[0]);
+    high = _mm_loadu_si128((const __m128i *)&lanes[4]);
+
+    for(i = 0; i + 8 <= count; i += 8) {
+        _mm_storeu_ps(&out[i], _mm_add_ps(_mm_loadu_ps(&out[i]), _mm_mul_ps(_mm_cvtepi32_ps(low), scale)));
+        _mm_storeu_ps(&out[i + 4], _mm_add_ps(_mm_loadu_ps(&out[i + 4]), _mm_mul_ps(_mm_cvtepi32_ps(high), scale)));
+        low = SSE2_STEP(low);
+        high = SSE2_STEP(high);
+    }
+
+    return add_noise_c(&out[i], count - i, gain, (salad_uint32_type)_mm_cvtsi128_si32(low));
+}
+
+static const struct osc_kernels sse2_kernels = {
+    &render_table_sse2,
+    &add_noise_sse2
+};
+#endif
+
+#if defined(SALAD_SIMD_AVX2)
+SALAD_AVX2_TARGET static salad_uint32_type render_table_avx2(ALfloat *out, const ALfloat *table, salad_uint32_type phase, salad_uint32_type step, ALsizei count)
+{
+    const __m256i mask = _mm256_set1_epi32((int)OSC_MASK);
+    const __m256i step8 = _mm256_set1_epi32((int)(salad_uint32_type)(step * 8U));
+    const __m256 scale = _mm256_set1_ps(OSC_FRAC);
+    __m256i phases = _mm256_add_epi32(_mm256_set1_epi32((int)phase),
+        _mm256_mullo_epi32(_mm256_set1_epi32((int)step), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+    __m256i index;
+    __m256 a, b, frac;
+    ALsizei i;
+
+    for(i = 0; i + 8 <= count; i += 8) {
+        index = _mm256_srli_epi32(phases, OSC_SHIFT);
+        a = _mm256_i32gather_ps(table, index, 4);
+        b = _mm256_i32gather_ps(table + 1, index, 4);
+        frac = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(phases, mask)), scale);
+        _mm256_storeu_ps(&out[i], _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(b, a), frac)));
+        phases = _mm256_add_epi32(phases, step8);
+    }
+
+    return render_table_c(&out[i], table, (salad_uint32_type)(phase + step * (salad_uint32_type)i), step, count - i);
+}
+
+SALAD_AVX2_TARGET static salad_uint32_type add_noise_avx2(ALfloat *out, ALsizei count, ALfloat gain, salad_uint32_type seed)
+{
+    const __m256i mul = _mm256_set1_epi32((int)NOISE_MUL16);
+    const __m256i add = _mm256_set1_epi32((int)NOISE_ADD16);
+    const __m256 scale = _mm256_set1_ps(gain * NOISE_SCALE);
+    salad_uint32_type lanes[16];
+    __m256i low, high;
+    ALsizei i;
+
+    seed_lanes(lanes, 16, seed);
+    low = _mm256_loadu_si256((const __m256i *)&lanes[0]);
+    high = _mm256_loadu_si256((const __m256i *)&lanes[8]);
+
+    for(i = 0; i + 16 <= count; i += 16) {
+        _mm256_storeu_ps(&out[i], _mm256_add_ps(_mm256_loadu_ps(&out[i]), _mm256_mul_ps(_mm256_cvtepi32_ps(low), scale)));
+        _mm256_storeu_ps(&out[i + 8], _mm256_add_ps(_mm256_loadu_ps(&out[i + 8]), _mm256_mul_ps(_mm256_cvtepi32_ps(high), scale)));
+        low = _mm256_add_epi32(_mm256_mullo_epi32(low, mul), add);
+        high = _mm256_add_epi32(_mm256_mullo_epi32(high, mul), add);
+    }
+
+    return add_noise_c(&out[i], count - i, gain, (salad_uint32_type)_mm256_cvtsi256_si32(low));
+}
+
+static const struct osc_kernels avx2_kernels = {
+    &render_table_avx2,
+    &add_noise_avx2
+};
+#endif
+
+#if defined(SALAD_SIMD_NEON)
+static salad_uint32_type render_table_neon(ALfloat *out, const ALfloat *table, salad_uint32_type phase, salad_uint32_type step, ALsizei count)
+{
+    static const uint32_t lanes[4] = { 0, 1, 2, 3 };
+    const uint32x4_t mask = vdupq_n_u32((uint32_t)OSC_MASK);
+    const uint32x4_t step4 = vdupq_n_u32((uint32_t)(step * 4U));
+    uint32x4_t phases = vmlaq_n_u32(vdupq_n_u32(phase), vld1q_u32(lanes), step);
+    uint32_t index[4];
+    float32x4_t a, b, frac;
+    ALsizei i;
+
+    /* NEON has no gathers either */
+    for(i = 0; i + 4 <= count; i += 4) {
+        vst1q_u32(index, vshrq_n_u32(phases, OSC_SHIFT));
+        a = vsetq_lane_f32(table[index[0]], vdupq_n_f32(0.0f), 0);
+        a = vsetq_lane_f32(table[index[1]], a, 1);
+        a = vsetq_lane_f32(table[index[2]], a, 2);
+        a = vsetq_lane_f32(table[index[3]], a, 3);
+        b = vsetq_lane_f32(table[index[0] + 1], vdupq_n_f32(0.0f), 0);
+        b = vsetq_lane_f32(table[index[1] + 1], b, 1);
+        b = vsetq_lane_f32(table[index[2] + 1], b, 2);
+        b = vsetq_lane_f32(table[index[3] + 1], b, 3);
+        frac = vmulq_n_f32(vcvtq_f32_u32(vandq_u32(phases, mask)), OSC_FRAC);
+        vst1q_f32(&out[i], vaddq_f32(a, vmulq_f32(vsubq_f32(b, a), frac)));
+        phases = vaddq_u32(phases, step4);
+    }
+
+    return render_table_c(&out[i], table, (salad_uint32_type)(phase + step * (salad_uint32_type)i), step, count - i);
+}
+
+static salad_uint32_type add_noise_neon(ALfloat *out, ALsizei count, ALfloat gain, salad_uint32_type seed)
+{
+    const uint32x4_t add = vdupq_n_u32((uint32_t)NOISE_ADD8);
+    const ALfloat scale = gain * NOISE_SCALE;
+    salad_uint32_type lanes[8];
+    uint32x4_t low, high;
+    ALsizei i;
+
+    seed_lanes(lanes, 8, seed);
+    low = vld1q_u32(&lanes[0]);
+    high = vld1q_u32(&lanes[4]);
+
+    for(i = 0; i + 8 <= count; i += 8) {
+        vst1q_f32(&out[i], vaddq_f32(vld1q_f32(&out[i]), vmulq_n_f32(vcvtq_f32_s32(vreinterpretq_s32_u32(low)), scale)));
+        vst1q_f32(&out[i + 4], vaddq_f32(vld1q_f32(&out[i + 4]), vmulq_n_f32(vcvtq_f32_s32(vreinterpretq_s32_u32(high)), scale)));
+        low = vmlaq_n_u32(add, low, (uint32_t)NOISE_MUL8);
+        high = vmlaq_n_u32(add, high, (uint32_t)NOISE_MUL8);
+    }
+
+    return add_noise_c(&out[i], count - i, gain, (salad_uint32_type)vgetq_lane_u32(low, 0));
+}
+
+static const struct osc_kernels neon_kernels = {
+    &render_table_neon,
+    &add_noise_neon
+};
+#endif
+
+static const struct osc_kernels *get_kernels(void)
+{
+    switch(salad_simd_kernel()) {
+#if defined(SALAD_SIMD_AVX2)
+        case SALAD_CONVERT_AVX2:    return &avx2_kernels;
+#endif
+#if defined(SALAD_SIMD_SSE2)
+        case SALAD_CONVERT_SSE2:    return &sse2_kernels;
+#endif
+#if defined(SALAD_SIMD_NEON)
+        case SALAD_CONVERT_NEON:    return &neon_kernels;
+#endif
+    }
+
+    return &scalar_kernels;
+}
+
+/**
+ * Sums every harmonic below half the sample rate
+ * into the wavetable; the harmonics read the single
+ * sine period at multiples of the index so the table
+ * is built without calling sin again
+ * @param osc       Oscillator to rebuild
+ * @param audible   Number of harmonics to sum
+ */
+static void build_table(SALAD_oscillator_type *osc, ALsizei audible)
+{
+    ALfloat sum;
+    ALsizei i, j;
+
+    for(i = 0; i < OSC_TABLE; ++i) {
+        for(sum = 0.0f, j = 0; j < audible; ++j)
+            sum += osc->gains[j] * osc->sine[(i * (j + 1)) & (OSC_TABLE - 1)];
+        osc->table[i] = sum;
+    }
+
+    osc->table[OSC_TABLE] = osc->table[0];
+    osc->audible = audible;
+}
+
+static ALsizei count_audible(const SALAD_oscillator_type *osc)
+{
+    ALsizei audible = 0;
+
+    /* Without a pitch nothing moves, so nothing aliases either */
+    while(audible < osc->count && (osc->pitch <= 0.0f || osc->pitch * (ALfloat)(audible + 1) < (ALfloat)osc->frequency * 0.5f))
+        ++audible;
+    return audible;
+}
+
+SALAD_oscillator_type *saladCreateALoscillator(ALsizei frequency)
+{
+    SALAD_oscillator_type *osc;
+    ALsizei i;
+
+    if(frequency <= 0 || (osc = (SALAD_oscillator_type *)calloc(1, sizeof(SALAD_oscillator_type))) == NULL)
+        return NULL;
+
+    for(i = 0; i < OSC_TABLE; ++i)
+        osc->sine[i] = (ALfloat)sin(6.283185307179586 * (double)i / (double)OSC_TABLE);
+
+    osc->frequency = frequency;
+    osc->seed = 22222U;
+    return osc;
+}
+
+void saladDestroyALoscillator(SALAD_oscillator_type *osc)
+{
+    free(osc);
+}
+
+void saladSetALoscillatorPitch(SALAD_oscillator_type *osc, ALfloat pitch)
+{
+    ALsizei audible;
+
+    /* Anything at or above half the sample rate would alias */
+    if(!(pitch > 0.0f))
+        pitch = 0.0f;
+    if(pitch >= (ALfloat)osc->frequency * 0.5f)
+        pitch = (ALfloat)osc->frequency * 0.5f;
+
+    osc->pitch = pitch;
+    osc->step = (salad_uint32_type)((double)pitch / (double)osc->frequency * 4294967296.0 + 0.5);
+
+    if((audible = count_audible(osc)) != osc->audible)
+        build_table(osc, audible);
+}
+
+ALboolean saladSetALoscillatorHarmonics(SALAD_oscillator_type *osc, const ALfloat *gains, ALsizei count)
+{
+    if(count < 0 || count > SALAD_OSCILLATOR_HARMONICS)
+        return AL_FALSE;
+
+    if(count > 0)
+        memcpy(osc->gains, gains, sizeof(ALfloat) * (size_t)count);
+    osc->count = count;
+
+    build_table(osc, count_audible(osc));
+    return AL_TRUE;
+}
+
+void saladSetALoscillatorNoise(SALAD_oscillator_type *osc, ALfloat gain)
+{
+    osc->noise = gain;
+}
+
+void saladRenderALoscillator(SALAD_oscillator_type *osc, ALfloat *out, ALsizei count)
+{
+    const struct osc_kernels *kernels;
+
+    if(count <= 0)
+        return;
+
+    kernels = get_kernels();
+    if(osc->audible == 0) {
+        memset(out, 0, sizeof(ALfloat) * (size_t)count);
+        osc->phase = (salad_uint32_type)(osc->phase + osc->step * (salad_uint32_type)count);
+    }
+    else osc->phase = kernels->render_table(out, osc->table, osc->phase, osc->step, count);
+
+    if(osc->noise != 0.0f)
+        osc->seed = kernels->add_noise(out, count, osc->noise, osc->seed);
+}
+
+void saladRenderALoscillatorShort(SALAD_oscillator_type *osc, ALshort *out, ALsizei count)
+{
+    ALfloat block[OSC_BLOCK];
+    ALsizei size;
+
+    while(count > 0) {
+        size = (count < OSC_BLOCK) ? count : OSC_BLOCK;
+        saladRenderALoscillator(osc, block, size);
+        saladConvertALfloatToShort(out, block, size);
+        out += size;
+        count -= size;
+    }
+}
+
+ALsizei SALAD_APIENTRY saladPullALoscillator(void *data, ALsizei size, void *arg)
+{
+    ALsizei count = size / (ALsizei)sizeof(ALshort);
+
+    saladRenderALoscillatorShort((SALAD_oscillator_type *)arg, (ALshort *)data, count);
+    return count * (ALsizei)sizeof(ALshort);
+}
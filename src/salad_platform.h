@@ -0,0 +1,141 @@
+/*
+ * salad_platform.h - platform abstraction used by the implementation
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef SALAD_PLATFORM_H
+#define SALAD_PLATFORM_H 1
+
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+#define SALAD_POSIX 1
+#define SALAD_WIN32 0
+#elif defined(_WIN32)
+#define SALAD_POSIX 0
+#define SALAD_WIN32 1
+#endif
+
+#if SALAD_POSIX
+#include <dlfcn.h>
+#include <pthread.h>
+#define salad_load_library(library)     dlopen((library), RTLD_LAZY)
+#define salad_close_library(handle)     ((void)dlclose((handle)))
+#define salad_get_proc(handle, proc)    dlsym((handle), (proc))
+#elif SALAD_WIN32
+#define WIN32_LEAN_AND_MEAN 1
+#include <windows.h>
+#define salad_load_library(library)     ((void *)LoadLibraryA((library)))
+#define salad_close_library(handle)     ((void)FreeLibrary((HMODULE)(handle)))
+#define salad_get_proc(handle, proc)    ((void *)GetProcAddress((HMODULE)(handle), (proc)))
+#endif
+
+/* Atomic loads use acquire ordering and atomic stores use
+ * release ordering; everything written before a store is visible
+ * to a thread that observes the stored value with a load.
+ * salad_atomic_cas_ptr replaces a pointer only if it still holds
+ * the expected value, is fully ordered and is non-zero on success */
+#if defined(__GNUC__) || defined(__clang__)
+#define salad_atomic_load_int(pointer)          __atomic_load_n((pointer), __ATOMIC_ACQUIRE)
+#define salad_atomic_store_int(pointer, value)  __atomic_store_n((pointer), (value), __ATOMIC_RELEASE)
+#define salad_atomic_store_ptr(pointer, value)  __atomic_store_n((pointer), (value), __ATOMIC_RELEASE)
+#define salad_atomic_load_ptr(pointer)          __atomic_load_n((pointer), __ATOMIC_ACQUIRE)
+#define salad_atomic_cas_ptr(pointer, expected, desired) __sync_bool_compare_and_swap((pointer), (expected), (desired))
+#elif defined(_MSC_VER)
+#define salad_atomic_load_int(pointer)          ((int)InterlockedCompareExchange((LONG volatile *)(pointer), 0, 0))
+#define salad_atomic_store_int(pointer, value)  ((void)InterlockedExchange((LONG volatile *)(pointer), (LONG)(value)))
+#define salad_atomic_store_ptr(pointer, value)  ((void)InterlockedExchangePointer((PVOID volatile *)(pointer), (PVOID)(value)))
+#define salad_atomic_load_ptr(pointer)          InterlockedCompareExchangePointer((PVOID volatile *)(pointer), NULL, NULL)
+#define salad_atomic_cas_ptr(pointer, expected, desired) (InterlockedCompareExchangePointer((PVOID volatile *)(pointer), (PVOID)(desired), (PVOID)(expected)) == (PVOID)(expected))
+#else
+#define salad_atomic_load_int(pointer)          (*(volatile int *)(pointer))
+#define salad_atomic_store_int(pointer, value)  ((void)(*(volatile int *)(pointer) = (value)))
+#define salad_atomic_store_ptr(pointer, value)  ((void)(*(pointer) = (value)))
+#define salad_atomic_load_ptr(pointer)          (*(pointer))
+#define salad_atomic_cas_ptr(pointer, expected, desired) ((*(pointer) == (expected)) ? ((*(pointer) = (desired)), 1) : 0)
+#endif
+
+/* Symbols shared between the translation units of salad
+ * stay out of the dynamic symbol table of whatever salad
+ * ends up linked into */
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_WIN32)
+#define SALAD_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define SALAD_HIDDEN
+#endif
+
+#if defined(_MSC_VER)
+#define SALAD_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#define SALAD_THREAD_LOCAL __thread
+#endif
+
+#if SALAD_POSIX
+typedef pthread_mutex_t salad_mutex_type;
+#define SALAD_MUTEX_INIT                PTHREAD_MUTEX_INITIALIZER
+#define salad_mutex_lock(mutex)         ((void)pthread_mutex_lock((mutex)))
+#define salad_mutex_unlock(mutex)       ((void)pthread_mutex_unlock((mutex)))
+#define salad_mutex_init(mutex)         ((void)pthread_mutex_init((mutex), NULL))
+#define salad_mutex_destroy(mutex)      ((void)pthread_mutex_destroy((mutex)))
+#elif SALAD_WIN32
+typedef SRWLOCK salad_mutex_type;
+#define SALAD_MUTEX_INIT                SRWLOCK_INIT
+#define salad_mutex_lock(mutex)         AcquireSRWLockExclusive((mutex))
+#define salad_mutex_unlock(mutex)       ReleaseSRWLockExclusive((mutex))
+#define salad_mutex_init(mutex)         InitializeSRWLock((mutex))
+#define salad_mutex_destroy(mutex)      ((void)(mutex))
+#endif
+
+/* Condition variables always wait on a salad_mutex_type;
+ * waits with a timeout differ too much to be wrapped here */
+#if SALAD_POSIX
+typedef pthread_cond_t salad_cond_type;
+#define salad_cond_init(cond)           ((void)pthread_cond_init((cond), NULL))
+#define salad_cond_destroy(cond)        ((void)pthread_cond_destroy((cond)))
+#define salad_cond_wait(cond, mutex)    ((void)pthread_cond_wait((cond), (mutex)))
+#define salad_cond_signal(cond)         ((void)pthread_cond_signal((cond)))
+#define salad_cond_broadcast(cond)      ((void)pthread_cond_broadcast((cond)))
+#elif SALAD_WIN32
+typedef CONDITION_VARIABLE salad_cond_type;
+#define salad_cond_init(cond)           InitializeConditionVariable((cond))
+#define salad_cond_destroy(cond)        ((void)(cond))
+#define salad_cond_wait(cond, mutex)    ((void)SleepConditionVariableSRW((cond), (mutex), INFINITE, 0))
+#define salad_cond_signal(cond)         WakeConditionVariable((cond))
+#define salad_cond_broadcast(cond)      WakeAllConditionVariable((cond))
+#endif
+
+/* Thread functions are declared as
+ * salad_thread_result_type SALAD_THREAD_APIENTRY proc(void *arg) */
+#if SALAD_POSIX
+typedef pthread_t salad_thread_type;
+typedef void *salad_thread_result_type;
+#define SALAD_THREAD_APIENTRY
+#define salad_thread_create(thread, proc, arg)  (pthread_create((thread), NULL, (proc), (arg)) == 0)
+#define salad_thread_join(thread)               ((void)pthread_join((thread), NULL))
+#elif SALAD_WIN32
+typedef HANDLE salad_thread_type;
+typedef DWORD salad_thread_result_type;
+#define SALAD_THREAD_APIENTRY WINAPI
+#define salad_thread_create(thread, proc, arg)  ((*(thread) = CreateThread(NULL, 0, (proc), (arg), 0, NULL)) != NULL)
+#define salad_thread_join(thread)               ((void)WaitForSingleObject((thread), INFINITE), (void)CloseHandle((thread)))
+#endif
+
+#endif /* SALAD_PLATFORM_H */
@@ -0,0 +1,823 @@
+/*
+ * salad_pool.c - Source pool with virtual voices
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <AL/salad_pool.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <AL/alc.h>
+#include <AL/salad_table.h>
+
+/* A voice name is a slot index plus one in
+ * the low bits and the slot generation above them */
+#define POOL_INDEX_BITS     20
+#define POOL_INDEX_MASK     ((1UL << POOL_INDEX_BITS) - 1UL)
+#define POOL_GENERATIONS    (1UL << (32 - POOL_INDEX_BITS))
+#define POOL_MAX_VOICES     ((ALsizei)POOL_INDEX_MASK)
+
+/* Parameters a voice has to push
+ * to its real source on the next update */
+#define DIRTY_GAIN          0x01
+#define DIRTY_PITCH         0x02
+#define DIRTY_DISTANCE      0x04
+#define DIRTY_POSITION      0x08
+#define DIRTY_VELOCITY      0x10
+#define DIRTY_FLAGS         0x20
+
+/* The functions a pool calls, read once per call so that the
+ * global pointers are picked up again after switching drivers */
+struct pool_procs {
+    PFN_alGenSources alGenSources;
+    PFN_alDeleteSources alDeleteSources;
+    PFN_alGetError alGetError;
+    PFN_alSourcei alSourcei;
+    PFN_alSourcef alSourcef;
+    PFN_alSource3f alSource3f;
+    PFN_alGetSourcei alGetSourcei;
+    PFN_alSourcePlay alSourcePlay;
+    PFN_alSourceStop alSourceStop;
+    PFN_alGetListenerfv alGetListenerfv;
+    PFN_alGetBufferi alGetBufferi;
+    PFN_alcGetCurrentContext alcGetCurrentContext;
+    PFN_alcGetContextsDevice alcGetContextsDevice;
+    PFN_alcGetIntegerv alcGetIntegerv;
+};
+
+struct pool_voice {
+    SALAD_voice_type name;
+    ALuint buffer;
+    ALint looping;
+    ALint relative;
+    ALfloat gain;
+    ALfloat pitch;
+    ALfloat reference;
+    ALfloat rolloff;
+    ALfloat max_distance;
+    ALfloat priority;
+    ALfloat position[3];
+    ALfloat velocity[3];
+    ALint frequency;            /* Of the buffer */
+    ALint frames;               /* Of the buffer */
+    ALdouble offset;            /* Playback position in frames without a real source */
+    ALfloat score;              /* Priority times audibility of the last update */
+    ALsizei source;             /* Real source index, -1 for none */
+    int playing;
+    int dirty;
+};
+
+/* A slot maps a voice name to the voice, which may move
+ * within the voice array; free slots form a linked list */
+struct pool_slot {
+    unsigned long generation;
+    ALsizei voice;              /* Voice index, -1 while free */
+    ALsizei next;               /* Next free slot, -1 for none */
+};
+
+struct SALAD_pool {
+    const SALAD_table_type *table;
+    ALuint *sources;
+    ALsizei num_sources;
+    ALsizei *free_sources;
+    ALsizei num_free;
+    struct pool_voice *voices;
+    ALsizei *order;
+    ALsizei num_voices;
+    struct pool_slot *slots;
+    ALsizei num_slots;
+    ALsizei max_slots;
+    ALsizei free_slot;
+    unsigned long binds;
+    unsigned long culls;
+};
+
+static void get_procs(const SALAD_pool_type *pool, struct pool_procs *procs)
+{
+    const SALAD_table_type *table = pool->table;
+
+    if(table != NULL) {
+        procs->alGenSources = table->alGenSources;
+        procs->alDeleteSources = table->alDeleteSources;
+        procs->alGetError = table->alGetError;
+        procs->alSourcei = table->alSourcei;
+        procs->alSourcef = table->alSourcef;
+        procs->alSource3f = table->alSource3f;
+        procs->alGetSourcei = table->alGetSourcei;
+        procs->alSourcePlay = table->alSourcePlay;
+        procs->alSourceStop = table->alSourceStop;
+        procs->alGetListenerfv = table->alGetListenerfv;
+        procs->alGetBufferi = table->alGetBufferi;
+        procs->alcGetCurrentContext = table->alcGetCurrentContext;
+        procs->alcGetContextsDevice = table->alcGetContextsDevice;
+        procs->alcGetIntegerv = table->alcGetIntegerv;
+        return;
+    }
+
+#if defined(SALAD_DIRECT_LINK)
+    procs->alGenSources = &alGenSources;
+    procs->alDeleteSources = &alDeleteSources;
+    procs->alGetError = &alGetError;
+    procs->alSourcei = &alSourcei;
+    procs->alSourcef = &alSourcef;
+    procs->alSource3f = &alSource3f;
+    procs->alGetSourcei = &alGetSourcei;
+    procs->alSourcePlay = &alSourcePlay;
+    procs->alSourceStop = &alSourceStop;
+    procs->alGetListenerfv = &alGetListenerfv;
+    procs->alGetBufferi = &alGetBufferi;
+    procs->alcGetCurrentContext = &alcGetCurrentContext;
+    procs->alcGetContextsDevice = &alcGetContextsDevice;
+    procs->alcGetIntegerv = &alcGetIntegerv;
+#else
+    procs->alGenSources = SALAD_alGenSources;
+    procs->alDeleteSources = SALAD_alDeleteSources;
+    procs->alGetError = SALAD_alGetError;
+    procs->alSourcei = SALAD_alSourcei;
+    procs->alSourcef = SALAD_alSourcef;
+    procs->alSource3f = SALAD_alSource3f;
+    procs->alGetSourcei = SALAD_alGetSourcei;
+    procs->alSourcePlay = SALAD_alSourcePlay;
+    procs->alSourceStop = SALAD_alSourceStop;
+    procs->alGetListenerfv = SALAD_alGetListenerfv;
+    procs->alGetBufferi = SALAD_alGetBufferi;
+    procs->alcGetCurrentContext = SALAD_alcGetCurrentContext;
+    procs->alcGetContextsDevice = SALAD_alcGetContextsDevice;
+    procs->alcGetIntegerv = SALAD_alcGetIntegerv;
+#endif
+}
+
+static int check_procs(const struct pool_procs *procs)
+{
+    return procs->alGenSources != NULL && procs->alDeleteSources != NULL && procs->alGetError != NULL
+        && procs->alSourcei != NULL && procs->alSourcef != NULL && procs->alSource3f != NULL
+        && procs->alGetSourcei != NULL && procs->alSourcePlay != NULL && procs->alSourceStop != NULL
+        && procs->alGetListenerfv != NULL && procs->alGetBufferi != NULL && procs->alcGetCurrentContext != NULL
+        && procs->alcGetContextsDevice != NULL && procs->alcGetIntegerv != NULL;
+}
+
+static struct pool_voice *find_voice(const SALAD_pool_type *pool, SALAD_voice_type name)
+{
+    const struct pool_slot *slot;
+    ALsizei index = (ALsizei)(name & POOL_INDEX_MASK) - 1;
+
+    if(pool == NULL || index < 0 || index >= pool->num_slots)
+        return NULL;
+
+    slot = &pool->slots[index];
+    if(slot->voice < 0 || slot->generation != (unsigned long)(name >> POOL_INDEX_BITS))
+        return NULL;
+    return &pool->voices[slot->voice];
+}
+
+static void set_default_voice(struct pool_voice *voice, SALAD_voice_type name)
+{
+    voice->name = name;
+    voice->buffer = 0;
+    voice->looping = AL_FALSE;
+    voice->relative = AL_FALSE;
+    voice->gain = 1.0f;
+    voice->pitch = 1.0f;
+    voice->reference = 1.0f;
+    voice->rolloff = 1.0f;
+    voice->max_distance = FLT_MAX;
+    voice->priority = 1.0f;
+    voice->position[0] = voice->position[1] = voice->position[2] = 0.0f;
+    voice->velocity[0] = voice->velocity[1] = voice->velocity[2] = 0.0f;
+    voice->frequency = 0;
+    voice->frames = 0;
+    voice->offset = 0.0;
+    voice->score = 0.0f;
+    voice->source = -1;
+    voice->playing = 0;
+    voice->dirty = 0;
+}
+
+/**
+ * Gives a voice a free real source with all of its
+ * parameters and starts it where the voice is at
+ * @param pool      Pool the voice belongs to
+ * @param procs     Functions to call
+ * @param voice     Voice without a real source
+ */
+static void bind_voice(SALAD_pool_type *pool, const struct pool_procs *procs, struct pool_voice *voice)
+{
+    ALuint source;
+
+    voice->source = pool->free_sources[--pool->num_free];
+    voice->dirty = 0;
+    source = pool->sources[voice->source];
+
+    procs->alSourcei(source, AL_BUFFER, (ALint)voice->buffer);
+    procs->alSourcei(source, AL_LOOPING, voice->looping);
+    procs->alSourcei(source, AL_SOURCE_RELATIVE, voice->relative);
+    procs->alSourcef(source, AL_GAIN, voice->gain);
+    procs->alSourcef(source, AL_PITCH, voice->pitch);
+    procs->alSourcef(source, AL_REFERENCE_DISTANCE, voice->reference);
+    procs->alSourcef(source, AL_ROLLOFF_FACTOR, voice->rolloff);
+    procs->alSourcef(source, AL_MAX_DISTANCE, voice->max_distance);
+    procs->alSource3f(source, AL_POSITION, voice->position[0], voice->position[1], voice->position[2]);
+    procs->alSource3f(source, AL_VELOCITY, voice->velocity[0], voice->velocity[1], voice->velocity[2]);
+    procs->alSourcei(source, AL_SAMPLE_OFFSET, (ALint)voice->offset);
+    procs->alSourcePlay(source);
+
+    pool->binds++;
+}
+
+/**
+ * Takes the real source away from a voice,
+ * keeping the playback position if it's still playing
+ * @param pool      Pool the voice belongs to
+ * @param procs     Functions to call
+ * @param voice     Voice with a real source
+ */
+static void unbind_voice(SALAD_pool_type *pool, const struct pool_procs *procs, struct pool_voice *voice)
+{
+    ALuint source = pool->sources[voice->source];
+    ALint offset = 0;
+
+    if(voice->playing) {
+        procs->alGetSourcei(source, AL_SAMPLE_OFFSET, &offset);
+        voice->offset = (ALdouble)offset;
+        pool->culls++;
+    }
+
+    procs->alSourceStop(source);
+    procs->alSourcei(source, AL_BUFFER, 0);
+
+    pool->free_sources[pool->num_free++] = voice->source;
+    voice->source = -1;
+}
+
+static void push_voice(const SALAD_pool_type *pool, const struct pool_procs *procs, struct pool_voice *voice)
+{
+    ALuint source = pool->sources[voice->source];
+
+    if(voice->dirty & DIRTY_GAIN)
+        procs->alSourcef(source, AL_GAIN, voice->gain);
+    if(voice->dirty & DIRTY_PITCH)
+        procs->alSourcef(source, AL_PITCH, voice->pitch);
+    if(voice->dirty & DIRTY_DISTANCE) {
+        procs->alSourcef(source, AL_REFERENCE_DISTANCE, voice->reference);
+        procs->alSourcef(source, AL_ROLLOFF_FACTOR, voice->rolloff);
+        procs->alSourcef(source, AL_MAX_DISTANCE, voice->max_distance);
+    }
+    if(voice->dirty & DIRTY_POSITION)
+        procs->alSource3f(source, AL_POSITION, voice->position[0], voice->position[1], voice->position[2]);
+    if(voice->dirty & DIRTY_VELOCITY)
+        procs->alSource3f(source, AL_VELOCITY, voice->velocity[0], voice->velocity[1], voice->velocity[2]);
+    if(voice->dirty & DIRTY_FLAGS) {
+        procs->alSourcei(source, AL_LOOPING, voice->looping);
+        procs->alSourcei(source, AL_SOURCE_RELATIVE, voice->relative);
+    }
+
+    voice->dirty = 0;
+}
+
+/**
+ * Moves a voice without a real source on by
+ * the time that has passed, the way the driver would
+ * @param voice     Playing voice without a real source
+ * @param seconds   Time since the previous update
+ */
+static void advance_voice(struct pool_voice *voice, ALfloat seconds)
+{
+    voice->offset += (ALdouble)seconds * voice->frequency * voice->pitch;
+
+    if(voice->offset < (ALdouble)voice->frames)
+        return;
+
+    if(voice->looping && voice->frames > 0) {
+        voice->offset = fmod(voice->offset, (ALdouble)voice->frames);
+        return;
+    }
+
+    voice->offset = 0.0;
+    voice->playing = 0;
+}
+
+/**
+ * Works out how much a voice matters, using the
+ * inverse distance clamped model OpenAL defaults to
+ * @param voice     Playing voice
+ * @param listener  Listener position
+ * @returns         Priority times the attenuated gain
+ */
+static ALfloat score_voice(const struct pool_voice *voice, const ALfloat *listener)
+{
+    ALfloat dx = voice->position[0];
+    ALfloat dy = voice->position[1];
+    ALfloat dz = voice->position[2];
+    ALfloat distance, divisor;
+
+    if(!voice->relative) {
+        dx -= listener[0];
+        dy -= listener[1];
+        dz -= listener[2];
+    }
+
+    distance = (ALfloat)sqrt(dx * dx + dy * dy + dz * dz);
+    if(distance < voice->reference)
+        distance = voice->reference;
+    if(distance > voice->max_distance)
+        distance = voice->max_distance;
+
+    divisor = voice->reference + voice->rolloff * (distance - voice->reference);
+    if(divisor <= 0.0f)
+        return voice->priority * voice->gain;
+    return voice->priority * voice->gain * voice->reference / divisor;
+}
+
+/* Voices that already have a real source win a tie, so
+ * equally important voices don't keep swapping sources */
+static int is_better(const struct pool_voice *a, const struct pool_voice *b)
+{
+    if(a->score != b->score)
+        return a->score > b->score;
+    return a->source >= 0 && b->source < 0;
+}
+
+/**
+ * Partially sorts voice indices so that the best
+ * count of them come first, in no particular order
+ * @param voices    Voices the indices refer to
+ * @param order     Voice indices
+ * @param size      Number of indices
+ * @param count     Number of the best ones to put first
+ */
+static void select_voices(const struct pool_voice *voices, ALsizei *order, ALsizei size, ALsizei count)
+{
+    ALsizei first = 0;
+    ALsizei last = size - 1;
+    ALsizei i, j, pivot, swap;
+
+    while(first < last) {
+        pivot = order[first + (last - first) / 2];
+        i = first;
+        j = last;
+
+        while(i <= j) {
+            while(is_better(&voices[order[i]], &voices[pivot]))
+                ++i;
+            while(is_better(&voices[pivot], &voices[order[j]]))
+                --j;
+            if(i <= j) {
+                swap = order[i];
+                order[i++] = order[j];
+                order[j--] = swap;
+            }
+        }
+
+        if(count <= j)
+            last = j;
+        else if(count >= i)
+            first = i;
+        else break;
+    }
+}
+
+/**
+ * Makes sure there's room for one more voice
+ * @param pool      Pool to grow
+ * @returns         Zero if out of memory
+ */
+static int reserve_voice(SALAD_pool_type *pool)
+{
+    struct pool_voice *voices;
+    struct pool_slot *slots;
+    ALsizei *order;
+    ALsizei size;
+
+    if(pool->num_voices < pool->max_slots)
+        return 1;
+
+    if(pool->max_slots >= POOL_MAX_VOICES)
+        return 0;
+
+    size = (pool->max_slots != 0) ? pool->max_slots * 2 : 64;
+    if(size > POOL_MAX_VOICES)
+        size = POOL_MAX_VOICES;
+
+    if((voices = (struct pool_voice *)realloc(pool->voices, (size_t)size * sizeof(struct pool_voice))) == NULL)
+        return 0;
+    pool->voices = voices;
+
+    if((order = (ALsizei *)realloc(pool->order, (size_t)size * sizeof(ALsizei))) == NULL)
+        return 0;
+    pool->order = order;
+
+    if((slots = (struct pool_slot *)realloc(pool->slots, (size_t)size * sizeof(struct pool_slot))) == NULL)
+        return 0;
+    pool->slots = slots;
+
+    pool->max_slots = size;
+    return 1;
+}
+
+static SALAD_pool_type *create_pool(const SALAD_table_type *table, ALsizei max_sources)
+{
+    SALAD_pool_type *pool;
+    struct pool_procs procs;
+    ALCcontext *context;
+    ALCint mono = 0;
+    ALuint source;
+
+    if((pool = (SALAD_pool_type *)calloc(1, sizeof(SALAD_pool_type))) == NULL)
+        return NULL;
+
+    pool->table = table;
+    pool->free_slot = -1;
+
+    get_procs(pool, &procs);
+    if(!check_procs(&procs) || (context = procs.alcGetCurrentContext()) == NULL) {
+        free(pool);
+        return NULL;
+    }
+
+    if(max_sources <= 0) {
+        procs.alcGetIntegerv(procs.alcGetContextsDevice(context), ALC_MONO_SOURCES, 1, &mono);
+        max_sources = (mono > 0) ? (ALsizei)mono : 256;
+    }
+
+    pool->sources = (ALuint *)malloc((size_t)max_sources * sizeof(ALuint));
+    pool->free_sources = (ALsizei *)malloc((size_t)max_sources * sizeof(ALsizei));
+    if(pool->sources == NULL || pool->free_sources == NULL) {
+        saladDestroyALpool(pool);
+        return NULL;
+    }
+
+    /* Drivers report the limit loosely if at all,
+     * so sources are generated until one fails */
+    procs.alGetError();
+    while(pool->num_sources < max_sources) {
+        source = 0;
+        procs.alGenSources(1, &source);
+        if(procs.alGetError() != AL_NO_ERROR || source == 0)
+            break;
+        pool->free_sources[pool->num_sources] = pool->num_sources;
+        pool->sources[pool->num_sources++] = source;
+    }
+
+    if(pool->num_sources == 0) {
+        saladDestroyALpool(pool);
+        return NULL;
+    }
+
+    pool->num_free = pool->num_sources;
+    return pool;
+}
+
+SALAD_pool_type *saladCreateALpool(ALsizei max_sources)
+{
+    return create_pool(NULL, max_sources);
+}
+
+SALAD_pool_type *saladCreateALtablePool(const SALAD_table_type *table, ALsizei max_sources)
+{
+    if(table == NULL)
+        return NULL;
+    return create_pool(table, max_sources);
+}
+
+void saladDestroyALpool(SALAD_pool_type *pool)
+{
+    struct pool_procs procs;
+
+    if(pool == NULL)
+        return;
+
+    get_procs(pool, &procs);
+    if(pool->num_sources != 0 && procs.alDeleteSources != NULL && procs.alSourceStop != NULL) {
+        while(pool->num_voices != 0) {
+            if(pool->voices[--pool->num_voices].source >= 0)
+                procs.alSourceStop(pool->sources[pool->voices[pool->num_voices].source]);
+        }
+
+        procs.alDeleteSources(pool->num_sources, pool->sources);
+    }
+
+    free(pool->sources);
+    free(pool->free_sources);
+    free(pool->voices);
+    free(pool->order);
+    free(pool->slots);
+    free(pool);
+}
+
+ALsizei saladGetALpoolSources(const SALAD_pool_type *pool)
+{
+    return (pool != NULL) ? pool->num_sources : 0;
+}
+
+SALAD_voice_type saladCreateALvoice(SALAD_pool_type *pool)
+{
+    struct pool_slot *slot;
+    ALsizei index;
+
+    if(pool == NULL || !reserve_voice(pool))
+        return 0;
+
+    if(pool->free_slot >= 0) {
+        index = pool->free_slot;
+        pool->free_slot = pool->slots[index].next;
+    }
+    else {
+        index = pool->num_slots++;
+        pool->slots[index].generation = 0;
+    }
+
+    slot = &pool->slots[index];
+    slot->voice = pool->num_voices++;
+    slot->next = -1;
+
+    set_default_voice(&pool->voices[slot->voice], (SALAD_voice_type)((slot->generation << POOL_INDEX_BITS) | (unsigned long)(index + 1)));
+    return pool->voices[slot->voice].name;
+}
+
+void saladDeleteALvoice(SALAD_pool_type *pool, SALAD_voice_type voice)
+{
+    struct pool_voice *state = find_voice(pool, voice);
+    struct pool_procs procs;
+    struct pool_slot *slot;
+    ALsizei index;
+
+    if(state == NULL)
+        return;
+
+    if(state->source >= 0) {
+        get_procs(pool, &procs);
+        state->playing = 0;
+        unbind_voice(pool, &procs, state);
+    }
+
+    /* The last voice takes the place of the deleted
+     * one so that the voice array stays contiguous */
+    index = (ALsizei)(voice & POOL_INDEX_MASK) - 1;
+    slot = &pool->slots[index];
+    if(slot->voice != --pool->num_voices) {
+        pool->voices[slot->voice] = pool->voices[pool->num_voices];
+        pool->slots[(pool->voices[slot->voice].name & POOL_INDEX_MASK) - 1].voice = slot->voice;
+    }
+
+    slot->generation = (slot->generation + 1UL) % POOL_GENERATIONS;
+    slot->voice = -1;
+    slot->next = pool->free_slot;
+    pool->free_slot = index;
+}
+
+int saladSetALvoicef(SALAD_pool_type *pool, SALAD_voice_type voice, ALenum param, ALfloat value)
+{
+    struct pool_voice *state = find_voice(pool, voice);
+
+    if(state == NULL || !(value >= 0.0f))
+        return 0;
+
+    switch(param) {
+        case AL_GAIN:
+            state->gain = value;
+            state->dirty |= DIRTY_GAIN;
+            return 1;
+        case AL_PITCH:
+            state->pitch = value;
+            state->dirty |= DIRTY_PITCH;
+            return 1;
+        case AL_REFERENCE_DISTANCE:
+            state->reference = value;
+            state->dirty |= DIRTY_DISTANCE;
+            return 1;
+        case AL_ROLLOFF_FACTOR:
+            state->rolloff = value;
+            state->dirty |= DIRTY_DISTANCE;
+            return 1;
+        case AL_MAX_DISTANCE:
+            state->max_distance = value;
+            state->dirty |= DIRTY_DISTANCE;
+            return 1;
+        case SALAD_PRIORITY:
+            state->priority = value;
+            return 1;
+    }
+
+    return 0;
+}
+
+int saladSetALvoice3f(SALAD_pool_type *pool, SALAD_voice_type voice, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
+{
+    struct pool_voice *state = find_voice(pool, voice);
+    ALfloat *values;
+
+    if(state == NULL)
+        return 0;
+
+    switch(param) {
+        case AL_POSITION:
+            values = state->position;
+            state->dirty |= DIRTY_POSITION;
+            break;
+        case AL_VELOCITY:
+            values = state->velocity;
+            state->dirty |= DIRTY_VELOCITY;
+            break;
+        default:
+            return 0;
+    }
+
+    values[0] = value1;
+    values[1] = value2;
+    values[2] = value3;
+    return 1;
+}
+
+int saladSetALvoicei(SALAD_pool_type *pool, SALAD_voice_type voice, ALenum param, ALint value)
+{
+    struct pool_voice *state = find_voice(pool, voice);
+    struct pool_procs procs;
+    ALint frequency = 0, size = 0, bits = 0, channels = 0;
+
+    if(state == NULL)
+        return 0;
+
+    switch(param) {
+        case AL_LOOPING:
+            state->looping = (value != AL_FALSE) ? AL_TRUE : AL_FALSE;
+            state->dirty |= DIRTY_FLAGS;
+            return 1;
+        case AL_SOURCE_RELATIVE:
+            state->relative = (value != AL_FALSE) ? AL_TRUE : AL_FALSE;
+            state->dirty |= DIRTY_FLAGS;
+            return 1;
+        case AL_BUFFER:
+            break;
+        default:
+            return 0;
+    }
+
+    get_procs(pool, &procs);
+    if(procs.alGetBufferi == NULL)
+        return 0;
+
+    /* The length of the buffer is what moves a voice
+     * on while it has no real source to play on */
+    if(value != 0) {
+        procs.alGetError();
+        procs.alGetBufferi((ALuint)value, AL_FREQUENCY, &frequency);
+        procs.alGetBufferi((ALuint)value, AL_SIZE, &size);
+        procs.alGetBufferi((ALuint)value, AL_BITS, &bits);
+        procs.alGetBufferi((ALuint)value, AL_CHANNELS, &channels);
+        if(procs.alGetError() != AL_NO_ERROR)
+            return 0;
+    }
+
+    saladStopALvoice(pool, voice);
+    state->buffer = (ALuint)value;
+    state->frequency = frequency;
+    state->frames = (bits >= 8 && channels > 0) ? size / (bits / 8 * channels) : 0;
+    return 1;
+}
+
+int saladPlayALvoice(SALAD_pool_type *pool, SALAD_voice_type voice)
+{
+    struct pool_voice *state = find_voice(pool, voice);
+    struct pool_procs procs;
+
+    if(state == NULL || state->buffer == 0)
+        return 0;
+
+    state->playing = 1;
+    state->offset = 0.0;
+
+    /* Playing a playing source restarts it */
+    if(state->source >= 0) {
+        get_procs(pool, &procs);
+        push_voice(pool, &procs, state);
+        procs.alSourcePlay(pool->sources[state->source]);
+    }
+
+    return 1;
+}
+
+void saladStopALvoice(SALAD_pool_type *pool, SALAD_voice_type voice)
+{
+    struct pool_voice *state = find_voice(pool, voice);
+    struct pool_procs procs;
+
+    if(state == NULL)
+        return;
+
+    state->playing = 0;
+    state->offset = 0.0;
+
+    if(state->source >= 0) {
+        get_procs(pool, &procs);
+        unbind_voice(pool, &procs, state);
+    }
+}
+
+ALboolean saladIsALvoicePlaying(const SALAD_pool_type *pool, SALAD_voice_type voice)
+{
+    const struct pool_voice *state = find_voice(pool, voice);
+    return (state != NULL && state->playing) ? AL_TRUE : AL_FALSE;
+}
+
+void saladUpdateALpool(SALAD_pool_type *pool, ALfloat seconds)
+{
+    ALfloat listener[3] = { 0.0f, 0.0f, 0.0f };
+    struct pool_procs procs;
+    struct pool_voice *voice;
+    ALsizei count = 0;
+    ALsizei i;
+    ALint state;
+
+    if(pool == NULL)
+        return;
+
+    get_procs(pool, &procs);
+    if(!check_procs(&procs))
+        return;
+
+    procs.alGetListenerfv(AL_POSITION, listener);
+
+    for(i = 0; i < pool->num_voices; ++i) {
+        voice = &pool->voices[i];
+
+        if(voice->source >= 0) {
+            state = AL_STOPPED;
+            procs.alGetSourcei(pool->sources[voice->source], AL_SOURCE_STATE, &state);
+            if(state == AL_STOPPED || state == AL_INITIAL) {
+                voice->playing = 0;
+                voice->offset = 0.0;
+                unbind_voice(pool, &procs, voice);
+            }
+        }
+        else if(voice->playing) {
+            advance_voice(voice, seconds);
+        }
+
+        if(!voice->playing)
+            continue;
+
+        /* Voices nobody can hear never hold a real source */
+        voice->score = score_voice(voice, listener);
+        if(voice->score > 0.0f)
+            pool->order[count++] = i;
+        else if(voice->source >= 0)
+            unbind_voice(pool, &procs, voice);
+    }
+
+    if(count > pool->num_sources) {
+        select_voices(pool->voices, pool->order, count, pool->num_sources);
+
+        for(i = pool->num_sources; i < count; ++i) {
+            voice = &pool->voices[pool->order[i]];
+            if(voice->source >= 0)
+                unbind_voice(pool, &procs, voice);
+        }
+
+        count = pool->num_sources;
+    }
+
+    for(i = 0; i < count; ++i) {
+        voice = &pool->voices[pool->order[i]];
+        if(voice->source < 0)
+            bind_voice(pool, &procs, voice);
+        else if(voice->dirty != 0)
+            push_voice(pool, &procs, voice);
+    }
+}
+
+void saladGetALpoolStats(const SALAD_pool_type *pool, SALAD_pool_stats_type *stats)
+{
+    ALsizei i;
+
+    stats->voices = (unsigned long)pool->num_voices;
+    stats->playing = 0;
+    stats->bound = (unsigned long)(pool->num_sources - pool->num_free);
+    stats->binds = pool->binds;
+    stats->culls = pool->culls;
+
+    for(i = 0; i < pool->num_voices; ++i) {
+        if(pool->voices[i].playing)
+            stats->playing++;
+    }
+}
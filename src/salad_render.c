@@ -0,0 +1,671 @@
+/*
+ * salad_render.c - Offline rendering through loopback devices
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <AL/salad_render.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <AL/alext.h>
+#include <AL/salad_table.h>
+
+#include "salad_platform.h"
+
+/* Frames rendered at a time into the scratch
+ * buffer of saladRenderALwave */
+#define RENDER_BLOCK        4096
+
+#define WAVE_FORMAT_PCM         0x0001
+#define WAVE_FORMAT_IEEE_FLOAT  0x0003
+#define WAVE_FORMAT_EXTENSIBLE  0xFFFE
+
+#if defined(ALC_SOFT_loopback)
+struct render_procs {
+    PFN_alcLoopbackOpenDeviceSOFT alcLoopbackOpenDeviceSOFT;
+    PFN_alcIsRenderFormatSupportedSOFT alcIsRenderFormatSupportedSOFT;
+    PFN_alcRenderSamplesSOFT alcRenderSamplesSOFT;
+    PFN_alcCreateContext alcCreateContext;
+    PFN_alcDestroyContext alcDestroyContext;
+    PFN_alcCloseDevice alcCloseDevice;
+    PFN_alcMakeContextCurrent alcMakeContextCurrent;
+    PFN_alcGetCurrentContext alcGetCurrentContext;
+    PFN_alcGetError alcGetError;
+    PFN_alcIsExtensionPresent alcIsExtensionPresent;
+#if defined(ALC_EXT_thread_local_context)
+    PFN_alcSetThreadContext alcSetThreadContext;
+    PFN_alcGetThreadContext alcGetThreadContext;
+#endif
+};
+
+struct SALAD_renderer {
+    const SALAD_table_type *table;
+    ALCdevice *device;
+    ALCcontext *context;
+    ALCenum channels;
+    ALCenum type;
+    ALCsizei frequency;
+    ALCsizei frame_size;
+    int thread_local;
+};
+
+/* Shared by the threads of saladRunALrenderJobs */
+struct render_jobs {
+    salad_mutex_type mutex;
+    SALAD_render_job_type job;
+    void *arg;
+    ALsizei count;
+    ALsizei next;
+    ALsizei succeeded;
+};
+
+struct render_worker {
+    struct render_jobs *jobs;
+    SALAD_renderer_type *renderer;
+    salad_thread_type thread;
+};
+
+static int get_procs(const SALAD_table_type *table, struct render_procs *procs)
+{
+    if(table != NULL) {
+        procs->alcLoopbackOpenDeviceSOFT = table->alcLoopbackOpenDeviceSOFT;
+        procs->alcIsRenderFormatSupportedSOFT = table->alcIsRenderFormatSupportedSOFT;
+        procs->alcRenderSamplesSOFT = table->alcRenderSamplesSOFT;
+        procs->alcCreateContext = table->alcCreateContext;
+        procs->alcDestroyContext = table->alcDestroyContext;
+        procs->alcCloseDevice = table->alcCloseDevice;
+        procs->alcMakeContextCurrent = table->alcMakeContextCurrent;
+        procs->alcGetCurrentContext = table->alcGetCurrentContext;
+        procs->alcGetError = table->alcGetError;
+        procs->alcIsExtensionPresent = table->alcIsExtensionPresent;
+#if defined(ALC_EXT_thread_local_context)
+        procs->alcSetThreadContext = table->alcSetThreadContext;
+        procs->alcGetThreadContext = table->alcGetThreadContext;
+#endif
+    }
+    else {
+#if defined(SALAD_DIRECT_LINK)
+        procs->alcLoopbackOpenDeviceSOFT = &alcLoopbackOpenDeviceSOFT;
+        procs->alcIsRenderFormatSupportedSOFT = &alcIsRenderFormatSupportedSOFT;
+        procs->alcRenderSamplesSOFT = &alcRenderSamplesSOFT;
+        procs->alcCreateContext = &alcCreateContext;
+        procs->alcDestroyContext = &alcDestroyContext;
+        procs->alcCloseDevice = &alcCloseDevice;
+        procs->alcMakeContextCurrent = &alcMakeContextCurrent;
+        procs->alcGetCurrentContext = &alcGetCurrentContext;
+        procs->alcGetError = &alcGetError;
+        procs->alcIsExtensionPresent = &alcIsExtensionPresent;
+#if defined(ALC_EXT_thread_local_context)
+        procs->alcSetThreadContext = &alcSetThreadContext;
+        procs->alcGetThreadContext = &alcGetThreadContext;
+#endif
+#else
+        procs->alcLoopbackOpenDeviceSOFT = SALAD_alcLoopbackOpenDeviceSOFT;
+        procs->alcIsRenderFormatSupportedSOFT = SALAD_alcIsRenderFormatSupportedSOFT;
+        procs->alcRenderSamplesSOFT = SALAD_alcRenderSamplesSOFT;
+        procs->alcCreateContext = SALAD_alcCreateContext;
+        procs->alcDestroyContext = SALAD_alcDestroyContext;
+        procs->alcCloseDevice = SALAD_alcCloseDevice;
+        procs->alcMakeContextCurrent = SALAD_alcMakeContextCurrent;
+        procs->alcGetCurrentContext = SALAD_alcGetCurrentContext;
+        procs->alcGetError = SALAD_alcGetError;
+        procs->alcIsExtensionPresent = SALAD_alcIsExtensionPresent;
+#if defined(ALC_EXT_thread_local_context)
+        procs->alcSetThreadContext = SALAD_alcSetThreadContext;
+        procs->alcGetThreadContext = SALAD_alcGetThreadContext;
+#endif
+#endif
+    }
+
+    return procs->alcLoopbackOpenDeviceSOFT != NULL && procs->alcIsRenderFormatSupportedSOFT != NULL && procs->alcRenderSamplesSOFT != NULL
+        && procs->alcCreateContext != NULL && procs->alcDestroyContext != NULL && procs->alcCloseDevice != NULL
+        && procs->alcMakeContextCurrent != NULL && procs->alcGetCurrentContext != NULL && procs->alcGetError != NULL
+        && procs->alcIsExtensionPresent != NULL;
+}
+
+static ALCsizei channel_count(ALCenum channels)
+{
+    switch(channels) {
+        case ALC_MONO_SOFT:     return 1;
+        case ALC_STEREO_SOFT:   return 2;
+        case ALC_QUAD_SOFT:     return 4;
+        case ALC_5POINT1_SOFT:  return 6;
+        case ALC_6POINT1_SOFT:  return 7;
+        case ALC_7POINT1_SOFT:  return 8;
+    }
+
+    return 0;
+}
+
+static ALCsizei sample_size(ALCenum type)
+{
+    switch(type) {
+        case ALC_BYTE_SOFT:             return 1;
+        case ALC_UNSIGNED_BYTE_SOFT:    return 1;
+        case ALC_SHORT_SOFT:            return 2;
+        case ALC_UNSIGNED_SHORT_SOFT:   return 2;
+        case ALC_INT_SOFT:              return 4;
+        case ALC_UNSIGNED_INT_SOFT:     return 4;
+        case ALC_FLOAT_SOFT:            return 4;
+    }
+
+    return 0;
+}
+
+/* WAVEFORMATEXTENSIBLE speaker positions the
+ * channel orders of ALC_SOFT_loopback map to */
+static unsigned long channel_mask(ALCenum channels)
+{
+    switch(channels) {
+        case ALC_QUAD_SOFT:     return 0x033;   /* FL FR BL BR */
+        case ALC_5POINT1_SOFT:  return 0x60F;   /* FL FR FC LFE SL SR */
+        case ALC_6POINT1_SOFT:  return 0x70F;   /* FL FR FC LFE BC SL SR */
+        case ALC_7POINT1_SOFT:  return 0x63F;   /* FL FR FC LFE BL BR SL SR */
+    }
+
+    return 0;
+}
+
+static int get_thread_context(const struct render_procs *procs, ALCcontext **context)
+{
+#if defined(ALC_EXT_thread_local_context)
+    if(procs->alcGetThreadContext != NULL) {
+        *context = procs->alcGetThreadContext();
+        return 1;
+    }
+#endif
+    (void)procs;
+    (void)context;
+    return 0;
+}
+
+static int set_thread_context(const struct render_procs *procs, ALCcontext *context)
+{
+#if defined(ALC_EXT_thread_local_context)
+    if(procs->alcSetThreadContext != NULL)
+        return procs->alcSetThreadContext(context) != ALC_FALSE;
+#endif
+    (void)procs;
+    (void)context;
+    return 0;
+}
+
+static SALAD_renderer_type *create_renderer(const SALAD_table_type *table, ALCsizei frequency, ALCenum channels, ALCenum type)
+{
+    SALAD_renderer_type *renderer;
+    struct render_procs procs;
+    ALCint attrs[7];
+
+    if(!get_procs(table, &procs) || frequency <= 0 || channel_count(channels) == 0 || sample_size(type) == 0)
+        return NULL;
+
+    if((renderer = (SALAD_renderer_type *)calloc(1, sizeof(SALAD_renderer_type))) == NULL)
+        return NULL;
+
+    renderer->table = table;
+    renderer->channels = channels;
+    renderer->type = type;
+    renderer->frequency = frequency;
+    renderer->frame_size = channel_count(channels) * sample_size(type);
+
+    if((renderer->device = procs.alcLoopbackOpenDeviceSOFT(NULL)) == NULL) {
+        free(renderer);
+        return NULL;
+    }
+
+    attrs[0] = ALC_FORMAT_CHANNELS_SOFT;
+    attrs[1] = (ALCint)channels;
+    attrs[2] = ALC_FORMAT_TYPE_SOFT;
+    attrs[3] = (ALCint)type;
+    attrs[4] = ALC_FREQUENCY;
+    attrs[5] = frequency;
+    attrs[6] = 0;
+
+    if(!procs.alcIsRenderFormatSupportedSOFT(renderer->device, frequency, channels, type)
+        || (renderer->context = procs.alcCreateContext(renderer->device, attrs)) == NULL) {
+        procs.alcCloseDevice(renderer->device);
+        free(renderer);
+        return NULL;
+    }
+
+#if defined(ALC_EXT_thread_local_context)
+    renderer->thread_local = procs.alcSetThreadContext != NULL && procs.alcGetThreadContext != NULL
+        && procs.alcIsExtensionPresent(renderer->device, (const ALCchar *)"ALC_EXT_thread_local_context");
+#endif
+
+    return renderer;
+}
+
+SALAD_renderer_type *saladCreateALrenderer(ALCsizei frequency, ALCenum channels, ALCenum type)
+{
+    return create_renderer(NULL, frequency, channels, type);
+}
+
+SALAD_renderer_type *saladCreateALtableRenderer(const SALAD_table_type *table, ALCsizei frequency, ALCenum channels, ALCenum type)
+{
+    if(table == NULL)
+        return NULL;
+    return create_renderer(table, frequency, channels, type);
+}
+
+void saladDestroyALrenderer(SALAD_renderer_type *renderer)
+{
+    struct render_procs procs;
+    ALCcontext *context;
+
+    if(renderer == NULL)
+        return;
+
+    if(get_procs(renderer->table, &procs)) {
+        if(renderer->thread_local && get_thread_context(&procs, &context) && context == renderer->context)
+            set_thread_context(&procs, NULL);
+        if(procs.alcGetCurrentContext() == renderer->context)
+            procs.alcMakeContextCurrent(NULL);
+
+        procs.alcDestroyContext(renderer->context);
+        procs.alcCloseDevice(renderer->device);
+    }
+
+    free(renderer);
+}
+
+int saladMakeALrendererCurrent(SALAD_renderer_type *renderer)
+{
+    struct render_procs procs;
+
+    if(!get_procs(renderer->table, &procs))
+        return 0;
+    if(renderer->thread_local)
+        return set_thread_context(&procs, renderer->context);
+    return procs.alcMakeContextCurrent(renderer->context) != ALC_FALSE;
+}
+
+ALboolean saladIsALrendererThreadLocal(SALAD_renderer_type *renderer)
+{
+    return renderer->thread_local ? AL_TRUE : AL_FALSE;
+}
+
+ALCdevice *saladGetALrendererDevice(SALAD_renderer_type *renderer)
+{
+    return renderer->device;
+}
+
+ALCsizei saladGetALrendererFrameSize(SALAD_renderer_type *renderer)
+{
+    return renderer->frame_size;
+}
+
+int saladRenderALmemory(SALAD_renderer_type *renderer, ALCvoid *buffer, ALCsizei frames)
+{
+    struct render_procs procs;
+
+    if(frames < 0 || (frames > 0 && buffer == NULL) || !get_procs(renderer->table, &procs))
+        return 0;
+
+    procs.alcGetError(renderer->device);
+    procs.alcRenderSamplesSOFT(renderer->device, buffer, frames);
+    return procs.alcGetError(renderer->device) == ALC_NO_ERROR;
+}
+
+static void put_u16(unsigned char *out, unsigned long value)
+{
+    out[0] = (unsigned char)(value & 0xFF);
+    out[1] = (unsigned char)((value >> 8) & 0xFF);
+}
+
+static void put_u32(unsigned char *out, unsigned long value)
+{
+    put_u16(out, value & 0xFFFF);
+    put_u16(&out[2], (value >> 16) & 0xFFFF);
+}
+
+/**
+ * Builds the header of a WAV file, a plain WAVEFORMATEX
+ * for mono and stereo and a WAVEFORMATEXTENSIBLE with
+ * a channel mask for anything wider
+ * @param header    Output of up to 68 bytes
+ * @param renderer  Renderer whose format to describe
+ * @param data_size Size of the sample data in bytes
+ * @returns         Size of the header in bytes
+ */
+static size_t wave_header(unsigned char *header, const SALAD_renderer_type *renderer, unsigned long data_size)
+{
+    unsigned long channels = (unsigned long)channel_count(renderer->channels);
+    unsigned long bits = (unsigned long)sample_size(renderer->type) * 8;
+    unsigned long tag = (renderer->type == ALC_FLOAT_SOFT) ? WAVE_FORMAT_IEEE_FLOAT : WAVE_FORMAT_PCM;
+    unsigned long fmt_size = (channels > 2) ? 40 : 16;
+    size_t size = 20 + fmt_size + 8;
+
+    memcpy(header, "RIFF", 4);
+    put_u32(&header[4], (unsigned long)size - 8 + data_size);
+    memcpy(&header[8], "WAVEfmt ", 8);
+    put_u32(&header[16], fmt_size);
+    put_u16(&header[20], (channels > 2) ? WAVE_FORMAT_EXTENSIBLE : tag);
+    put_u16(&header[22], channels);
+    put_u32(&header[24], (unsigned long)renderer->frequency);
+    put_u32(&header[28], (unsigned long)renderer->frequency * (unsigned long)renderer->frame_size);
+    put_u16(&header[32], (unsigned long)renderer->frame_size);
+    put_u16(&header[34], bits);
+
+    if(channels > 2) {
+        /* The sub-format GUID is the format tag
+         * followed by a fixed suffix */
+        static const unsigned char suffix[14] = { 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 };
+
+        put_u16(&header[36], 22);
+        put_u16(&header[38], bits);
+        put_u32(&header[40], channel_mask(renderer->channels));
+        put_u16(&header[44], tag);
+        memcpy(&header[46], suffix, sizeof(suffix));
+    }
+
+    memcpy(&header[size - 8], "data", 4);
+    put_u32(&header[size - 4], data_size);
+    return size;
+}
+
+/* WAV files are little endian whatever the host is */
+static void swap_samples(unsigned char *data, size_t size, ALCsizei sample_size)
+{
+    static const union { unsigned short value; unsigned char bytes[2]; } order = { 1 };
+    unsigned char byte;
+    size_t i;
+
+    if(order.bytes[0] == 1 || sample_size == 1)
+        return;
+
+    for(i = 0; i + (size_t)sample_size <= size; i += (size_t)sample_size) {
+        if(sample_size == 2) {
+            byte = data[i]; data[i] = data[i + 1]; data[i + 1] = byte;
+        }
+        else {
+            byte = data[i]; data[i] = data[i + 3]; data[i + 3] = byte;
+            byte = data[i + 1]; data[i + 1] = data[i + 2]; data[i + 2] = byte;
+        }
+    }
+}
+
+int saladRenderALwave(SALAD_renderer_type *renderer, const char *path, ALCsizei frames)
+{
+    unsigned char header[68];
+    unsigned char *block;
+    unsigned long data_size;
+    size_t header_size;
+    ALCsizei count;
+    FILE *file;
+    int result = 1;
+
+    if(frames < 0 || path == NULL)
+        return 0;
+
+    /* Nothing else has a WAV equivalent */
+    if(renderer->type != ALC_UNSIGNED_BYTE_SOFT && renderer->type != ALC_SHORT_SOFT
+        && renderer->type != ALC_INT_SOFT && renderer->type != ALC_FLOAT_SOFT)
+        return 0;
+
+    /* The RIFF size has to fit in 32 bits */
+    if((unsigned long)frames > (0xFFFFFFFFUL - 68) / (unsigned long)renderer->frame_size)
+        return 0;
+    data_size = (unsigned long)frames * (unsigned long)renderer->frame_size;
+
+    if((block = (unsigned char *)malloc((size_t)RENDER_BLOCK * (size_t)renderer->frame_size)) == NULL)
+        return 0;
+
+    if((file = fopen(path, "wb")) == NULL) {
+        free(block);
+        return 0;
+    }
+
+    header_size = wave_header(header, renderer, data_size);
+    if(fwrite(header, 1, header_size, file) != header_size)
+        result = 0;
+
+    for(; result && frames > 0; frames -= count) {
+        count = (frames < RENDER_BLOCK) ? frames : RENDER_BLOCK;
+        if(!saladRenderALmemory(renderer, block, count)) {
+            result = 0;
+            break;
+        }
+
+        swap_samples(block, (size_t)count * (size_t)renderer->frame_size, sample_size(renderer->type));
+        if(fwrite(block, (size_t)renderer->frame_size, (size_t)count, file) != (size_t)count)
+            result = 0;
+    }
+
+    if(fclose(file) != 0)
+        result = 0;
+    free(block);
+
+    return result;
+}
+
+static void run_jobs(struct render_jobs *jobs, SALAD_renderer_type *renderer)
+{
+    ALsizei index;
+    int succeeded;
+
+    for(;;) {
+        salad_mutex_lock(&jobs->mutex);
+        index = jobs->next;
+        if(index < jobs->count)
+            jobs->next++;
+        salad_mutex_unlock(&jobs->mutex);
+
+        if(index >= jobs->count)
+            break;
+
+        succeeded = jobs->job(renderer, index, jobs->arg);
+
+        salad_mutex_lock(&jobs->mutex);
+        if(succeeded)
+            jobs->succeeded++;
+        salad_mutex_unlock(&jobs->mutex);
+    }
+}
+
+static salad_thread_result_type SALAD_THREAD_APIENTRY render_worker(void *arg)
+{
+    struct render_worker *worker = (struct render_worker *)arg;
+    struct render_procs procs;
+
+    if(get_procs(worker->renderer->table, &procs) && set_thread_context(&procs, worker->renderer->context)) {
+        run_jobs(worker->jobs, worker->renderer);
+        set_thread_context(&procs, NULL);
+    }
+
+    return (salad_thread_result_type)0;
+}
+
+static ALsizei run_render_jobs(const SALAD_table_type *table, ALCsizei frequency, ALCenum channels, ALCenum type, SALAD_render_job_type job, void *arg, ALsizei count, ALsizei threads)
+{
+    struct render_worker *workers;
+    struct render_jobs jobs;
+    struct render_procs procs;
+    SALAD_renderer_type *renderer;
+    ALCcontext *previous;
+    ALsizei started;
+    ALsizei i;
+
+    if(job == NULL || count <= 0 || !get_procs(table, &procs))
+        return 0;
+
+    if((renderer = create_renderer(table, frequency, channels, type)) == NULL)
+        return 0;
+
+    jobs.job = job;
+    jobs.arg = arg;
+    jobs.count = count;
+    jobs.next = 0;
+    jobs.succeeded = 0;
+    salad_mutex_init(&jobs.mutex);
+
+    /* A context current for the whole process
+     * can only be used by one thread at a time */
+    if(threads > count)
+        threads = count;
+    if(!renderer->thread_local || threads <= 1
+        || (workers = (struct render_worker *)calloc((size_t)threads - 1, sizeof(struct render_worker))) == NULL) {
+        if(renderer->thread_local) {
+            if(!get_thread_context(&procs, &previous))
+                previous = NULL;
+            if(set_thread_context(&procs, renderer->context))
+                run_jobs(&jobs, renderer);
+            set_thread_context(&procs, previous);
+        }
+        else {
+            previous = procs.alcGetCurrentContext();
+            if(procs.alcMakeContextCurrent(renderer->context))
+                run_jobs(&jobs, renderer);
+            procs.alcMakeContextCurrent(previous);
+        }
+
+        saladDestroyALrenderer(renderer);
+        salad_mutex_destroy(&jobs.mutex);
+        return jobs.succeeded;
+    }
+
+    /* The calling thread is a worker too, whatever
+     * threads fail to start are made up for by the rest */
+    for(started = 0; started < threads - 1; ++started) {
+        workers[started].jobs = &jobs;
+        if((workers[started].renderer = create_renderer(table, frequency, channels, type)) == NULL)
+            break;
+        if(!salad_thread_create(&workers[started].thread, &render_worker, &workers[started])) {
+            saladDestroyALrenderer(workers[started].renderer);
+            break;
+        }
+    }
+
+    if(!get_thread_context(&procs, &previous))
+        previous = NULL;
+    if(set_thread_context(&procs, renderer->context))
+        run_jobs(&jobs, renderer);
+    set_thread_context(&procs, previous);
+
+    for(i = 0; i < started; ++i) {
+        salad_thread_join(workers[i].thread);
+        saladDestroyALrenderer(workers[i].renderer);
+    }
+
+    free(workers);
+    saladDestroyALrenderer(renderer);
+    salad_mutex_destroy(&jobs.mutex);
+
+    return jobs.succeeded;
+}
+
+ALsizei saladRunALrenderJobs(ALCsizei frequency, ALCenum channels, ALCenum type, SALAD_render_job_type job, void *arg, ALsizei count, ALsizei threads)
+{
+    return run_render_jobs(NULL, frequency, channels, type, job, arg, count, threads);
+}
+
+ALsizei saladRunALtableRenderJobs(const SALAD_table_type *table, ALCsizei frequency, ALCenum channels, ALCenum type, SALAD_render_job_type job, void *arg, ALsizei count, ALsizei threads)
+{
+    if(table == NULL)
+        return 0;
+    return run_render_jobs(table, frequency, channels, type, job, arg, count, threads);
+}
+#else
+/* Without ALC_SOFT_loopback there's nothing to render through,
+ * renderers can't be created and everything else is unreachable */
+struct SALAD_renderer {
+    ALCdevice *device;
+    ALCsizei frame_size;
+};
+
+SALAD_renderer_type *saladCreateALrenderer(ALCsizei frequency, ALCenum channels, ALCenum type)
+{
+    (void)frequency;
+    (void)channels;
+    (void)type;
+    return NULL;
+}
+
+SALAD_renderer_type *saladCreateALtableRenderer(const SALAD_table_type *table, ALCsizei frequency, ALCenum channels, ALCenum type)
+{
+    (void)table;
+    return saladCreateALrenderer(frequency, channels, type);
+}
+
+void saladDestroyALrenderer(SALAD_renderer_type *renderer)
+{
+    (void)renderer;
+}
+
+int saladMakeALrendererCurrent(SALAD_renderer_type *renderer)
+{
+    (void)renderer;
+    return 0;
+}
+
+ALboolean saladIsALrendererThreadLocal(SALAD_renderer_type *renderer)
+{
+    (void)renderer;
+    return AL_FALSE;
+}
+
+ALCdevice *saladGetALrendererDevice(SALAD_renderer_type *renderer)
+{
+    return renderer->device;
+}
+
+ALCsizei saladGetALrendererFrameSize(SALAD_renderer_type *renderer)
+{
+    return renderer->frame_size;
+}
+
+int saladRenderALmemory(SALAD_renderer_type *renderer, ALCvoid *buffer, ALCsizei frames)
+{
+    (void)renderer;
+    (void)buffer;
+    (void)frames;
+    return 0;
+}
+
+int saladRenderALwave(SALAD_renderer_type *renderer, const char *path, ALCsizei frames)
+{
+    (void)renderer;
+    (void)path;
+    (void)frames;
+    return 0;
+}
+
+ALsizei saladRunALrenderJobs(ALCsizei frequency, ALCenum channels, ALCenum type, SALAD_render_job_type job, void *arg, ALsizei count, ALsizei threads)
+{
+    (void)frequency;
+    (void)channels;
+    (void)type;
+    (void)job;
+    (void)arg;
+    (void)count;
+    (void)threads;
+    return 0;
+}
+
+ALsizei saladRunALtableRenderJobs(const SALAD_table_type *table, ALCsizei frequency, ALCenum channels, ALCenum type, SALAD_render_job_type job, void *arg, ALsizei count, ALsizei threads)
+{
+    (void)table;
+    return saladRunALrenderJobs(frequency, channels, type, job, arg, count, threads);
+}
+#endif
@@ -0,0 +1,509 @@
+/*
+ * salad_resample.c - Polyphase sample rate conversion
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <AL/salad_convert.h>
+#include <AL/salad_resample.h>
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "salad_simd.h"
+
+/* Taps of the filter when the output rate isn't lower,
+ * downsampling stretches it by the ratio of the rates */
+#define RS_TAPS     64
+#define RS_MAX_TAPS 512
+
+/* Odd rates can have thousands of phases, those
+ * are rounded to the nearest of this many */
+#define RS_PHASES   512
+
+/* Input frames taken in at a time */
+#define RS_BLOCK    1024
+
+/* Kaiser window for about 90 dB of stopband attenuation,
+ * and a cutoff that puts the whole transition band below
+ * half of the lower rate so nothing aliases */
+#define RS_BETA     9.0
+#define RS_CUTOFF   0.91
+
+struct SALAD_resampler {
+    unsigned long up;       /* Output rate divided by the GCD of both rates */
+    unsigned long down;     /* Input rate divided by the GCD of both rates */
+    ALsizei channels;
+    ALsizei taps;           /* A multiple of eight */
+    ALsizei phases;
+    ALsizei capacity;       /* Frames of history per channel */
+    ALsizei pending;        /* Frames of history filled */
+    ALsizei base;           /* Frame the next output is interpolated after */
+    unsigned long frac;     /* How far past the frame it is, in 1/up */
+    ALfloat *coeffs;        /* phases + 1 filters of taps each */
+    ALfloat *history;       /* Planar, capacity frames per channel */
+    ALfloat *in_block;      /* Input of the 16-bit path */
+    ALfloat *out_block;     /* Output of the 16-bit path */
+};
+
+/**
+ * Filters one output frame, every channel with the
+ * same filter; the vector kernels filter channels in
+ * pairs so both share every load of the filter
+ * @param out       Output frame
+ * @param in        Input of the first channel
+ * @param stride    Distance between channels of the input
+ * @param channels  Number of channels
+ * @param coeffs    Filter
+ * @param taps      Length of the filter, a multiple of eight
+ */
+static void filter_c(ALfloat *out, const ALfloat *in, ALsizei stride, ALsizei channels, const ALfloat *coeffs, ALsizei taps)
+{
+    ALfloat sum;
+    ALsizei i, j;
+
+    for(j = 0; j < channels; ++j, in += stride) {
+        for(sum = 0.0f, i = 0; i < taps; ++i)
+            sum += in[i] * coeffs[i];
+        out[j] = sum;
+    }
+}
+
+#if defined(SALAD_SIMD_SSE2)
+static ALfloat sum_sse2(__m128 x)
+{
+    x = _mm_add_ps(x, _mm_movehl_ps(x, x));
+    x = _mm_add_ss(x, _mm_shuffle_ps(x, x, 1));
+    return _mm_cvtss_f32(x);
+}
+
+static void filter_sse2(ALfloat *out, const ALfloat *in, ALsizei stride, ALsizei channels, const ALfloat *coeffs, ALsizei taps)
+{
+    __m128 a0, a1, b0, b1, c0, c1;
+    ALsizei i, j;
+
+    for(j = 0; j + 2 <= channels; j += 2, in += stride * 2) {
+        a0 = a1 = b0 = b1 = _mm_setzero_ps();
+        for(i = 0; i < taps; i += 8) {
+            c0 = _mm_loadu_ps(&coeffs[i]);
+            c1 = _mm_loadu_ps(&coeffs[i + 4]);
+            a0 = _mm_add_ps(a0, _mm_mul_ps(_mm_loadu_ps(&in[i]), c0));
+            a1 = _mm_add_ps(a1, _mm_mul_ps(_mm_loadu_ps(&in[i + 4]), c1));
+            b0 = _mm_add_ps(b0, _mm_mul_ps(_mm_loadu_ps(&in[stride + i]), c0));
+            b1 = _mm_add_ps(b1, _mm_mul_ps(_mm_loadu_ps(&in[stride + i + 4]), c1));
+        }
+
+        out[j] = sum_sse2(_mm_add_ps(a0, a1));
+        out[j + 1] = sum_sse2(_mm_add_ps(b0, b1));
+    }
+
+    if(j < channels) {
+        a0 = a1 = _mm_setzero_ps();
+        for(i = 0; i < taps; i += 8) {
+            a0 = _mm_add_ps(a0, _mm_mul_ps(_mm_loadu_ps(&in[i]), _mm_loadu_ps(&coeffs[i])));
+            a1 = _mm_add_ps(a1, _mm_mul_ps(_mm_loadu_ps(&in[i + 4]), _mm_loadu_ps(&coeffs[i + 4])));
+        }
+
+        out[j] = sum_sse2(_mm_add_ps(a0, a1));
+    }
+}
+#endif
+
+#if defined(SALAD_SIMD_AVX2)
+SALAD_AVX2_TARGET static ALfloat sum_avx2(__m256 x)
+{
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+    return _mm_cvtss_f32(sum);
+}
+
+SALAD_AVX2_TARGET static void filter_avx2(ALfloat *out, const ALfloat *in, ALsizei stride, ALsizei channels, const ALfloat *coeffs, ALsizei taps)
+{
+    __m256 a0, a1, b0, b1, c0, c1;
+    ALsizei i, j;
+
+    /* Eight taps at a time, the last eight on their own */
+    for(j = 0; j + 2 <= channels; j += 2, in += stride * 2) {
+        a0 = a1 = b0 = b1 = _mm256_setzero_ps();
+        for(i = 0; i + 16 <= taps; i += 16) {
+            c0 = _mm256_loadu_ps(&coeffs[i]);
+            c1 = _mm256_loadu_ps(&coeffs[i + 8]);
+            a0 = _mm256_add_ps(a0, _mm256_mul_ps(_mm256_loadu_ps(&in[i]), c0));
+            a1 = _mm256_add_ps(a1, _mm256_mul_ps(_mm256_loadu_ps(&in[i + 8]), c1));
+            b0 = _mm256_add_ps(b0, _mm256_mul_ps(_mm256_loadu_ps(&in[stride + i]), c0));
+            b1 = _mm256_add_ps(b1, _mm256_mul_ps(_mm256_loadu_ps(&in[stride + i + 8]), c1));
+        }
+        if(i < taps) {
+            c0 = _mm256_loadu_ps(&coeffs[i]);
+            a0 = _mm256_add_ps(a0, _mm256_mul_ps(_mm256_loadu_ps(&in[i]), c0));
+            b0 = _mm256_add_ps(b0, _mm256_mul_ps(_mm256_loadu_ps(&in[stride + i]), c0));
+        }
+
+        out[j] = sum_avx2(_mm256_add_ps(a0, a1));
+        out[j + 1] = sum_avx2(_mm256_add_ps(b0, b1));
+    }
+
+    if(j < channels) {
+        a0 = a1 = _mm256_setzero_ps();
+        for(i = 0; i + 16 <= taps; i += 16) {
+            a0 = _mm256_add_ps(a0, _mm256_mul_ps(_mm256_loadu_ps(&in[i]), _mm256_loadu_ps(&coeffs[i])));
+            a1 = _mm256_add_ps(a1, _mm256_mul_ps(_mm256_loadu_ps(&in[i + 8]), _mm256_loadu_ps(&coeffs[i + 8])));
+        }
+        if(i < taps)
+            a0 = _mm256_add_ps(a0, _mm256_mul_ps(_mm256_loadu_ps(&in[i]), _mm256_loadu_ps(&coeffs[i])));
+
+        out[j] = sum_avx2(_mm256_add_ps(a0, a1));
+    }
+}
+#endif
+
+#if defined(SALAD_SIMD_NEON)
+static void filter_neon(ALfloat *out, const ALfloat *in, ALsizei stride, ALsizei channels, const ALfloat *coeffs, ALsizei taps)
+{
+    float32x4_t a0, a1, b0, b1, c0, c1;
+    ALsizei i, j;
+
+    for(j = 0; j + 2 <= channels; j += 2, in += stride * 2) {
+        a0 = a1 = b0 = b1 = vdupq_n_f32(0.0f);
+        for(i = 0; i < taps; i += 8) {
+            c0 = vld1q_f32(&coeffs[i]);
+            c1 = vld1q_f32(&coeffs[i + 4]);
+            a0 = vmlaq_f32(a0, vld1q_f32(&in[i]), c0);
+            a1 = vmlaq_f32(a1, vld1q_f32(&in[i + 4]), c1);
+            b0 = vmlaq_f32(b0, vld1q_f32(&in[stride + i]), c0);
+            b1 = vmlaq_f32(b1, vld1q_f32(&in[stride + i + 4]), c1);
+        }
+
+        out[j] = vaddvq_f32(vaddq_f32(a0, a1));
+        out[j + 1] = vaddvq_f32(vaddq_f32(b0, b1));
+    }
+
+    if(j < channels) {
+        a0 = a1 = vdupq_n_f32(0.0f);
+        for(i = 0; i < taps; i += 8) {
+            a0 = vmlaq_f32(a0, vld1q_f32(&in[i]), vld1q_f32(&coeffs[i]));
+            a1 = vmlaq_f32(a1, vld1q_f32(&in[i + 4]), vld1q_f32(&coeffs[i + 4]));
+        }
+
+        out[j] = vaddvq_f32(vaddq_f32(a0, a1));
+    }
+}
+#endif
+
+typedef void (*filter_type)(ALfloat *out, const ALfloat *in, ALsizei stride, ALsizei channels, const ALfloat *coeffs, ALsizei taps);
+
+static filter_type get_filter(void)
+{
+    switch(salad_simd_kernel()) {
+#if defined(SALAD_SIMD_AVX2)
+        case SALAD_CONVERT_AVX2:    return &filter_avx2;
+#endif
+#if defined(SALAD_SIMD_SSE2)
+        case SALAD_CONVERT_SSE2:    return &filter_sse2;
+#endif
+#if defined(SALAD_SIMD_NEON)
+        case SALAD_CONVERT_NEON:    return &filter_neon;
+#endif
+    }
+
+    return &filter_c;
+}
+
+/* Zeroth order modified Bessel function of the first kind */
+static double bessel_i0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    int k;
+
+    for(k = 1; k < 64 && term > sum * 1e-12; ++k) {
+        term *= (x * 0.5 / (double)k) * (x * 0.5 / (double)k);
+        sum += term;
+    }
+
+    return sum;
+}
+
+/**
+ * Fills every phase of the filter; phase p interpolates
+ * p / phases of a frame past the base frame, which sits at
+ * tap taps / 2 - 1. The extra last phase is a whole frame
+ * past it, where rounding the phase of odd rates can end up
+ * @param resampler Resampler to fill
+ */
+static void build_filter(SALAD_resampler_type *resampler)
+{
+    const double pi = 3.141592653589793;
+    const double half = (double)(resampler->taps / 2);
+    double cutoff = RS_CUTOFF;
+    double x, t, value, sum;
+    ALfloat *coeffs;
+    ALsizei p, k;
+
+    if(resampler->up < resampler->down)
+        cutoff *= (double)resampler->up / (double)resampler->down;
+
+    for(p = 0; p <= resampler->phases; ++p) {
+        coeffs = &resampler->coeffs[p * resampler->taps];
+
+        for(sum = 0.0, k = 0; k < resampler->taps; ++k) {
+            x = (double)(k - resampler->taps / 2 + 1) - (double)p / (double)resampler->phases;
+            t = x / half;
+            value = (x == 0.0) ? cutoff : sin(pi * cutoff * x) / (pi * x);
+            value *= (t * t < 1.0) ? bessel_i0(RS_BETA * sqrt(1.0 - t * t)) / bessel_i0(RS_BETA) : 0.0;
+            coeffs[k] = (ALfloat)value;
+            sum += value;
+        }
+
+        /* Every phase passes DC at exactly unity gain */
+        for(k = 0; k < resampler->taps; ++k)
+            coeffs[k] = (ALfloat)(coeffs[k] / sum);
+    }
+}
+
+static void reset(SALAD_resampler_type *resampler)
+{
+    /* The first output sits on the first input frame,
+     * so the history starts with the frames before it */
+    memset(resampler->history, 0, sizeof(ALfloat) * (size_t)resampler->capacity * (size_t)resampler->channels);
+    resampler->pending = resampler->taps / 2 - 1;
+    resampler->base = resampler->taps / 2 - 1;
+    resampler->frac = 0;
+}
+
+static unsigned long gcd(unsigned long a, unsigned long b)
+{
+    unsigned long r;
+
+    while(b != 0) {
+        r = a % b;
+        a = b;
+        b = r;
+    }
+
+    return a;
+}
+
+/**
+ * Runs input frames through the filter
+ * @param resampler Resampler to run
+ * @param out       Output frames
+ * @param in        Input frames, NULL for silence
+ * @param frames    Number of input frames
+ * @returns         Number of output frames written
+ */
+static ALsizei run(SALAD_resampler_type *resampler, ALfloat *out, const ALfloat *in, ALsizei frames)
+{
+    const filter_type filter = get_filter();
+    const ALsizei channels = resampler->channels;
+    const ALsizei capacity = resampler->capacity;
+    const ALsizei half = resampler->taps / 2;
+    const ALsizei pad = half - 1;
+    const ALfloat *coeffs;
+    ALfloat *history;
+    ALsizei written = 0;
+    ALsizei take, drop, i, j;
+
+    while(frames > 0) {
+        take = capacity - resampler->pending;
+        if(take > frames)
+            take = frames;
+
+        for(j = 0; j < channels; ++j) {
+            history = &resampler->history[j * capacity + resampler->pending];
+            for(i = 0; i < take; ++i)
+                history[i] = (in != NULL) ? in[i * channels + j] : 0.0f;
+        }
+
+        if(in != NULL)
+            in += take * channels;
+        frames -= take;
+        resampler->pending += take;
+
+        /* Every output needs half the filter worth of frames after its base */
+        while(resampler->base + half < resampler->pending) {
+            if(resampler->up <= (unsigned long)resampler->phases)
+                coeffs = &resampler->coeffs[(ALsizei)resampler->frac * resampler->taps];
+            else coeffs = &resampler->coeffs[(ALsizei)((double)resampler->frac * (double)resampler->phases / (double)resampler->up + 0.5) * resampler->taps];
+
+            filter(&out[written * channels], &resampler->history[resampler->base - pad], capacity, channels, coeffs, resampler->taps);
+            ++written;
+
+            resampler->frac += resampler->down;
+            resampler->base += (ALsizei)(resampler->frac / resampler->up);
+            resampler->frac %= resampler->up;
+        }
+
+        /* Keep only what the next output still needs */
+        if((drop = resampler->base - pad) > 0) {
+            for(j = 0; j < channels; ++j) {
+                history = &resampler->history[j * capacity];
+                memmove(history, &history[drop], sizeof(ALfloat) * (size_t)(resampler->pending - drop));
+            }
+
+            resampler->pending -= drop;
+            resampler->base -= drop;
+        }
+    }
+
+    return written;
+}
+
+SALAD_resampler_type *saladCreateALresampler(ALsizei in_frequency, ALsizei out_frequency, ALsizei channels)
+{
+    SALAD_resampler_type *resampler;
+    unsigned long divisor;
+    ALsizei block;
+
+    if(in_frequency <= 0 || out_frequency <= 0 || in_frequency / 8 > out_frequency || channels <= 0 || channels > SALAD_RESAMPLE_CHANNELS)
+        return NULL;
+
+    if((resampler = (SALAD_resampler_type *)calloc(1, sizeof(SALAD_resampler_type))) == NULL)
+        return NULL;
+
+    divisor = gcd((unsigned long)in_frequency, (unsigned long)out_frequency);
+    resampler->up = (unsigned long)out_frequency / divisor;
+    resampler->down = (unsigned long)in_frequency / divisor;
+    resampler->channels = channels;
+
+    /* Rates that match only ever copy */
+    if(resampler->up == resampler->down)
+        return resampler;
+
+    resampler->taps = RS_TAPS;
+    if(resampler->up < resampler->down)
+        resampler->taps = (ALsizei)((RS_TAPS * resampler->down + resampler->up - 1) / resampler->up + 7) & ~7;
+    if(resampler->taps > RS_MAX_TAPS)
+        resampler->taps = RS_MAX_TAPS;
+
+    resampler->phases = (resampler->up < RS_PHASES) ? (ALsizei)resampler->up : RS_PHASES;
+    resampler->capacity = RS_BLOCK + resampler->taps;
+
+    resampler->coeffs = (ALfloat *)malloc(sizeof(ALfloat) * (size_t)(resampler->phases + 1) * (size_t)resampler->taps);
+    resampler->history = (ALfloat *)malloc(sizeof(ALfloat) * (size_t)resampler->capacity * (size_t)channels);
+    resampler->in_block = (ALfloat *)malloc(sizeof(ALfloat) * RS_BLOCK * (size_t)channels);
+
+    block = saladGetALresamplerOutput(resampler, RS_BLOCK);
+    resampler->out_block = (ALfloat *)malloc(sizeof(ALfloat) * (size_t)block * (size_t)channels);
+
+    if(resampler->coeffs == NULL || resampler->history == NULL || resampler->in_block == NULL || resampler->out_block == NULL) {
+        saladDestroyALresampler(resampler);
+        return NULL;
+    }
+
+    build_filter(resampler);
+    reset(resampler);
+    return resampler;
+}
+
+void saladDestroyALresampler(SALAD_resampler_type *resampler)
+{
+    if(resampler == NULL)
+        return;
+
+    free(resampler->out_block);
+    free(resampler->in_block);
+    free(resampler->history);
+    free(resampler->coeffs);
+    free(resampler);
+}
+
+ALsizei saladGetALresamplerOutput(const SALAD_resampler_type *resampler, ALsizei frames)
+{
+    double bound;
+
+    if(resampler->up == resampler->down)
+        return frames;
+
+    /* Whatever is held back comes out with the next call */
+    bound = (double)(frames + resampler->taps) * (double)resampler->up / (double)resampler->down + 1.0;
+    return (bound < (double)INT_MAX) ? (ALsizei)bound : INT_MAX;
+}
+
+ALsizei saladResampleALfloat(SALAD_resampler_type *resampler, ALfloat *out, const ALfloat *in, ALsizei frames)
+{
+    if(frames <= 0)
+        return 0;
+
+    if(resampler->up == resampler->down) {
+        memcpy(out, in, sizeof(ALfloat) * (size_t)frames * (size_t)resampler->channels);
+        return frames;
+    }
+
+    return run(resampler, out, in, frames);
+}
+
+ALsizei saladResampleALshort(SALAD_resampler_type *resampler, ALshort *out, const ALshort *in, ALsizei frames)
+{
+    const ALsizei channels = resampler->channels;
+    ALsizei written = 0;
+    ALsizei size, result;
+
+    if(frames <= 0)
+        return 0;
+
+    if(resampler->up == resampler->down) {
+        memcpy(out, in, sizeof(ALshort) * (size_t)frames * (size_t)channels);
+        return frames;
+    }
+
+    while(frames > 0) {
+        size = (frames < RS_BLOCK) ? frames : RS_BLOCK;
+        saladConvertALshortToFloat(resampler->in_block, in, size * channels);
+        result = run(resampler, resampler->out_block, resampler->in_block, size);
+        saladConvertALfloatToShort(&out[written * channels], resampler->out_block, result * channels);
+
+        in += size * channels;
+        frames -= size;
+        written += result;
+    }
+
+    return written;
+}
+
+ALsizei saladFlushALresampler(SALAD_resampler_type *resampler, ALfloat *out)
+{
+    ALsizei written;
+
+    if(resampler->up == resampler->down)
+        return 0;
+
+    /* Silence lets the last frames reach the middle of the filter */
+    written = run(resampler, out, NULL, resampler->taps / 2);
+    reset(resampler);
+    return written;
+}
+
+ALsizei saladFlushALresamplerShort(SALAD_resampler_type *resampler, ALshort *out)
+{
+    ALsizei written;
+
+    if(resampler->up == resampler->down)
+        return 0;
+
+    written = run(resampler, resampler->out_block, NULL, resampler->taps / 2);
+    saladConvertALfloatToShort(out, resampler->out_block, written * resampler->channels);
+    reset(resampler);
+    return written;
+}
@@ -0,0 +1,656 @@
+/*
+ * salad_shadow.c - Shadow state for source and listener parameters
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#include <AL/salad_shadow.h>
+#include <float.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <AL/al.h>
+#include <AL/alc.h>
+#include <AL/alext.h>
+#include <AL/salad_table.h>
+
+#include "salad_functions.h"
+#include "salad_platform.h"
+
+#if !defined(SALAD_DIRECT_LINK)
+
+/* Sources are kept in an open addressing table of
+ * SHADOW_SOURCES entries probed at most SHADOW_PROBES
+ * times; a source that finds no room evicts another one */
+#define SHADOW_SOURCES      2048
+#define SHADOW_PROBES       8
+
+/* Float parameters of a source */
+#define SOURCE_VALUES       19
+
+/* Float parameters of the listener */
+#define LISTENER_VALUES     13
+
+/* Where a parameter lives in a value array, which bit
+ * tells that it's known and the range the driver accepts;
+ * the ranges are closed, so NaN and infinities fall outside */
+struct shadow_param {
+    unsigned int bit;
+    int index;
+    int count;
+    ALfloat min;
+    ALfloat max;
+};
+
+/* The names are kept apart from the values so that
+ * probing only ever walks a compact array of integers */
+struct shadow_source {
+    unsigned int known;
+    ALfloat values[SOURCE_VALUES];
+};
+
+static const struct shadow_param source_params[] = {
+    { 0x0001,   0,  1,  0.0f,       FLT_MAX },  /* AL_PITCH */
+    { 0x0002,   1,  1,  0.0f,       FLT_MAX },  /* AL_GAIN */
+    { 0x0004,   2,  1,  0.0f,       1.0f    },  /* AL_MIN_GAIN */
+    { 0x0008,   3,  1,  0.0f,       1.0f    },  /* AL_MAX_GAIN */
+    { 0x0010,   4,  1,  0.0f,       FLT_MAX },  /* AL_MAX_DISTANCE */
+    { 0x0020,   5,  1,  0.0f,       FLT_MAX },  /* AL_ROLLOFF_FACTOR */
+    { 0x0040,   6,  1,  0.0f,       FLT_MAX },  /* AL_REFERENCE_DISTANCE */
+    { 0x0080,   7,  1,  0.0f,       1.0f    },  /* AL_CONE_OUTER_GAIN */
+    { 0x0100,   8,  1,  0.0f,       360.0f  },  /* AL_CONE_INNER_ANGLE */
+    { 0x0200,   9,  1,  0.0f,       360.0f  },  /* AL_CONE_OUTER_ANGLE */
+    { 0x0400,   10, 3,  -FLT_MAX,   FLT_MAX },  /* AL_POSITION */
+    { 0x0800,   13, 3,  -FLT_MAX,   FLT_MAX },  /* AL_VELOCITY */
+    { 0x1000,   16, 3,  -FLT_MAX,   FLT_MAX }   /* AL_DIRECTION */
+};
+
+static const struct shadow_param listener_params[] = {
+    { 0x0001,   0,  1,  0.0f,       FLT_MAX },  /* AL_GAIN */
+    { 0x0002,   1,  3,  -FLT_MAX,   FLT_MAX },  /* AL_POSITION */
+    { 0x0004,   4,  3,  -FLT_MAX,   FLT_MAX },  /* AL_VELOCITY */
+    { 0x0008,   7,  6,  -FLT_MAX,   FLT_MAX }   /* AL_ORIENTATION */
+};
+
+static ALuint source_names[SHADOW_SOURCES];
+static struct shadow_source source_state[SHADOW_SOURCES];
+static unsigned int listener_known = 0;
+static ALfloat listener_values[LISTENER_VALUES];
+static ALCcontext *shadow_context = NULL;
+static SALAD_shadow_stats_type shadow_stats;
+
+/* The functions the shadow state sits in front of */
+static PFN_alSourcef next_alSourcef = NULL;
+static PFN_alSource3f next_alSource3f = NULL;
+static PFN_alSourcefv next_alSourcefv = NULL;
+static PFN_alSourcei next_alSourcei = NULL;
+static PFN_alSource3i next_alSource3i = NULL;
+static PFN_alSourceiv next_alSourceiv = NULL;
+static PFN_alGetSourcef next_alGetSourcef = NULL;
+static PFN_alGetSource3f next_alGetSource3f = NULL;
+static PFN_alGetSourcefv next_alGetSourcefv = NULL;
+static PFN_alListenerf next_alListenerf = NULL;
+static PFN_alListener3f next_alListener3f = NULL;
+static PFN_alListenerfv next_alListenerfv = NULL;
+static PFN_alListeneri next_alListeneri = NULL;
+static PFN_alListener3i next_alListener3i = NULL;
+static PFN_alListeneriv next_alListeneriv = NULL;
+static PFN_alGetListenerf next_alGetListenerf = NULL;
+static PFN_alGetListener3f next_alGetListener3f = NULL;
+static PFN_alGetListenerfv next_alGetListenerfv = NULL;
+static PFN_alDeleteSources next_alDeleteSources = NULL;
+static PFN_alcMakeContextCurrent next_alcMakeContextCurrent = NULL;
+static PFN_alcDestroyContext next_alcDestroyContext = NULL;
+#if defined(ALC_EXT_thread_local_context)
+static PFN_alcSetThreadContext next_alcSetThreadContext = NULL;
+#endif
+
+/* Parameters are looked up on every call,
+ * a switch beats walking a table by far */
+static const struct shadow_param *source_param(ALenum param)
+{
+    switch(param) {
+        case AL_PITCH:              return &source_params[0];
+        case AL_GAIN:               return &source_params[1];
+        case AL_MIN_GAIN:           return &source_params[2];
+        case AL_MAX_GAIN:           return &source_params[3];
+        case AL_MAX_DISTANCE:       return &source_params[4];
+        case AL_ROLLOFF_FACTOR:     return &source_params[5];
+        case AL_REFERENCE_DISTANCE: return &source_params[6];
+        case AL_CONE_OUTER_GAIN:    return &source_params[7];
+        case AL_CONE_INNER_ANGLE:   return &source_params[8];
+        case AL_CONE_OUTER_ANGLE:   return &source_params[9];
+        case AL_POSITION:           return &source_params[10];
+        case AL_VELOCITY:           return &source_params[11];
+        case AL_DIRECTION:          return &source_params[12];
+    }
+
+    return NULL;
+}
+
+static const struct shadow_param *listener_param(ALenum param)
+{
+    switch(param) {
+        case AL_GAIN:               return &listener_params[0];
+        case AL_POSITION:           return &listener_params[1];
+        case AL_VELOCITY:           return &listener_params[2];
+        case AL_ORIENTATION:        return &listener_params[3];
+    }
+
+    return NULL;
+}
+
+static void forget_everything(void)
+{
+    memset(source_names, 0, sizeof(source_names));
+    memset(source_state, 0, sizeof(source_state));
+    listener_known = 0;
+}
+
+/**
+ * Finds the shadow state of a source
+ * @param name      Source name
+ * @param create    Non-zero to make room for the source if it has none
+ * @returns         The state or NULL if the source has none
+ */
+static struct shadow_source *find_source(ALuint name, int create)
+{
+    unsigned int home = (unsigned int)((name * 2654435761UL) & (SHADOW_SOURCES - 1));
+    unsigned int slot;
+    int i;
+
+    if(name == 0)
+        return NULL;
+
+    for(i = 0; i < SHADOW_PROBES; ++i) {
+        slot = (home + (unsigned int)i) & (SHADOW_SOURCES - 1);
+        if(source_names[slot] == name)
+            return &source_state[slot];
+        if(source_names[slot] == 0 && create)
+            break;
+    }
+
+    if(!create)
+        return NULL;
+
+    /* Either the first free slot or, with
+     * every probe taken, the home slot is reused */
+    if(i == SHADOW_PROBES)
+        slot = home;
+
+    source_names[slot] = name;
+    source_state[slot].known = 0;
+    return &source_state[slot];
+}
+
+/**
+ * Checks a parameter write against the shadow state
+ * and takes it over if it changes anything
+ * @param known     Known parameter bits of the state
+ * @param values    Value array of the state
+ * @param p         Parameter, NULL if it isn't shadowed
+ * @param in        New values
+ * @returns         Zero if the write doesn't change anything and can be skipped
+ */
+static int write_values(unsigned int *known, ALfloat *values, const struct shadow_param *p, const ALfloat *in)
+{
+    int same = 1;
+    int i;
+
+    shadow_stats.writes++;
+
+    if(p == NULL || in == NULL)
+        return 1;
+
+    for(i = 0; i < p->count; ++i)
+        same = same && values[p->index + i] == in[i];
+
+    if(same && (*known & p->bit)) {
+        shadow_stats.skipped_writes++;
+        return 0;
+    }
+
+    /* The driver rejects a value out of range and keeps
+     * whatever it had, which the shadow may not know */
+    for(i = 0; i < p->count; ++i) {
+        if(!(in[i] >= p->min && in[i] <= p->max)) {
+            *known &= ~p->bit;
+            return 1;
+        }
+    }
+
+    for(i = 0; i < p->count; ++i)
+        values[p->index + i] = in[i];
+    *known |= p->bit;
+    return 1;
+}
+
+/**
+ * Answers a parameter read from the shadow state
+ * @param known     Known parameter bits of the state
+ * @param values    Value array of the state
+ * @param p         Parameter, NULL if it isn't shadowed
+ * @param out       Values to fill
+ * @param count     Number of values the getter takes, zero for vectors
+ * @returns         Zero if the driver has to answer it
+ */
+static int read_values(unsigned int known, const ALfloat *values, const struct shadow_param *p, ALfloat *out, int count)
+{
+    int i;
+
+    shadow_stats.reads++;
+
+    if(p == NULL || out == NULL || (count != 0 && count != p->count) || !(known & p->bit))
+        return 0;
+
+    for(i = 0; i < p->count; ++i)
+        out[i] = values[p->index + i];
+
+    shadow_stats.cached_reads++;
+    return 1;
+}
+
+static int write_source(ALuint source, ALenum param, const ALfloat *values)
+{
+    const struct shadow_param *p = source_param(param);
+    struct shadow_source *state = find_source(source, p != NULL);
+
+    if(state == NULL) {
+        shadow_stats.writes++;
+        return 1;
+    }
+
+    return write_values(&state->known, state->values, p, values);
+}
+
+static int read_source(ALuint source, ALenum param, ALfloat *values, int count)
+{
+    struct shadow_source *state = find_source(source, 0);
+
+    if(state == NULL) {
+        shadow_stats.reads++;
+        return 0;
+    }
+
+    return read_values(state->known, state->values, source_param(param), values, count);
+}
+
+/* A parameter set any other way is no longer known */
+static void forget_source_value(ALuint source, ALenum param)
+{
+    const struct shadow_param *p = source_param(param);
+    struct shadow_source *state;
+
+    if(p != NULL && (state = find_source(source, 0)) != NULL)
+        state->known &= ~p->bit;
+}
+
+static void forget_listener_value(ALenum param)
+{
+    const struct shadow_param *p = listener_param(param);
+
+    if(p != NULL)
+        listener_known &= ~p->bit;
+}
+
+static void AL_APIENTRY shadow_alSourcef(ALuint source, ALenum param, ALfloat value)
+{
+    if(write_source(source, param, &value))
+        next_alSourcef(source, param, value);
+}
+
+static void AL_APIENTRY shadow_alSource3f(ALuint source, ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
+{
+    ALfloat values[3];
+
+    values[0] = value1;
+    values[1] = value2;
+    values[2] = value3;
+
+    if(write_source(source, param, values))
+        next_alSource3f(source, param, value1, value2, value3);
+}
+
+static void AL_APIENTRY shadow_alSourcefv(ALuint source, ALenum param, const ALfloat *values)
+{
+    if(write_source(source, param, values))
+        next_alSourcefv(source, param, values);
+}
+
+static void AL_APIENTRY shadow_alSourcei(ALuint source, ALenum param, ALint value)
+{
+    forget_source_value(source, param);
+    next_alSourcei(source, param, value);
+}
+
+static void AL_APIENTRY shadow_alSource3i(ALuint source, ALenum param, ALint value1, ALint value2, ALint value3)
+{
+    forget_source_value(source, param);
+    next_alSource3i(source, param, value1, value2, value3);
+}
+
+static void AL_APIENTRY shadow_alSourceiv(ALuint source, ALenum param, const ALint *values)
+{
+    forget_source_value(source, param);
+    next_alSourceiv(source, param, values);
+}
+
+static void AL_APIENTRY shadow_alGetSourcef(ALuint source, ALenum param, ALfloat *value)
+{
+    if(!read_source(source, param, value, 1))
+        next_alGetSourcef(source, param, value);
+}
+
+static void AL_APIENTRY shadow_alGetSource3f(ALuint source, ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
+{
+    ALfloat values[3];
+
+    if(value1 != NULL && value2 != NULL && value3 != NULL && read_source(source, param, values, 3)) {
+        *value1 = values[0];
+        *value2 = values[1];
+        *value3 = values[2];
+        return;
+    }
+
+    next_alGetSource3f(source, param, value1, value2, value3);
+}
+
+static void AL_APIENTRY shadow_alGetSourcefv(ALuint source, ALenum param, ALfloat *values)
+{
+    if(!read_source(source, param, values, 0))
+        next_alGetSourcefv(source, param, values);
+}
+
+static void AL_APIENTRY shadow_alListenerf(ALenum param, ALfloat value)
+{
+    if(write_values(&listener_known, listener_values, listener_param(param), &value))
+        next_alListenerf(param, value);
+}
+
+static void AL_APIENTRY shadow_alListener3f(ALenum param, ALfloat value1, ALfloat value2, ALfloat value3)
+{
+    ALfloat values[3];
+
+    values[0] = value1;
+    values[1] = value2;
+    values[2] = value3;
+
+    /* The orientation takes six values */
+    if(param == AL_ORIENTATION)
+        shadow_stats.writes++;
+    else if(!write_values(&listener_known, listener_values, listener_param(param), values))
+        return;
+
+    next_alListener3f(param, value1, value2, value3);
+}
+
+static void AL_APIENTRY shadow_alListenerfv(ALenum param, const ALfloat *values)
+{
+    if(write_values(&listener_known, listener_values, listener_param(param), values))
+        next_alListenerfv(param, values);
+}
+
+static void AL_APIENTRY shadow_alListeneri(ALenum param, ALint value)
+{
+    forget_listener_value(param);
+    next_alListeneri(param, value);
+}
+
+static void AL_APIENTRY shadow_alListener3i(ALenum param, ALint value1, ALint value2, ALint value3)
+{
+    forget_listener_value(param);
+    next_alListener3i(param, value1, value2, value3);
+}
+
+static void AL_APIENTRY shadow_alListeneriv(ALenum param, const ALint *values)
+{
+    forget_listener_value(param);
+    next_alListeneriv(param, values);
+}
+
+static void AL_APIENTRY shadow_alGetListenerf(ALenum param, ALfloat *value)
+{
+    if(!read_values(listener_known, listener_values, listener_param(param), value, 1))
+        next_alGetListenerf(param, value);
+}
+
+static void AL_APIENTRY shadow_alGetListener3f(ALenum param, ALfloat *value1, ALfloat *value2, ALfloat *value3)
+{
+    ALfloat values[3];
+
+    if(value1 != NULL && value2 != NULL && value3 != NULL && read_values(listener_known, listener_values, listener_param(param), values, 3)) {
+        *value1 = values[0];
+        *value2 = values[1];
+        *value3 = values[2];
+        return;
+    }
+
+    next_alGetListener3f(param, value1, value2, value3);
+}
+
+static void AL_APIENTRY shadow_alGetListenerfv(ALenum param, ALfloat *values)
+{
+    if(!read_values(listener_known, listener_values, listener_param(param), values, 0))
+        next_alGetListenerfv(param, values);
+}
+
+static void AL_APIENTRY shadow_alDeleteSources(ALsizei n, const ALuint *sources)
+{
+    struct shadow_source *state;
+    ALsizei i;
+
+    /* A deleted name may come back as a new source */
+    for(i = 0; sources != NULL && i < n; ++i) {
+        if((state = find_source(sources[i], 0)) != NULL)
+            state->known = 0;
+    }
+
+    next_alDeleteSources(n, sources);
+}
+
+/* Source names and the listener belong to a context */
+static void switch_context(ALCcontext *context)
+{
+    if(context != shadow_context) {
+        forget_everything();
+        shadow_context = context;
+    }
+}
+
+static ALCboolean ALC_APIENTRY shadow_alcMakeContextCurrent(ALCcontext *context)
+{
+    switch_context(context);
+    return next_alcMakeContextCurrent(context);
+}
+
+#if defined(ALC_EXT_thread_local_context)
+static ALCboolean ALC_APIENTRY shadow_alcSetThreadContext(ALCcontext *context)
+{
+    ALCboolean result = next_alcSetThreadContext(context);
+
+    /* Without a thread context the process-wide one is current
+     * again, so the driver is asked which context calls go to */
+    switch_context(SALAD_alcGetCurrentContext());
+    return result;
+}
+#endif
+
+static void ALC_APIENTRY shadow_alcDestroyContext(ALCcontext *context)
+{
+    if(context == shadow_context) {
+        forget_everything();
+        shadow_context = NULL;
+    }
+
+    next_alcDestroyContext(context);
+}
+
+/* Replaces a global pointer that still holds its lazy trampoline
+ * with the resolved function; the shadowing function keeps whatever
+ * it replaced, so a trampoline kept there would resolve on every call */
+#define SHADOW_RESOLVE(name) \
+    if(SALAD_##name != lazy.name) ((void)(0)); \
+    else if((proc = salad_lazy_resolve(#name)) != NULL) \
+        (void)salad_atomic_cas_ptr(&SALAD_##name, lazy.name, (PFN_##name)proc); \
+    else resolved = 0
+
+/* Swaps a global pointer for its shadowing function */
+#define SHADOW_ENABLE(name) \
+    next_##name = SALAD_##name; \
+    salad_atomic_store_ptr(&SALAD_##name, &shadow_##name)
+
+/* Puts the global pointer back if it still shadows */
+#define SHADOW_DISABLE(name) \
+    if(SALAD_##name == &shadow_##name) \
+        salad_atomic_store_ptr(&SALAD_##name, next_##name); \
+    else ((void)(0))
+
+int saladEnableALshadow(void)
+{
+    SALAD_table_type lazy;
+    void *proc;
+    int resolved = 1;
+
+    if(SALAD_alSourcef == &shadow_alSourcef)
+        return 1;
+
+    if(SALAD_alSourcef == NULL || SALAD_alSource3f == NULL || SALAD_alSourcefv == NULL
+        || SALAD_alSourcei == NULL || SALAD_alSource3i == NULL || SALAD_alSourceiv == NULL
+        || SALAD_alGetSourcef == NULL || SALAD_alGetSource3f == NULL || SALAD_alGetSourcefv == NULL
+        || SALAD_alListenerf == NULL || SALAD_alListener3f == NULL || SALAD_alListenerfv == NULL
+        || SALAD_alListeneri == NULL || SALAD_alListener3i == NULL || SALAD_alListeneriv == NULL
+        || SALAD_alGetListenerf == NULL || SALAD_alGetListener3f == NULL || SALAD_alGetListenerfv == NULL
+        || SALAD_alDeleteSources == NULL || SALAD_alcMakeContextCurrent == NULL || SALAD_alcDestroyContext == NULL
+        || SALAD_alcGetCurrentContext == NULL)
+        return 0;
+
+    salad_install_trampolines(&lazy, SALAD_GROUP_CORE | SALAD_GROUP_ALC);
+    SHADOW_RESOLVE(alSourcef);
+    SHADOW_RESOLVE(alSource3f);
+    SHADOW_RESOLVE(alSourcefv);
+    SHADOW_RESOLVE(alSourcei);
+    SHADOW_RESOLVE(alSource3i);
+    SHADOW_RESOLVE(alSourceiv);
+    SHADOW_RESOLVE(alGetSourcef);
+    SHADOW_RESOLVE(alGetSource3f);
+    SHADOW_RESOLVE(alGetSourcefv);
+    SHADOW_RESOLVE(alListenerf);
+    SHADOW_RESOLVE(alListener3f);
+    SHADOW_RESOLVE(alListenerfv);
+    SHADOW_RESOLVE(alListeneri);
+    SHADOW_RESOLVE(alListener3i);
+    SHADOW_RESOLVE(alListeneriv);
+    SHADOW_RESOLVE(alGetListenerf);
+    SHADOW_RESOLVE(alGetListener3f);
+    SHADOW_RESOLVE(alGetListenerfv);
+    SHADOW_RESOLVE(alDeleteSources);
+    SHADOW_RESOLVE(alcMakeContextCurrent);
+    SHADOW_RESOLVE(alcDestroyContext);
+
+    if(!resolved)
+        return 0;
+
+    forget_everything();
+    shadow_context = SALAD_alcGetCurrentContext();
+
+    SHADOW_ENABLE(alSourcef);
+    SHADOW_ENABLE(alSource3f);
+    SHADOW_ENABLE(alSourcefv);
+    SHADOW_ENABLE(alSourcei);
+    SHADOW_ENABLE(alSource3i);
+    SHADOW_ENABLE(alSourceiv);
+    SHADOW_ENABLE(alGetSourcef);
+    SHADOW_ENABLE(alGetSource3f);
+    SHADOW_ENABLE(alGetSourcefv);
+    SHADOW_ENABLE(alListenerf);
+    SHADOW_ENABLE(alListener3f);
+    SHADOW_ENABLE(alListenerfv);
+    SHADOW_ENABLE(alListeneri);
+    SHADOW_ENABLE(alListener3i);
+    SHADOW_ENABLE(alListeneriv);
+    SHADOW_ENABLE(alGetListenerf);
+    SHADOW_ENABLE(alGetListener3f);
+    SHADOW_ENABLE(alGetListenerfv);
+    SHADOW_ENABLE(alDeleteSources);
+    SHADOW_ENABLE(alcMakeContextCurrent);
+    SHADOW_ENABLE(alcDestroyContext);
+#if defined(ALC_EXT_thread_local_context)
+    if(SALAD_alcSetThreadContext != NULL) {
+        SHADOW_ENABLE(alcSetThreadContext);
+    }
+#endif
+
+    return 1;
+}
+
+void saladDisableALshadow(void)
+{
+    SHADOW_DISABLE(alSourcef);
+    SHADOW_DISABLE(alSource3f);
+    SHADOW_DISABLE(alSourcefv);
+    SHADOW_DISABLE(alSourcei);
+    SHADOW_DISABLE(alSource3i);
+    SHADOW_DISABLE(alSourceiv);
+    SHADOW_DISABLE(alGetSourcef);
+    SHADOW_DISABLE(alGetSource3f);
+    SHADOW_DISABLE(alGetSourcefv);
+    SHADOW_DISABLE(alListenerf);
+    SHADOW_DISABLE(alListener3f);
+    SHADOW_DISABLE(alListenerfv);
+    SHADOW_DISABLE(alListeneri);
+    SHADOW_DISABLE(alListener3i);
+    SHADOW_DISABLE(alListeneriv);
+    SHADOW_DISABLE(alGetListenerf);
+    SHADOW_DISABLE(alGetListener3f);
+    SHADOW_DISABLE(alGetListenerfv);
+    SHADOW_DISABLE(alDeleteSources);
+    SHADOW_DISABLE(alcMakeContextCurrent);
+    SHADOW_DISABLE(alcDestroyContext);
+#if defined(ALC_EXT_thread_local_context)
+    SHADOW_DISABLE(alcSetThreadContext);
+#endif
+}
+
+#else
+/* The al* macros call the linked library
+ * directly, there are no pointers to shadow */
+static SALAD_shadow_stats_type shadow_stats;
+
+int saladEnableALshadow(void)
+{
+    return 0;
+}
+
+void saladDisableALshadow(void)
+{
+}
+#endif /* SALAD_DIRECT_LINK */
+
+void saladGetALshadowStats(SALAD_shadow_stats_type *stats)
+{
+    *stats = shadow_stats;
+}
+
+void saladResetALshadowStats(void)
+{
+    memset(&shadow_stats, 0, sizeof(shadow_stats));
+}
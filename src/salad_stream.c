@@ -0,0 +1,752 @@
+/*
+ * salad_stream.c - Background streaming through buffer queues
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <AL/salad_stream.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <AL/alext.h>
+#include <AL/salad_table.h>
+
+#include "salad_platform.h"
+
+#if SALAD_POSIX
+#include <time.h>
+#endif
+
+#define STREAM_PERIOD       10
+
+/* Without AL_SOFT_callback_buffer a ring stream is
+ * played through this many blocks of a quarter of the ring */
+#define STREAM_RING_BLOCKS  3
+
+#define STREAM_STOPPED      0
+#define STREAM_STARTING     1   /* Waiting for the worker to fill the ring */
+#define STREAM_PLAYING      2
+#define STREAM_DRAINING     3   /* Ended by the callback, playing what's queued */
+
+/* The functions the worker calls, read once per wakeup so
+ * that the global pointers are picked up again after reloading */
+struct stream_procs {
+    PFN_alGenBuffers alGenBuffers;
+    PFN_alDeleteBuffers alDeleteBuffers;
+    PFN_alBufferData alBufferData;
+    PFN_alSourceQueueBuffers alSourceQueueBuffers;
+    PFN_alSourceUnqueueBuffers alSourceUnqueueBuffers;
+    PFN_alGetSourcei alGetSourcei;
+    PFN_alSourcei alSourcei;
+    PFN_alSourcePlay alSourcePlay;
+    PFN_alSourceStop alSourceStop;
+    PFN_alGetError alGetError;
+    PFN_alIsExtensionPresent alIsExtensionPresent;
+#if defined(AL_SOFT_callback_buffer)
+    PFN_alBufferCallbackSOFT alBufferCallbackSOFT;
+#endif
+};
+
+struct SALAD_stream {
+    SALAD_streamer_type *streamer;
+    ALuint source;
+    ALenum format;
+    ALsizei frequency;
+    ALsizei size;
+    ALsizei count;
+    ALuint *buffers;            /* Every buffer of the ring */
+    ALuint *free;               /* Buffers that aren't queued */
+    ALsizei num_free;
+    SALAD_stream_callback_type callback;
+    void *arg;
+    int state;
+    ALsizei index;              /* Within the streams of the streamer */
+    unsigned long blocks;
+    unsigned long bytes;
+    unsigned long underruns;
+
+    /* A ring stream has a single producer writing the
+     * ring and a single consumer reading it, which is either
+     * the driver's mixer or the worker; the positions are
+     * only ever touched atomically and never need the lock */
+    char *ring;
+    int ring_size;
+    int ring_read;
+    int ring_write;
+    int ring_underruns;
+    int frame_size;
+    int silence;
+    int direct;                 /* Pulled straight by the driver */
+};
+
+/* Everything but the thread handle is
+ * guarded by the mutex, including the streams */
+struct SALAD_streamer {
+    const SALAD_table_type *table;
+    ALuint period;
+    salad_mutex_type mutex;
+    salad_cond_type wake;
+    salad_thread_type thread;
+    int quit;
+    SALAD_stream_type **streams;
+    ALsizei num_streams;
+    ALsizei max_streams;
+    void *block;                /* Callbacks write here */
+    ALsizei block_size;
+};
+
+static int get_procs(const SALAD_streamer_type *streamer, struct stream_procs *procs)
+{
+    const SALAD_table_type *table = streamer->table;
+
+    if(table != NULL) {
+        procs->alGenBuffers = table->alGenBuffers;
+        procs->alDeleteBuffers = table->alDeleteBuffers;
+        procs->alBufferData = table->alBufferData;
+        procs->alSourceQueueBuffers = table->alSourceQueueBuffers;
+        procs->alSourceUnqueueBuffers = table->alSourceUnqueueBuffers;
+        procs->alGetSourcei = table->alGetSourcei;
+        procs->alSourcei = table->alSourcei;
+        procs->alSourcePlay = table->alSourcePlay;
+        procs->alSourceStop = table->alSourceStop;
+        procs->alGetError = table->alGetError;
+        procs->alIsExtensionPresent = table->alIsExtensionPresent;
+#if defined(AL_SOFT_callback_buffer)
+        procs->alBufferCallbackSOFT = table->alBufferCallbackSOFT;
+#endif
+    }
+    else {
+#if defined(SALAD_DIRECT_LINK)
+        procs->alGenBuffers = &alGenBuffers;
+        procs->alDeleteBuffers = &alDeleteBuffers;
+        procs->alBufferData = &alBufferData;
+        procs->alSourceQueueBuffers = &alSourceQueueBuffers;
+        procs->alSourceUnqueueBuffers = &alSourceUnqueueBuffers;
+        procs->alGetSourcei = &alGetSourcei;
+        procs->alSourcei = &alSourcei;
+        procs->alSourcePlay = &alSourcePlay;
+        procs->alSourceStop = &alSourceStop;
+        procs->alGetError = &alGetError;
+        procs->alIsExtensionPresent = &alIsExtensionPresent;
+#if defined(AL_SOFT_callback_buffer)
+        procs->alBufferCallbackSOFT = &alBufferCallbackSOFT;
+#endif
+#else
+        procs->alGenBuffers = SALAD_alGenBuffers;
+        procs->alDeleteBuffers = SALAD_alDeleteBuffers;
+        procs->alBufferData = SALAD_alBufferData;
+        procs->alSourceQueueBuffers = SALAD_alSourceQueueBuffers;
+        procs->alSourceUnqueueBuffers = SALAD_alSourceUnqueueBuffers;
+        procs->alGetSourcei = SALAD_alGetSourcei;
+        procs->alSourcei = SALAD_alSourcei;
+        procs->alSourcePlay = SALAD_alSourcePlay;
+        procs->alSourceStop = SALAD_alSourceStop;
+        procs->alGetError = SALAD_alGetError;
+        procs->alIsExtensionPresent = SALAD_alIsExtensionPresent;
+#if defined(AL_SOFT_callback_buffer)
+        procs->alBufferCallbackSOFT = SALAD_alBufferCallbackSOFT;
+#endif
+#endif
+    }
+
+    return procs->alGenBuffers != NULL && procs->alDeleteBuffers != NULL && procs->alBufferData != NULL
+        && procs->alSourceQueueBuffers != NULL && procs->alSourceUnqueueBuffers != NULL && procs->alGetSourcei != NULL
+        && procs->alSourcei != NULL && procs->alSourcePlay != NULL && procs->alSourceStop != NULL && procs->alGetError != NULL
+        && procs->alIsExtensionPresent != NULL;
+}
+
+static int format_frame_size(ALenum format)
+{
+    switch(format) {
+        case AL_FORMAT_MONO8:       return 1;
+        case AL_FORMAT_MONO16:      return 2;
+        case AL_FORMAT_STEREO8:     return 2;
+        case AL_FORMAT_STEREO16:    return 4;
+#if defined(AL_EXT_float32)
+        case AL_FORMAT_MONO_FLOAT32:    return 4;
+        case AL_FORMAT_STEREO_FLOAT32:  return 8;
+#endif
+#if defined(AL_EXT_MCFORMATS)
+        case AL_FORMAT_QUAD8:       return 4;
+        case AL_FORMAT_QUAD16:      return 8;
+        case AL_FORMAT_QUAD32:      return 16;
+        case AL_FORMAT_REAR8:       return 2;
+        case AL_FORMAT_REAR16:      return 4;
+        case AL_FORMAT_REAR32:      return 8;
+        case AL_FORMAT_51CHN8:      return 6;
+        case AL_FORMAT_51CHN16:     return 12;
+        case AL_FORMAT_51CHN32:     return 24;
+        case AL_FORMAT_61CHN8:      return 7;
+        case AL_FORMAT_61CHN16:     return 14;
+        case AL_FORMAT_61CHN32:     return 28;
+        case AL_FORMAT_71CHN8:      return 8;
+        case AL_FORMAT_71CHN16:     return 16;
+        case AL_FORMAT_71CHN32:     return 32;
+#endif
+    }
+
+    return 0;
+}
+
+/* Unsigned 8-bit samples are silent at their midpoint */
+static int format_silence(ALenum format)
+{
+    switch(format) {
+        case AL_FORMAT_MONO8:
+        case AL_FORMAT_STEREO8:
+#if defined(AL_EXT_MCFORMATS)
+        case AL_FORMAT_QUAD8:
+        case AL_FORMAT_REAR8:
+        case AL_FORMAT_51CHN8:
+        case AL_FORMAT_61CHN8:
+        case AL_FORMAT_71CHN8:
+#endif
+            return 0x80;
+    }
+
+    return 0;
+}
+
+/**
+ * Reads a ring stream, padding whatever the producer
+ * hasn't written yet with silence so that neither the driver
+ * nor the worker take a short read for the end of the stream
+ * @param stream    Ring stream to read
+ * @param data      Bytes to fill
+ * @param size      Number of bytes, a whole number of frames
+ * @returns         Always size
+ */
+static ALsizei read_ring(SALAD_stream_type *stream, char *data, ALsizei size)
+{
+    int read = stream->ring_read;
+    int write = salad_atomic_load_int(&stream->ring_write);
+    int available = (write >= read) ? write - read : stream->ring_size - read + write;
+    int count = (available < (int)size) ? available : (int)size;
+    int first = stream->ring_size - read;
+
+    if(first > count)
+        first = count;
+
+    memcpy(data, &stream->ring[read], (size_t)first);
+    memcpy(&data[first], stream->ring, (size_t)(count - first));
+    salad_atomic_store_int(&stream->ring_read, (read + count) % stream->ring_size);
+
+    if(count < (int)size) {
+        memset(&data[count], stream->silence, (size_t)((int)size - count));
+        salad_atomic_store_int(&stream->ring_underruns, stream->ring_underruns + 1);
+    }
+
+    return size;
+}
+
+static ALsizei SALAD_APIENTRY pull_ring(void *data, ALsizei size, void *arg)
+{
+    return read_ring((SALAD_stream_type *)arg, (char *)data, size);
+}
+
+#if defined(AL_SOFT_callback_buffer)
+static ALsizei AL_APIENTRY driver_pull_ring(ALvoid *userptr, ALvoid *data, ALsizei size)
+{
+    return read_ring((SALAD_stream_type *)userptr, (char *)data, size);
+}
+#endif
+
+/**
+ * Pulls blocks from the callback into every buffer
+ * that isn't queued and queues them, oldest first
+ * @param stream    Stream to fill
+ * @param procs     Functions to call
+ */
+static void fill_stream(SALAD_stream_type *stream, const struct stream_procs *procs)
+{
+    SALAD_streamer_type *streamer = stream->streamer;
+    ALsizei bytes;
+    ALuint buffer;
+
+    while(stream->num_free != 0 && stream->state != STREAM_DRAINING) {
+        bytes = stream->callback(streamer->block, stream->size, stream->arg);
+        if(bytes < 0)
+            bytes = 0;
+        if(bytes > stream->size)
+            bytes = stream->size;
+
+        if(bytes < stream->size)
+            stream->state = STREAM_DRAINING;
+
+        if(bytes != 0) {
+            buffer = stream->free[--stream->num_free];
+            procs->alBufferData(buffer, stream->format, streamer->block, bytes, stream->frequency);
+            procs->alSourceQueueBuffers(stream->source, 1, &buffer);
+            stream->blocks++;
+            stream->bytes += (unsigned long)bytes;
+        }
+    }
+}
+
+/**
+ * Unqueues what has been played, refills it and restarts
+ * the source if it ran dry; a stream that needs nothing costs a
+ * single AL_BUFFERS_PROCESSED query, which is what lets one
+ * worker keep up with hundreds of them
+ * @param stream    Stream to service
+ * @param procs     Functions to call
+ */
+static void service_stream(SALAD_stream_type *stream, const struct stream_procs *procs)
+{
+    ALsizei queued = stream->count - stream->num_free;
+    ALint processed = 0;
+
+    if(stream->state == STREAM_STOPPED || stream->direct)
+        return;
+
+    if(stream->state == STREAM_STARTING) {
+        stream->state = STREAM_PLAYING;
+        fill_stream(stream, procs);
+        if(stream->num_free != stream->count)
+            procs->alSourcePlay(stream->source);
+        else stream->state = STREAM_STOPPED;
+        return;
+    }
+
+    procs->alGetSourcei(stream->source, AL_BUFFERS_PROCESSED, &processed);
+    if(processed <= 0)
+        return;
+    if(processed > queued)
+        processed = queued;
+
+    procs->alSourceUnqueueBuffers(stream->source, processed, &stream->free[stream->num_free]);
+    stream->num_free += processed;
+
+    fill_stream(stream, procs);
+
+    /* Once everything that was queued has been played
+     * the source has stopped and has to be started again */
+    if(processed == queued) {
+        if(stream->num_free == stream->count) {
+            stream->state = STREAM_STOPPED;
+            return;
+        }
+
+        stream->underruns++;
+        procs->alSourcePlay(stream->source);
+    }
+}
+
+/* Stops the source right away and takes every buffer back */
+static void stop_stream(SALAD_stream_type *stream, const struct stream_procs *procs)
+{
+    ALsizei i;
+
+    procs->alSourceStop(stream->source);
+    procs->alSourcei(stream->source, AL_BUFFER, 0);
+
+    for(i = 0; i < stream->count; ++i)
+        stream->free[i] = stream->buffers[i];
+    stream->num_free = stream->count;
+    stream->state = STREAM_STOPPED;
+}
+
+/* Waits for a period or a wakeup, whichever comes first */
+static void wait_period(SALAD_streamer_type *streamer)
+{
+#if SALAD_POSIX
+    struct timespec deadline;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += (time_t)(streamer->period / 1000);
+    deadline.tv_nsec += (long)(streamer->period % 1000) * 1000000L;
+    if(deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_cond_timedwait(&streamer->wake, &streamer->mutex, &deadline);
+#elif SALAD_WIN32
+    SleepConditionVariableSRW(&streamer->wake, &streamer->mutex, (DWORD)streamer->period, 0);
+#endif
+}
+
+static salad_thread_result_type SALAD_THREAD_APIENTRY stream_worker(void *arg)
+{
+    SALAD_streamer_type *streamer = (SALAD_streamer_type *)arg;
+    struct stream_procs procs;
+    ALsizei i;
+
+    salad_mutex_lock(&streamer->mutex);
+
+    while(!streamer->quit) {
+        if(get_procs(streamer, &procs)) {
+            for(i = 0; i < streamer->num_streams; ++i)
+                service_stream(streamer->streams[i], &procs);
+        }
+
+        wait_period(streamer);
+    }
+
+    salad_mutex_unlock(&streamer->mutex);
+    return (salad_thread_result_type)0;
+}
+
+static SALAD_streamer_type *create_streamer(const SALAD_table_type *table, ALuint period)
+{
+    SALAD_streamer_type *streamer;
+
+    if((streamer = (SALAD_streamer_type *)calloc(1, sizeof(SALAD_streamer_type))) == NULL)
+        return NULL;
+
+    streamer->table = table;
+    streamer->period = (period != 0) ? period : STREAM_PERIOD;
+    salad_mutex_init(&streamer->mutex);
+    salad_cond_init(&streamer->wake);
+
+    if(!salad_thread_create(&streamer->thread, &stream_worker, streamer)) {
+        salad_cond_destroy(&streamer->wake);
+        salad_mutex_destroy(&streamer->mutex);
+        free(streamer);
+        return NULL;
+    }
+
+    return streamer;
+}
+
+SALAD_streamer_type *saladCreateALstreamer(ALuint period)
+{
+    return create_streamer(NULL, period);
+}
+
+SALAD_streamer_type *saladCreateALtableStreamer(const SALAD_table_type *table, ALuint period)
+{
+    if(table == NULL)
+        return NULL;
+    return create_streamer(table, period);
+}
+
+void saladDestroyALstreamer(SALAD_streamer_type *streamer)
+{
+    if(streamer == NULL)
+        return;
+
+    salad_mutex_lock(&streamer->mutex);
+    streamer->quit = 1;
+    salad_cond_signal(&streamer->wake);
+    salad_mutex_unlock(&streamer->mutex);
+
+    salad_thread_join(streamer->thread);
+
+    while(streamer->num_streams != 0)
+        saladDeleteALstream(streamer->streams[streamer->num_streams - 1]);
+
+    salad_cond_destroy(&streamer->wake);
+    salad_mutex_destroy(&streamer->mutex);
+    free(streamer->streams);
+    free(streamer->block);
+    free(streamer);
+}
+
+/**
+ * Makes room for one more stream with blocks of the
+ * given size; must be called with the streamer locked
+ * @param streamer  Streamer to grow
+ * @param size      Block size of the stream
+ * @returns         Zero if out of memory
+ */
+static int reserve_stream(SALAD_streamer_type *streamer, ALsizei size)
+{
+    SALAD_stream_type **streams;
+    void *block;
+    ALsizei max_streams;
+
+    if(streamer->num_streams == streamer->max_streams) {
+        max_streams = (streamer->max_streams != 0) ? streamer->max_streams * 2 : 16;
+        if((streams = (SALAD_stream_type **)realloc(streamer->streams, (size_t)max_streams * sizeof(SALAD_stream_type *))) == NULL)
+            return 0;
+        streamer->streams = streams;
+        streamer->max_streams = max_streams;
+    }
+
+    if(size > streamer->block_size) {
+        if((block = realloc(streamer->block, (size_t)size)) == NULL)
+            return 0;
+        streamer->block = block;
+        streamer->block_size = size;
+    }
+
+    return 1;
+}
+
+/**
+ * Creates a stopped stream with its ring of buffers
+ * and hands it to the streamer
+ * @param streamer  Streamer to feed the stream
+ * @param source    Source to play on
+ * @param format    Format of the data, AL_FORMAT_*
+ * @param frequency Sample rate of the data
+ * @param size      Bytes per block
+ * @param count     Number of buffers
+ * @param ring      Size of the ring of a ring stream, zero for none
+ * @returns         The stream, NULL on failure
+ */
+static SALAD_stream_type *create_stream(SALAD_streamer_type *streamer, ALuint source, ALenum format, ALsizei frequency, ALsizei size, ALsizei count, ALsizei ring)
+{
+    SALAD_stream_type *stream;
+    struct stream_procs procs;
+    ALsizei i;
+
+    if(!get_procs(streamer, &procs))
+        return NULL;
+
+    if((stream = (SALAD_stream_type *)calloc(1, sizeof(SALAD_stream_type))) == NULL)
+        return NULL;
+
+    stream->buffers = (ALuint *)calloc((size_t)count * 2, sizeof(ALuint));
+    stream->ring = (ring != 0) ? (char *)malloc((size_t)ring) : NULL;
+    if(stream->buffers == NULL || (ring != 0 && stream->ring == NULL)) {
+        free(stream->buffers);
+        free(stream->ring);
+        free(stream);
+        return NULL;
+    }
+
+    procs.alGetError();
+    procs.alGenBuffers(count, stream->buffers);
+    if(procs.alGetError() != AL_NO_ERROR) {
+        free(stream->buffers);
+        free(stream->ring);
+        free(stream);
+        return NULL;
+    }
+
+    stream->streamer = streamer;
+    stream->source = source;
+    stream->format = format;
+    stream->frequency = frequency;
+    stream->size = size;
+    stream->count = count;
+    stream->free = &stream->buffers[count];
+    stream->state = STREAM_STOPPED;
+    stream->ring_size = (int)ring;
+
+    for(i = 0; i < count; ++i)
+        stream->free[i] = stream->buffers[i];
+    stream->num_free = count;
+
+    procs.alSourceStop(source);
+    procs.alSourcei(source, AL_BUFFER, 0);
+    procs.alSourcei(source, AL_LOOPING, AL_FALSE);
+
+    salad_mutex_lock(&streamer->mutex);
+    if(!reserve_stream(streamer, size)) {
+        salad_mutex_unlock(&streamer->mutex);
+        procs.alDeleteBuffers(count, stream->buffers);
+        free(stream->buffers);
+        free(stream->ring);
+        free(stream);
+        return NULL;
+    }
+
+    stream->index = streamer->num_streams;
+    streamer->streams[streamer->num_streams++] = stream;
+    salad_mutex_unlock(&streamer->mutex);
+
+    return stream;
+}
+
+SALAD_stream_type *saladCreateALstream(SALAD_streamer_type *streamer, ALuint source, ALenum format, ALsizei frequency, ALsizei size, ALsizei count, SALAD_stream_callback_type callback, void *arg)
+{
+    SALAD_stream_type *stream;
+
+    if(streamer == NULL || size <= 0 || count < 2 || callback == NULL)
+        return NULL;
+
+    if((stream = create_stream(streamer, source, format, frequency, size, count, 0)) != NULL) {
+        stream->callback = callback;
+        stream->arg = arg;
+    }
+
+    return stream;
+}
+
+SALAD_stream_type *saladCreateALringStream(SALAD_streamer_type *streamer, ALuint source, ALenum format, ALsizei frequency, ALsizei size)
+{
+    SALAD_stream_type *stream;
+    struct stream_procs procs;
+    int frame_size = format_frame_size(format);
+    ALsizei block;
+
+    if(streamer == NULL || frame_size == 0 || !get_procs(streamer, &procs))
+        return NULL;
+
+    /* One frame of the ring always stays empty
+     * to tell a full ring from an empty one */
+    size = (size / frame_size + 1) * frame_size;
+    block = (size / 4) / frame_size * frame_size;
+    if(block == 0)
+        return NULL;
+
+#if defined(AL_SOFT_callback_buffer)
+    if(procs.alBufferCallbackSOFT != NULL && procs.alIsExtensionPresent((const ALchar *)"AL_SOFT_callback_buffer")) {
+        if((stream = create_stream(streamer, source, format, frequency, block, 1, size)) == NULL)
+            return NULL;
+
+        stream->frame_size = frame_size;
+        stream->silence = format_silence(format);
+
+        procs.alGetError();
+        procs.alBufferCallbackSOFT(stream->buffers[0], format, frequency, &driver_pull_ring, stream);
+        if(procs.alGetError() == AL_NO_ERROR) {
+            stream->direct = 1;
+            return stream;
+        }
+
+        saladDeleteALstream(stream);
+    }
+#endif
+
+    if((stream = create_stream(streamer, source, format, frequency, block, STREAM_RING_BLOCKS, size)) == NULL)
+        return NULL;
+
+    stream->frame_size = frame_size;
+    stream->silence = format_silence(format);
+    stream->callback = &pull_ring;
+    stream->arg = stream;
+    return stream;
+}
+
+ALsizei saladWriteALstream(SALAD_stream_type *stream, const ALvoid *data, ALsizei size)
+{
+    int write, read, count, first;
+
+    if(stream->ring == NULL || size <= 0)
+        return 0;
+
+    write = stream->ring_write;
+    read = salad_atomic_load_int(&stream->ring_read);
+    count = ((read > write) ? read - write : stream->ring_size - write + read) - stream->frame_size;
+    if(count > (int)size)
+        count = (int)size;
+    count -= count % stream->frame_size;
+    if(count <= 0)
+        return 0;
+
+    first = stream->ring_size - write;
+    if(first > count)
+        first = count;
+
+    memcpy(&stream->ring[write], data, (size_t)first);
+    memcpy(stream->ring, (const char *)data + first, (size_t)(count - first));
+    salad_atomic_store_int(&stream->ring_write, (write + count) % stream->ring_size);
+
+    return (ALsizei)count;
+}
+
+ALboolean saladIsALstreamDirect(SALAD_stream_type *stream)
+{
+    return stream->direct ? AL_TRUE : AL_FALSE;
+}
+
+void saladDeleteALstream(SALAD_stream_type *stream)
+{
+    SALAD_streamer_type *streamer;
+    struct stream_procs procs;
+
+    if(stream == NULL)
+        return;
+
+    streamer = stream->streamer;
+    salad_mutex_lock(&streamer->mutex);
+
+    if(get_procs(streamer, &procs)) {
+        stop_stream(stream, &procs);
+        procs.alDeleteBuffers(stream->count, stream->buffers);
+    }
+
+    /* The last stream takes the place of the deleted one */
+    streamer->streams[stream->index] = streamer->streams[--streamer->num_streams];
+    streamer->streams[stream->index]->index = stream->index;
+
+    salad_mutex_unlock(&streamer->mutex);
+
+    free(stream->buffers);
+    free(stream->ring);
+    free(stream);
+}
+
+void saladPlayALstream(SALAD_stream_type *stream)
+{
+    SALAD_streamer_type *streamer = stream->streamer;
+
+    struct stream_procs procs;
+
+    salad_mutex_lock(&streamer->mutex);
+    if(stream->state == STREAM_STOPPED && stream->direct) {
+        /* The driver pulls on its own, nothing to wake */
+        if(get_procs(streamer, &procs)) {
+            procs.alSourcei(stream->source, AL_BUFFER, (ALint)stream->buffers[0]);
+            procs.alSourcePlay(stream->source);
+            stream->state = STREAM_PLAYING;
+        }
+    }
+    else if(stream->state == STREAM_STOPPED) {
+        stream->state = STREAM_STARTING;
+        salad_cond_signal(&streamer->wake);
+    }
+    salad_mutex_unlock(&streamer->mutex);
+}
+
+void saladStopALstream(SALAD_stream_type *stream)
+{
+    SALAD_streamer_type *streamer = stream->streamer;
+    struct stream_procs procs;
+
+    salad_mutex_lock(&streamer->mutex);
+    if(stream->state != STREAM_STOPPED && get_procs(streamer, &procs))
+        stop_stream(stream, &procs);
+    salad_mutex_unlock(&streamer->mutex);
+}
+
+ALboolean saladIsALstreamPlaying(SALAD_stream_type *stream)
+{
+    SALAD_streamer_type *streamer = stream->streamer;
+    ALboolean playing;
+
+    salad_mutex_lock(&streamer->mutex);
+    playing = (stream->state != STREAM_STOPPED) ? AL_TRUE : AL_FALSE;
+    salad_mutex_unlock(&streamer->mutex);
+
+    return playing;
+}
+
+void saladGetALstreamStats(SALAD_stream_type *stream, SALAD_stream_stats_type *stats)
+{
+    SALAD_streamer_type *streamer = stream->streamer;
+
+    salad_mutex_lock(&streamer->mutex);
+    stats->blocks = stream->blocks;
+    stats->bytes = stream->bytes;
+    stats->underruns = stream->underruns + (unsigned long)salad_atomic_load_int(&stream->ring_underruns);
+    salad_mutex_unlock(&streamer->mutex);
+}
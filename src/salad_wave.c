@@ -0,0 +1,443 @@
+/*
+ * salad_wave.c - Memory-mapped WAV files
+ * Copyright (C) 2026, Kirill Dmitrievich
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <AL/salad_wave.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <AL/alext.h>
+#include <AL/salad_convert.h>
+#include <AL/salad_resample.h>
+#include <AL/salad_table.h>
+
+#include "salad_platform.h"
+
+#if SALAD_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define WAVE_FORMAT_PCM         0x0001
+#define WAVE_FORMAT_EXTENSIBLE  0xFFFE
+
+/* Frames decoded and resampled at a time */
+#define WAVE_BLOCK              4096
+
+struct wave_procs {
+    PFN_alBufferData alBufferData;
+    PFN_alGetError alGetError;
+    PFN_alIsExtensionPresent alIsExtensionPresent;
+#if defined(AL_EXT_STATIC_BUFFER)
+    PFN_alBufferDataStatic alBufferDataStatic;
+#endif
+};
+
+struct SALAD_wave {
+    void *map;
+    size_t map_size;
+    SALAD_wave_info_type info;
+};
+
+/* The sub-format GUID of WAVE_FORMAT_EXTENSIBLE after
+ * its first two bytes, which hold the actual format tag */
+static const unsigned char guid_suffix[14] = { 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 };
+
+static int get_procs(const SALAD_table_type *table, struct wave_procs *procs)
+{
+    if(table != NULL) {
+        procs->alBufferData = table->alBufferData;
+        procs->alGetError = table->alGetError;
+        procs->alIsExtensionPresent = table->alIsExtensionPresent;
+#if defined(AL_EXT_STATIC_BUFFER)
+        procs->alBufferDataStatic = table->alBufferDataStatic;
+#endif
+    }
+    else {
+#if defined(SALAD_DIRECT_LINK)
+        procs->alBufferData = &alBufferData;
+        procs->alGetError = &alGetError;
+        procs->alIsExtensionPresent = &alIsExtensionPresent;
+#if defined(AL_EXT_STATIC_BUFFER)
+        procs->alBufferDataStatic = &alBufferDataStatic;
+#endif
+#else
+        procs->alBufferData = SALAD_alBufferData;
+        procs->alGetError = SALAD_alGetError;
+        procs->alIsExtensionPresent = SALAD_alIsExtensionPresent;
+#if defined(AL_EXT_STATIC_BUFFER)
+        procs->alBufferDataStatic = SALAD_alBufferDataStatic;
+#endif
+#endif
+    }
+
+    return procs->alBufferData != NULL && procs->alGetError != NULL && procs->alIsExtensionPresent != NULL;
+}
+
+static unsigned long get_u16(const unsigned char *bytes)
+{
+    return (unsigned long)bytes[0] | ((unsigned long)bytes[1] << 8);
+}
+
+static unsigned long get_u32(const unsigned char *bytes)
+{
+    return get_u16(bytes) | (get_u16(&bytes[2]) << 16);
+}
+
+static int is_big_endian(void)
+{
+    static const union { unsigned short value; unsigned char bytes[2]; } order = { 1 };
+    return order.bytes[0] == 0;
+}
+
+/**
+ * Checks the fmt chunk of a WAV file
+ * @param fmt       Contents of the chunk
+ * @param size      Size of the chunk, at least 16 bytes
+ * @param info      Gets the format and frequency on success
+ * @returns         Bytes per frame, zero if the format isn't supported
+ */
+static unsigned long parse_format(const unsigned char *fmt, size_t size, SALAD_wave_info_type *info)
+{
+    unsigned long tag = get_u16(fmt);
+    unsigned long channels = get_u16(&fmt[2]);
+    unsigned long frequency = get_u32(&fmt[4]);
+    unsigned long block_align = get_u16(&fmt[12]);
+    unsigned long bits = get_u16(&fmt[14]);
+
+    /* Only the tag is taken from the sub-format and
+     * samples must fill their containers exactly */
+    if(tag == WAVE_FORMAT_EXTENSIBLE) {
+        if(size < 40 || get_u16(&fmt[16]) < 22 || get_u16(&fmt[18]) != bits || memcmp(&fmt[26], guid_suffix, sizeof(guid_suffix)) != 0)
+            return 0;
+        tag = get_u16(&fmt[24]);
+    }
+
+    if(tag != WAVE_FORMAT_PCM || frequency == 0 || frequency > INT_MAX || block_align != channels * (bits / 8))
+        return 0;
+
+    if(channels == 1 && bits == 8)
+        info->format = AL_FORMAT_MONO8;
+    else if(channels == 1 && bits == 16)
+        info->format = AL_FORMAT_MONO16;
+    else if(channels == 2 && bits == 8)
+        info->format = AL_FORMAT_STEREO8;
+    else if(channels == 2 && bits == 16)
+        info->format = AL_FORMAT_STEREO16;
+    else return 0;
+
+    info->frequency = (ALsizei)frequency;
+    return block_align;
+}
+
+int saladParseALwave(const void *data, size_t size, SALAD_wave_info_type *info)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    unsigned long frame_size = 0;
+    size_t chunk_size;
+    size_t pos;
+
+    if(data == NULL || info == NULL || size < 12 || memcmp(bytes, "RIFF", 4) != 0 || memcmp(&bytes[8], "WAVE", 4) != 0)
+        return 0;
+
+    /* The RIFF size is often wrong, the chunks
+     * are walked up to the end of the image instead */
+    for(pos = 12; size - pos >= 8; pos += chunk_size + (chunk_size & 1)) {
+        chunk_size = (size_t)get_u32(&bytes[pos + 4]);
+        pos += 8;
+
+        if(memcmp(&bytes[pos - 8], "fmt ", 4) == 0) {
+            if(chunk_size < 16 || chunk_size > size - pos)
+                return 0;
+            if((frame_size = parse_format(&bytes[pos], chunk_size, info)) == 0)
+                return 0;
+        }
+        else if(memcmp(&bytes[pos - 8], "data", 4) == 0) {
+            if(frame_size == 0)
+                return 0;
+
+            if(chunk_size > size - pos)
+                chunk_size = size - pos;
+            chunk_size -= chunk_size % frame_size;
+            if(chunk_size > INT_MAX)
+                return 0;
+
+            info->size = (ALsizei)chunk_size;
+            info->frames = (ALsizei)(chunk_size / frame_size);
+            info->data = &bytes[pos];
+            return 1;
+        }
+
+        if(chunk_size >= size - pos)
+            break;
+    }
+
+    return 0;
+}
+
+SALAD_wave_type *saladOpenALwave(const char *path)
+{
+    SALAD_wave_type *wave;
+#if SALAD_POSIX
+    struct stat st;
+    int fd;
+#elif SALAD_WIN32
+    LARGE_INTEGER file_size;
+    HANDLE file;
+    HANDLE mapping;
+#endif
+
+    if(path == NULL || (wave = (SALAD_wave_type *)calloc(1, sizeof(SALAD_wave_type))) == NULL)
+        return NULL;
+
+#if SALAD_POSIX
+    if((fd = open(path, O_RDONLY)) < 0) {
+        free(wave);
+        return NULL;
+    }
+
+    if(fstat(fd, &st) != 0 || st.st_size <= 0 || (unsigned long)st.st_size > (size_t)-1) {
+        close(fd);
+        free(wave);
+        return NULL;
+    }
+
+    wave->map_size = (size_t)st.st_size;
+    wave->map = mmap(NULL, wave->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if(wave->map == MAP_FAILED) {
+        free(wave);
+        return NULL;
+    }
+
+    /* Uploading reads the samples front to back once */
+    posix_madvise(wave->map, wave->map_size, POSIX_MADV_SEQUENTIAL);
+#elif SALAD_WIN32
+    if((file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL)) == INVALID_HANDLE_VALUE) {
+        free(wave);
+        return NULL;
+    }
+
+    if(!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0 || (unsigned __int64)file_size.QuadPart > (size_t)-1) {
+        CloseHandle(file);
+        free(wave);
+        return NULL;
+    }
+
+    /* The view keeps the mapping and the file alive */
+    wave->map_size = (size_t)file_size.QuadPart;
+    mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    wave->map = (mapping != NULL) ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if(mapping != NULL)
+        CloseHandle(mapping);
+    CloseHandle(file);
+
+    if(wave->map == NULL) {
+        free(wave);
+        return NULL;
+    }
+#endif
+
+    if(!saladParseALwave(wave->map, wave->map_size, &wave->info)) {
+        saladCloseALwave(wave);
+        return NULL;
+    }
+
+    return wave;
+}
+
+void saladCloseALwave(SALAD_wave_type *wave)
+{
+    if(wave == NULL)
+        return;
+
+#if SALAD_POSIX
+    munmap(wave->map, wave->map_size);
+#elif SALAD_WIN32
+    UnmapViewOfFile(wave->map);
+#endif
+
+    free(wave);
+}
+
+void saladGetALwaveInfo(SALAD_wave_type *wave, SALAD_wave_info_type *info)
+{
+    *info = wave->info;
+}
+
+/**
+ * Uploads 16-bit samples on a big-endian host, which
+ * has to go through a byte-swapped copy on the heap
+ * @param procs     Functions to call
+ * @param info      Samples to upload
+ * @param buffer    Buffer to fill
+ * @returns         Zero on failure, SALAD_WAVE_COPIED on success
+ */
+static int upload_swapped(const struct wave_procs *procs, const SALAD_wave_info_type *info, ALuint buffer)
+{
+    const unsigned char *data = (const unsigned char *)info->data;
+    unsigned char *copy;
+    ALsizei i;
+    int result;
+
+    if((copy = (unsigned char *)malloc((size_t)info->size)) == NULL)
+        return 0;
+
+    for(i = 0; i + 1 < info->size; i += 2) {
+        copy[i] = data[i + 1];
+        copy[i + 1] = data[i];
+    }
+
+    procs->alGetError();
+    procs->alBufferData(buffer, info->format, copy, info->size, info->frequency);
+    result = (procs->alGetError() == AL_NO_ERROR) ? SALAD_WAVE_COPIED : 0;
+
+    free(copy);
+    return result;
+}
+
+/**
+ * Uploads the samples resampled to another rate;
+ * they're read as little-endian bytes, so this works
+ * the same on every host
+ * @param procs     Functions to call
+ * @param info      Samples to upload
+ * @param buffer    Buffer to fill
+ * @param frequency Sample rate to upload at
+ * @returns         Zero on failure, SALAD_WAVE_COPIED on success
+ */
+static int upload_resampled(const struct wave_procs *procs, const SALAD_wave_info_type *info, ALuint buffer, ALsizei frequency)
+{
+    const unsigned char *data = (const unsigned char *)info->data;
+    const ALsizei channels = (info->format == AL_FORMAT_STEREO8 || info->format == AL_FORMAT_STEREO16) ? 2 : 1;
+    const int wide = (info->format == AL_FORMAT_MONO16 || info->format == AL_FORMAT_STEREO16);
+    SALAD_resampler_type *resampler;
+    ALshort block[WAVE_BLOCK * 2];
+    ALshort *out;
+    ALsizei written = 0;
+    ALsizei capacity;
+    ALsizei pos, size, i;
+    long value;
+    int result;
+
+    if((resampler = saladCreateALresampler(info->frequency, frequency, channels)) == NULL)
+        return 0;
+
+    /* A single call bounds the whole output; an empty file
+     * still gets a frame so malloc(0) can't return NULL */
+    if((capacity = saladGetALresamplerOutput(resampler, info->frames)) < 1)
+        capacity = 1;
+
+    if((out = (ALshort *)malloc(sizeof(ALshort) * (size_t)capacity * (size_t)channels)) == NULL) {
+        saladDestroyALresampler(resampler);
+        return 0;
+    }
+
+    for(pos = 0; pos < info->frames; pos += size) {
+        size = (info->frames - pos < WAVE_BLOCK) ? info->frames - pos : WAVE_BLOCK;
+
+        if(wide) {
+            for(i = 0; i < size * channels; ++i) {
+                value = (long)data[i * 2] | ((long)data[i * 2 + 1] << 8);
+                block[i] = (ALshort)((value >= 32768L) ? value - 65536L : value);
+            }
+        }
+        else saladConvertALbyteToShort(block, data, size * channels);
+
+        data += size * channels * (wide ? 2 : 1);
+        written += saladResampleALshort(resampler, &out[written * channels], block, size);
+    }
+
+    written += saladFlushALresamplerShort(resampler, &out[written * channels]);
+    saladDestroyALresampler(resampler);
+
+    procs->alGetError();
+    procs->alBufferData(buffer, (channels == 2) ? AL_FORMAT_STEREO16 : AL_FORMAT_MONO16, out, written * channels * (ALsizei)sizeof(ALshort), frequency);
+    result = (procs->alGetError() == AL_NO_ERROR) ? SALAD_WAVE_COPIED : 0;
+
+    free(out);
+    return result;
+}
+
+static int upload_wave(const SALAD_table_type *table, SALAD_wave_type *wave, ALuint buffer, ALsizei frequency)
+{
+    struct wave_procs procs;
+    const SALAD_wave_info_type *info = &wave->info;
+
+    if(!get_procs(table, &procs))
+        return 0;
+
+    if(frequency > 0 && frequency != info->frequency)
+        return upload_resampled(&procs, info, buffer, frequency);
+
+    if(is_big_endian() && (info->format == AL_FORMAT_MONO16 || info->format == AL_FORMAT_STEREO16))
+        return upload_swapped(&procs, info, buffer);
+
+#if defined(AL_EXT_STATIC_BUFFER)
+    /* The mapping is read-only, which the driver
+     * never writes to despite the non-const pointer */
+    if(procs.alBufferDataStatic != NULL && procs.alIsExtensionPresent((const ALchar *)"AL_EXT_STATIC_BUFFER")) {
+        procs.alGetError();
+        procs.alBufferDataStatic((ALint)buffer, info->format, (ALvoid *)info->data, info->size, info->frequency);
+        if(procs.alGetError() == AL_NO_ERROR)
+            return SALAD_WAVE_STATIC;
+    }
+#endif
+
+    procs.alGetError();
+    procs.alBufferData(buffer, info->format, info->data, info->size, info->frequency);
+    return (procs.alGetError() == AL_NO_ERROR) ? SALAD_WAVE_COPIED : 0;
+}
+
+int saladUploadALwave(SALAD_wave_type *wave, ALuint buffer)
+{
+    return upload_wave(NULL, wave, buffer, 0);
+}
+
+int saladUploadALtableWave(const SALAD_table_type *table, SALAD_wave_type *wave, ALuint buffer)
+{
+    if(table == NULL)
+        return 0;
+    return upload_wave(table, wave, buffer, 0);
+}
+
+int saladUploadALwaveAt(SALAD_wave_type *wave, ALuint buffer, ALsizei frequency)
+{
+    return upload_wave(NULL, wave, buffer, frequency);
+}
+
+int saladUploadALtableWaveAt(const SALAD_table_type *table, SALAD_wave_type *wave, ALuint buffer, ALsizei frequency)
+{
+    if(table == NULL)
+        return 0;
+    return upload_wave(table, wave, buffer, frequency);
+}